@@ -0,0 +1,97 @@
+//============================================================================
+//                                  I B E X
+// File        : batch_arith.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the batch (vectorized) elementary functions
+ * with respect to the scalar functions of the interval library.
+ *
+ * Usage: batch_arith [n] [repeat]
+ */
+
+namespace {
+
+typedef Interval (*scalar_func)(const Interval&);
+typedef void (*batch_func)(const Interval*, Interval*, int);
+
+void bench(const char* name, scalar_func f, batch_func bf, const Interval* x, Interval* y, int n, int repeat) {
+	Timer::start();
+	for (int r=0; r<repeat; r++)
+		for (int i=0; i<n; i++) y[i]=f(x[i]);
+	Timer::stop();
+	double t_scalar=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int r=0; r<repeat; r++)
+		bf(x,y,n);
+	Timer::stop();
+	double t_batch=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << name << "\tscalar: " << t_scalar << "s\tbatch: " << t_batch << "s";
+	if (t_batch>0) cout << "\tspeedup: " << t_scalar/t_batch;
+	cout << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n=argc>1 ? atoi(argv[1]) : 100000;
+	int repeat=argc>2 ? atoi(argv[2]) : 20;
+
+	Interval* x=new Interval[n];
+	Interval* xpos=new Interval[n];
+	Interval* y=new Interval[n];
+
+	srand(1);
+	for (int i=0; i<n; i++) {
+		double a=20.0*rand()/RAND_MAX-10;
+		double w=1e-3*rand()/RAND_MAX;
+		x[i]=Interval(a,a+w);
+		xpos[i]=Interval(::fabs(a)+1e-3,::fabs(a)+1e-3+w);
+	}
+
+	cout << n << " intervals, " << repeat << " runs" << endl;
+	bench("exp",  exp,  batch_exp,  x,    y, n, repeat);
+	bench("log",  log,  batch_log,  xpos, y, n, repeat);
+	bench("cos",  cos,  batch_cos,  x,    y, n, repeat);
+	bench("sin",  sin,  batch_sin,  x,    y, n, repeat);
+	bench("atan", atan, batch_atan, x,    y, n, repeat);
+
+	// evaluation of a function over many boxes
+	Variable t;
+	Function f(t,exp(-t)*sin(t)+atan(cos(t)));
+	IntervalMatrix boxes(n,1);
+	for (int i=0; i<n; i++) boxes[i][0]=x[i];
+
+	Timer::start();
+	for (int r=0; r<repeat; r++)
+		for (int i=0; i<n; i++) y[i]=f.eval(boxes[i]);
+	Timer::stop();
+	double t_scalar=Timer::VIRTUAL_TIMELAPSE();
+
+	BatchEval be(f);
+	Timer::start();
+	for (int r=0; r<repeat; r++)
+		be.eval(boxes);
+	Timer::stop();
+	double t_batch=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "f\tscalar: " << t_scalar << "s\tbatch: " << t_batch << "s" << endl;
+
+	delete[] x;
+	delete[] xpos;
+	delete[] y;
+	return 0;
+}
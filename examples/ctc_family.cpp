@@ -0,0 +1,88 @@
+//============================================================================
+//                                  I B E X
+// File        : ctc_family.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Comparison of a composition of CtcFwdBwd (one function per constraint)
+ * and of a CtcFwdBwdFamily on the distance constraints of a localization
+ * problem (T positions, N beacons, as in slam/slam1.cpp).
+ *
+ * Usage: ctc_family [T] [N]
+ */
+int main(int argc, char** argv) {
+
+	int T = argc>1? atoi(argv[1]) : 1000;
+	int N = argc>2? atoi(argv[2]) : 10;
+
+	srand(1);
+
+	vector<double> bx(N), by(N), px(T), py(T);
+	for (int b=0; b<N; b++) { bx[b]=((double) rand()/RAND_MAX)*100; by[b]=((double) rand()/RAND_MAX)*100; }
+	for (int t=0; t<T; t++) { px[t]=((double) rand()/RAND_MAX)*100; py[t]=((double) rand()/RAND_MAX)*100; }
+
+	Interval* d=new Interval[T*N];
+	for (int t=0; t<T; t++)
+		for (int b=0; b<N; b++)
+			d[t*N+b]=::sqrt((px[t]-bx[b])*(px[t]-bx[b])+(py[t]-by[b])*(py[t]-by[b]))+Interval(-0.1,0.1);
+
+	// ====== one CtcFwdBwd per constraint ======
+	Timer::start();
+	Variable x(T,2);
+	Array<Ctc> ctc(T*N);
+	for (int t=0; t<T; t++)
+		for (int b=0; b<N; b++) {
+			NumConstraint* c=new NumConstraint(x,sqrt(sqr(x[t][0]-bx[b])+sqr(x[t][1]-by[b]))=d[t*N+b]);
+			ctc.set_ref(t*N+b,*new CtcFwdBwd(*c));
+		}
+	CtcCompo compo(ctc);
+	CtcFixPoint fix1(compo);
+	Timer::stop();
+	double build1=Timer::VIRTUAL_TIMELAPSE();
+
+	IntervalVector box1(2*T,Interval(0,100));
+	Timer::start();
+	fix1.contract(box1);
+	Timer::stop();
+	double time1=Timer::VIRTUAL_TIMELAPSE();
+
+	// ====== one family ======
+	Timer::start();
+	Variable a(2), c(2);
+	Function dist(a,c,sqrt(sqr(a[0]-c[0])+sqr(a[1]-c[1])));
+	CtcFwdBwdFamily family(dist,2*T);
+	int var[4];
+	IntervalVector value(4);
+	for (int t=0; t<T; t++)
+		for (int b=0; b<N; b++) {
+			var[0]=2*t; var[1]=2*t+1; var[2]=var[3]=-1;
+			value[2]=bx[b]; value[3]=by[b];
+			family.add(var,value,d[t*N+b]);
+		}
+	CtcFixPoint fix2(family);
+	Timer::stop();
+	double build2=Timer::VIRTUAL_TIMELAPSE();
+
+	IntervalVector box2(2*T,Interval(0,100));
+	Timer::start();
+	fix2.contract(box2);
+	Timer::stop();
+	double time2=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << T*N << " constraints" << endl;
+	cout << "  CtcFwdBwd:       build " << build1 << "s\tcontract " << time1 << "s\tperimeter " << box1.perimeter() << endl;
+	cout << "  CtcFwdBwdFamily: build " << build2 << "s\tcontract " << time2 << "s\tperimeter " << box2.perimeter() << endl;
+
+	delete[] d;
+	return 0;
+}
@@ -0,0 +1,55 @@
+//============================================================================
+//                                  I B E X
+// File        : newton_variants.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Comparison of the contractors for square systems of the default solver
+ * (interval Newton, Krawczyk and Hansen-Sengupta).
+ *
+ * Usage: newton_variants prec timelimit file1.bch [file2.bch ...]
+ *
+ * Example (from this directory):
+ *   newton_variants 1e-8 100 ../benchs/benchs-satisfaction/benchs-IBB/*.bch
+ */
+int main(int argc, char** argv) {
+
+	if (argc<4) {
+		ibex_error("usage: newton_variants prec timelimit file1.bch [file2.bch ...]");
+	}
+
+	double prec       = atof(argv[1]);
+	double time_limit = atof(argv[2]);
+
+	const char* names[] = { "newton", "krawczyk", "hansen-sengupta" };
+	DefaultSolver::newton_ctc variants[] = { DefaultSolver::NEWTON, DefaultSolver::KRAWCZYK, DefaultSolver::HANSEN_SENGUPTA };
+
+	for (int i=3; i<argc; i++) {
+		cout << argv[i] << endl;
+		for (int k=0; k<3; k++) {
+			try {
+				System sys(argv[i]);
+				DefaultSolver s(sys,prec,variants[k]);
+				s.time_limit=time_limit;
+				vector<IntervalVector> sols=s.solve(sys.box);
+				cout << "  " << names[k] << "\tsolutions: " << sols.size()
+					 << "\tcells: " << s.nb_cells << "\ttime: " << s.time << "s" << endl;
+			}
+			catch(ibex::SyntaxError& e) {
+				cout << e << endl;
+				break;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,83 @@
+//============================================================================
+//                                  I B E X
+// File        : qinter_bench.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Comparison of the q-intersection algorithms (grid and projections) on random
+ * boxes, for several numbers of boxes (p) and dimensions (n).
+ *
+ * All the boxes contain a common point (the "true" solution) except the
+ * outliers (p-q boxes drawn anywhere).
+ *
+ * The grid algorithm is exponential in n: it is skipped when p^n>1e4.
+ *
+ * Usage: qinter_bench [nb_trials]
+ */
+int main(int argc, char** argv) {
+
+	int nb_trials = argc>1? atoi(argv[1]) : 10;
+
+	int ps[] = { 10, 20, 50, 100 };
+	int ns[] = { 1, 2, 3, 4 };
+
+	srand(1);
+
+	for (int a=0; a<4; a++) {
+		for (int b=0; b<4; b++) {
+			int p=ps[a];
+			int n=ns[b];
+			int q=p-p/10;
+			bool run_grid=::pow((double) p,n)<=1e4;
+
+			double t_grid=0, t_proj=0, ratio=0;
+
+			for (int k=0; k<nb_trials; k++) {
+				Array<IntervalVector> boxes(p);
+				for (int j=0; j<p; j++) {
+					boxes.set_ref(j,*new IntervalVector(n));
+					for (int i=0; i<n; i++) {
+						double w=((double) rand()/RAND_MAX);
+						double c=(j<q)? 0 : ((double) rand()/RAND_MAX)*10-5;
+						double lb=c-((double) rand()/RAND_MAX)*w;
+						boxes[j][i]=Interval(lb,lb+w);
+					}
+				}
+
+				Timer::start();
+				IntervalVector proj=qinter_projf(boxes,q);
+				Timer::stop();
+				t_proj+=Timer::VIRTUAL_TIMELAPSE();
+
+				if (run_grid) {
+					Timer::start();
+					IntervalVector grid=qinter(boxes,q);
+					Timer::stop();
+					t_grid+=Timer::VIRTUAL_TIMELAPSE();
+
+					// ratio of the volumes (1 if the projections are exact)
+					if (!grid.is_empty() && proj.volume()>0)
+						ratio+=grid.volume()/proj.volume();
+				}
+
+				for (int j=0; j<p; j++) delete &boxes[j];
+			}
+
+			cout << "p=" << p << "\tn=" << n << "\tq=" << q << "\tproj: " << t_proj << "s";
+			if (run_grid)
+				cout << "\tgrid: " << t_grid << "s\tvolume ratio: " << ratio/nb_trials;
+			cout << endl;
+		}
+	}
+	return 0;
+}
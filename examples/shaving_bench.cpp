@@ -0,0 +1,60 @@
+//============================================================================
+//                                  I B E X
+// File        : shaving_bench.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Number of slices handled per second by the shaving of 3BCID
+ * (with HC4 as sub-contractor) on the Broyden banded system,
+ * for several sizes n.
+ *
+ * Usage: shaving_bench [s3b]
+ *
+ * (a value of s3b greater than 16 selects the dichotomic shaving)
+ */
+int main(int argc, char** argv) {
+
+	int s3b = argc>1? atoi(argv[1]) : 40;
+
+	int sizes[] = { 10, 50, 100, 200 };
+
+	for (int k=0; k<4; k++) {
+		int n=sizes[k];
+
+		Variable x(n);
+		SystemFactory fac;
+		fac.add_var(x);
+		for (int i=0; i<n; i++) {
+			const ExprNode* e=&(x[i]*(2+5*sqr(x[i]))+1);
+			for (int j=(i-5>0? i-5 : 0); j<=(i+1<n? i+1 : n-1); j++)
+				if (j!=i) e=&(*e-x[j]*(1+x[j]));
+			fac.add_ctr_eq(*e);
+		}
+		System sys(fac);
+
+		CtcHC4 hc4(sys.ctrs,0.1,true);
+		Ctc3BCid c3b(hc4,s3b,1);
+
+		IntervalVector box(n,Interval(-1,1));
+		Timer::start();
+		try {
+			for (int r=0; r<10; r++) c3b.contract(box);
+		} catch(EmptyBoxException&) { }
+		Timer::stop();
+		double t=Timer::VIRTUAL_TIMELAPSE();
+
+		cout << "n=" << n << "\tslices: " << c3b.nb_slices << "\trefuted: " << c3b.nb_refuted
+			 << "\ttime: " << t << "s\tslices/s: " << (t>0? c3b.nb_slices/t : 0) << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,408 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchArith.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BatchArith.h"
+
+#include <float.h>
+#include <math.h>
+#include <limits.h>
+
+/*
+ * Error analysis
+ * --------------
+ * Each kernel computes an approximation v of f(x) in floating-point
+ * arithmetic. The analysis below only assumes that each elementary operation
+ * (+,-,*,/,sqrt) is faithful, i.e., has an error <= 1ulp, which is true
+ * whatever the rounding mode is (the interval libraries may leave the FPU
+ * in upward rounding mode). Let u=2^-52.
+ *
+ * - exp:  x=k*log(2)+r, |r|<=log(2)/2 (+1e-12). k*LN2_HI is exact (k<2^11) and so is
+ *         x-k*LN2_HI (Sterbenz). The Taylor polynomial of degree 13 has a
+ *         truncation error < 5e-18, the Horner scheme applied on the "tail"
+ *         (e^r-1) gives a relative error < 6u.
+ * - log:  x=m*2^e with m in [sqrt(2)/2,sqrt(2)] (up to 1ulp); log(m)=2*atanh(s) with
+ *         s=(m-1)/(m+1), |s|<=0.172, series truncated after s^23.
+ *         The relative error is < 6u.
+ * - sin/cos: x=k*pi/2+r, |r|<=pi/4, with a 4-part Cody-Waite reduction
+ *         (k*PIO2_1,k*PIO2_2,k*PIO2_3 are exact for |x|<=TRIG_MAX).
+ *         The relative error is < 15u plus an absolute error due to
+ *         the reduction, bounded by |k|*2^-100.
+ * - atan: |x|>1 is mapped to 1/|x| and atan(u)=atan(c)+atan((u-c)/(1+c*u))
+ *         with c in {0,1/2,1} leads to |t|<=1/4 (u-c is exact).
+ *         The series is truncated after t^29. The relative error is < 20u.
+ *
+ * All these bounds are much smaller than REL_ERR=2^-45=128u.
+ */
+
+namespace ibex {
+
+namespace {
+
+/* relative error bound of the kernels */
+const double REL_ERR = 2.8421709430404007e-14; // 2^-45
+
+/* absolute error bound (subnormal numbers) */
+const double ABS_ERR = DBL_MIN;
+
+/* absolute error bound of the trigonometric reduction (per unit of k) */
+const double TRIG_ABS_ERR = 7.8886090522101181e-31; // 2^-100
+
+/* domain of the polynomial kernels */
+const double EXP_MAX  = 708.0;
+const double LOG_MAX  = 1e300;
+const double TRIG_MAX = 1e5;
+const double ATAN_MAX = 1e300;
+
+/* parameters of the monotonicity analysis of sin/cos */
+const double TRIG_DELTA = 9.3132257461547852e-10; // 2^-30
+
+const double INV_LN2 = 1.4426950408889634;
+const double LN2_HI  = 6.93147180369123816490e-01; // 0x3FE62E42FEE00000
+const double LN2_LO  = 1.90821492927058770002e-10; // 0x3DEA39EF35793C76
+
+const double INV_PI   = 0.31830988618379067;
+const double INV_PIO2 = 0.63661977236758138;
+const double PIO2_1   = 1.57079632673412561417e+00; // 0x3FF921FB54400000
+const double PIO2_2   = 6.07710050630396597660e-11; // 0x3DD0B4611A600000
+const double PIO2_3   = 2.02226624871116645580e-21; // 0x3BA3198A2E000000
+const double PIO2_3T  = 8.47842766036889956997e-32; // 0x397B839A252049C1
+
+const double PIO2_HI  = 1.57079632679489655800e+00; // 0x3FF921FB54442D18
+const double PIO2_LO  = 6.12323399573676603587e-17; // 0x3C91A62633145C07
+const double PIO4_HI  = 7.85398163397448278999e-01; // 0x3FE921FB54442D18
+const double PIO4_LO  = 3.06161699786838301793e-17; // 0x3C81A62633145C07
+const double ATAN_HALF_HI = 4.63647609000806093515e-01; // 0x3FDDAC670561BB4F
+const double ATAN_HALF_LO = 2.26987774529616870924e-17; // 0x3C7A2B7F222F65E2
+
+const double SQRT_2 = 1.4142135623730951;
+
+/* 1/(j+1)!, j=0..12 */
+const double EXP_C[13] = { 1.0, 0.5, 0.16666666666666666, 0.041666666666666664, 0.008333333333333333,
+		0.001388888888888889, 0.0001984126984126984, 2.48015873015873e-05, 2.7557319223985893e-06,
+		2.755731922398589e-07, 2.505210838544172e-08, 2.08767569878681e-09, 1.6059043836821613e-10 };
+
+/* 1/(2j+3), j=0..10 */
+const double LOG_C[11] = { 0.3333333333333333, 0.2, 0.14285714285714285, 0.1111111111111111,
+		0.09090909090909091, 0.07692307692307693, 0.06666666666666667, 0.058823529411764705,
+		0.05263157894736842, 0.047619047619047616, 0.043478260869565216 };
+
+/* (-1)^(j+1)/(2j+3)!, j=0..8 */
+const double SIN_C[9] = { -0.16666666666666666, 0.008333333333333333, -0.0001984126984126984,
+		2.7557319223985893e-06, -2.505210838544172e-08, 1.6059043836821613e-10, -7.647163731819816e-13,
+		2.8114572543455206e-15, -8.22063524662433e-18 };
+
+/* (-1)^(j+1)/(2j+2)!, j=0..9 */
+const double COS_C[10] = { -0.5, 0.041666666666666664, -0.001388888888888889, 2.48015873015873e-05,
+		-2.755731922398589e-07, 2.08767569878681e-09, -1.1470745597729725e-11, 4.779477332387385e-14,
+		-1.5619206968586225e-16, 4.110317623312165e-19 };
+
+/* (-1)^(j+1)/(2j+3), j=0..13 */
+const double ATAN_C[14] = { -0.3333333333333333, 0.2, -0.14285714285714285, 0.1111111111111111,
+		-0.09090909090909091, 0.07692307692307693, -0.06666666666666667, 0.058823529411764705,
+		-0.05263157894736842, 0.047619047619047616, -0.043478260869565216, 0.04,
+		-0.037037037037037035, 0.034482758620689655 };
+
+/* size of the buffers (lower and upper bounds) */
+const int B2=2*BATCH_BLOCK_SIZE;
+
+inline double lo(double v) { return v - (::fabs(v)*REL_ERR + ABS_ERR); }
+inline double up(double v) { return v + (::fabs(v)*REL_ERR + ABS_ERR); }
+
+inline double horner(const double* c, int deg, double x) {
+	double p=c[deg];
+	for (int j=deg-1; j>=0; j--) p=c[j]+x*p;
+	return p;
+}
+
+/*
+ * Point kernels.
+ *
+ * The main loops only contain straight-line code (no comparison,
+ * no call to the math library) so that they can be vectorized.
+ * Note that the nearest integer of v is obtained by truncation
+ * of v+offset+0.5 (positive).
+ */
+void exp_kernel(const double* x, double* y) {
+	int k[B2];
+	for (int i=0; i<B2; i++) {
+		k[i]=(int) (x[i]*INV_LN2+2048.5)-2048;
+		double r=(x[i]-k[i]*LN2_HI)-k[i]*LN2_LO;
+		y[i]=1.0+r*horner(EXP_C,12,r);
+	}
+	for (int i=0; i<B2; i++)
+		y[i]=::ldexp(y[i],k[i]); // exact (no overflow/underflow in the domain)
+}
+
+void log_kernel(const double* x, double* y) {
+	double m[B2];
+	double e[B2];
+	for (int i=0; i<B2; i++) {
+		int ei;
+		m[i]=::frexp(x[i],&ei);  // m in [0.5,1)
+		e[i]=ei;
+	}
+	for (int i=0; i<B2; i++) {
+		int c=(int) (m[i]*SQRT_2); // 0 if m<sqrt(2)/2, 1 otherwise
+		double mi=m[i]*(2-c);      // exact, mi in [sqrt(2)/2,sqrt(2)] (up to 1ulp)
+		double ei=e[i]+(c-1);
+		double f=mi-1.0;           // exact (Sterbenz)
+		double s=f/(2.0+f);
+		double z=s*s;
+		double t=2*s;
+		double lm=t+t*(z*horner(LOG_C,10,z));
+		y[i]=ei*LN2_HI+(lm+ei*LN2_LO);
+	}
+}
+
+/*
+ * Calculate sin(x) in s, cos(x) in c and the absolute error due to the
+ * reduction in err. The relative error of s and c is REL_ERR.
+ */
+void sincos_kernel(const double* x, double* s, double* c, double* err) {
+	for (int i=0; i<B2; i++) {
+		int k=(int) (x[i]*INV_PIO2+65536.5)-65536;
+		double r=(((x[i]-k*PIO2_1)-k*PIO2_2)-k*PIO2_3)-k*PIO2_3T;
+		double z=r*r;
+		double sr=r+r*(z*horner(SIN_C,8,z));
+		double cr=1.0+z*horner(COS_C,9,z);
+		// sin(k*pi/2) and cos(k*pi/2) (in {-1,0,1}), q in {0,1,2,3}
+		int q=k&3;
+		double sq=(q&1)*(2-q);
+		double cq=(1-(q&1))*(1-q);
+		// all the products are exact, and so are the sums (one term is zero)
+		s[i]=sr*cq+cr*sq;
+		c[i]=cr*cq-sr*sq;
+		err[i]=::fabs((double) k)*TRIG_ABS_ERR;
+	}
+}
+
+/*
+ * Calculate atan(|x|).
+ */
+void atan_kernel(const double* x, double* y) {
+	for (int i=0; i<B2; i++) {
+		double a=::fabs(x[i]);
+		int c=(int) (a/(1.0+a)+0.5);     // 0 if a<1, 1 otherwise
+		double ia=1.0/(a+(1-c));         // 1/a if c=1
+		double u=(1-c)*a+c*ia;           // exact, u in [0,1] (up to 1ulp)
+		// atan(u)=atan(d/2)+atan(t) with d in {0,1,2}
+		int d=(int) (2*u+0.5);
+		double h=0.5*d;
+		double t=(u-h)/(1.0+h*u);        // |t|<=0.25, u-h is exact (Sterbenz)
+		double z=t*t;
+		double hi=(d*(2-d))*ATAN_HALF_HI+(d*(d-1)/2)*PIO4_HI;
+		double lo=(d*(2-d))*ATAN_HALF_LO+(d*(d-1)/2)*PIO4_LO;
+		double v=hi+(lo+(t+t*(z*horner(ATAN_C,13,z))));
+		y[i]=(1-c)*v+c*((PIO2_HI-v)+PIO2_LO);
+	}
+}
+
+/*
+ * Interval version of sin (sine=true) or cos (sine=false).
+ */
+void batch_trig(const Interval* x, Interval* y, int n, bool sine) {
+	double b[B2],s[B2],c[B2],err[B2];
+	bool fast[BATCH_BLOCK_SIZE];
+	bool full[BATCH_BLOCK_SIZE];
+	double ka[BATCH_BLOCK_SIZE];
+	double kb[BATCH_BLOCK_SIZE];
+	// Let t=x/pi (for cos) or t=x/pi-1/2 (for sin).
+	// The function is decreasing on [2k,2k+1] and increasing on [2k+1,2k+2].
+	const double shift=sine? 0.5 : 0.0;
+
+	for (int i0=0; i0<n; i0+=BATCH_BLOCK_SIZE) {
+		int m=n-i0<BATCH_BLOCK_SIZE? n-i0 : BATCH_BLOCK_SIZE;
+
+		for (int i=0; i<m; i++) {
+			const Interval& xi=x[i0+i];
+			full[i]=false;
+			fast[i]=false;
+			if (!xi.is_empty() && xi.diam()>7) {
+				full[i]=true;  // contains a period
+			}
+			else if (!xi.is_empty() && ::fabs(xi.lb())<=TRIG_MAX && ::fabs(xi.ub())<=TRIG_MAX) {
+				double ta=xi.lb()*INV_PI-shift;
+				double tb=xi.ub()*INV_PI-shift;
+				ka[i]=::floor(ta);
+				kb[i]=::floor(tb);
+				// the position w.r.t. the extrema must be certain
+				fast[i]=ta-ka[i]>=TRIG_DELTA && ka[i]+1-ta>=TRIG_DELTA &&
+						tb-kb[i]>=TRIG_DELTA && kb[i]+1-tb>=TRIG_DELTA;
+				if (fast[i] && kb[i]-ka[i]>=2) { fast[i]=false; full[i]=true; }
+			}
+			b[i]=fast[i]? xi.lb() : 0;
+			b[BATCH_BLOCK_SIZE+i]=fast[i]? xi.ub() : 0;
+		}
+		for (int i=m; i<BATCH_BLOCK_SIZE; i++) b[i]=b[BATCH_BLOCK_SIZE+i]=0; // padding
+
+		sincos_kernel(b,s,c,err);
+
+		for (int i=0; i<m; i++) {
+			if (full[i]) {
+				y[i0+i]=Interval(-1,1);
+			} else if (!fast[i]) {
+				y[i0+i]=sine? sin(x[i0+i]) : cos(x[i0+i]);
+			} else {
+				const double* v=sine? s : c;
+				double la=lo(v[i])-err[i],   ua=up(v[i])+err[i];
+				double lb=lo(v[BATCH_BLOCK_SIZE+i])-err[BATCH_BLOCK_SIZE+i], ub=up(v[BATCH_BLOCK_SIZE+i])+err[BATCH_BLOCK_SIZE+i];
+				bool even=((long) ka[i])%2==0;
+				double l,u;
+				if (kb[i]==ka[i]) {
+					if (even) { l=lb; u=ua; }   // decreasing
+					else      { l=la; u=ub; }   // increasing
+				} else {
+					// one extremum, in t=kb
+					if (even) { l=-1; u=ua>ub? ua : ub; } // kb is odd: minimum
+					else      { l=la<lb? la : lb; u=1; }  // kb is even: maximum
+				}
+				y[i0+i]=Interval(l<-1? -1 : l, u>1? 1 : u);
+			}
+		}
+	}
+}
+
+} // end anonymous namespace
+
+void batch_exp(const Interval* x, Interval* y, int n) {
+	double b[B2],v[B2];
+	bool fast[BATCH_BLOCK_SIZE];
+
+	for (int i0=0; i0<n; i0+=BATCH_BLOCK_SIZE) {
+		int m=n-i0<BATCH_BLOCK_SIZE? n-i0 : BATCH_BLOCK_SIZE;
+
+		for (int i=0; i<m; i++) {
+			const Interval& xi=x[i0+i];
+			fast[i]=!xi.is_empty() && xi.lb()>=-EXP_MAX && xi.ub()<=EXP_MAX;
+			b[i]=fast[i]? xi.lb() : 0;
+			b[BATCH_BLOCK_SIZE+i]=fast[i]? xi.ub() : 0;
+		}
+		for (int i=m; i<BATCH_BLOCK_SIZE; i++) b[i]=b[BATCH_BLOCK_SIZE+i]=0; // padding
+
+		exp_kernel(b,v);
+
+		for (int i=0; i<m; i++) {
+			if (fast[i]) {
+				double l=lo(v[i]);
+				y[i0+i]=Interval(l<0? 0 : l, up(v[BATCH_BLOCK_SIZE+i]));
+			}
+			else
+				y[i0+i]=exp(x[i0+i]);
+		}
+	}
+}
+
+void batch_log(const Interval* x, Interval* y, int n) {
+	double b[B2],v[B2];
+	bool fast[BATCH_BLOCK_SIZE];
+
+	for (int i0=0; i0<n; i0+=BATCH_BLOCK_SIZE) {
+		int m=n-i0<BATCH_BLOCK_SIZE? n-i0 : BATCH_BLOCK_SIZE;
+
+		for (int i=0; i<m; i++) {
+			const Interval& xi=x[i0+i];
+			fast[i]=!xi.is_empty() && xi.lb()>0 && xi.ub()<=LOG_MAX;
+			b[i]=fast[i]? xi.lb() : 1;
+			b[BATCH_BLOCK_SIZE+i]=fast[i]? xi.ub() : 1;
+		}
+		for (int i=m; i<BATCH_BLOCK_SIZE; i++) b[i]=b[BATCH_BLOCK_SIZE+i]=1; // padding
+
+		log_kernel(b,v);
+
+		for (int i=0; i<m; i++) {
+			if (fast[i])
+				y[i0+i]=Interval(lo(v[i]), up(v[BATCH_BLOCK_SIZE+i]));
+			else
+				y[i0+i]=log(x[i0+i]);
+		}
+	}
+}
+
+void batch_cos(const Interval* x, Interval* y, int n) {
+	batch_trig(x,y,n,false);
+}
+
+void batch_sin(const Interval* x, Interval* y, int n) {
+	batch_trig(x,y,n,true);
+}
+
+void batch_atan(const Interval* x, Interval* y, int n) {
+	double b[B2],v[B2];
+	bool fast[BATCH_BLOCK_SIZE];
+
+	for (int i0=0; i0<n; i0+=BATCH_BLOCK_SIZE) {
+		int m=n-i0<BATCH_BLOCK_SIZE? n-i0 : BATCH_BLOCK_SIZE;
+
+		for (int i=0; i<m; i++) {
+			const Interval& xi=x[i0+i];
+			fast[i]=!xi.is_empty() && xi.lb()>=-ATAN_MAX && xi.ub()<=ATAN_MAX;
+			b[i]=fast[i]? xi.lb() : 0;
+			b[BATCH_BLOCK_SIZE+i]=fast[i]? xi.ub() : 0;
+		}
+		for (int i=m; i<BATCH_BLOCK_SIZE; i++) b[i]=b[BATCH_BLOCK_SIZE+i]=0; // padding
+
+		atan_kernel(b,v);
+
+		for (int i=0; i<m; i++) {
+			if (fast[i]) {
+				// atan is odd
+				double l=x[i0+i].lb()<0? -up(v[i]) : lo(v[i]);
+				double u=x[i0+i].ub()<0? -lo(v[BATCH_BLOCK_SIZE+i]) : up(v[BATCH_BLOCK_SIZE+i]);
+				y[i0+i]=Interval(l,u);
+			} else
+				y[i0+i]=atan(x[i0+i]);
+		}
+	}
+}
+
+void batch_pow(const Interval* x, int p, Interval* y, int n) {
+	// no transcendental function involved: the scalar
+	// version is already optimal.
+	for (int i=0; i<n; i++)
+		y[i]=pow(x[i],p);
+}
+
+void batch_pow(const Interval* x, double p, Interval* y, int n) {
+	if (p==::floor(p) && ::fabs(p)<=INT_MAX) {
+		batch_pow(x,(int) p,y,n);
+		return;
+	}
+	batch_pow(x,Interval(p),y,n);
+}
+
+void batch_pow(const Interval* x, const Interval& p, Interval* y, int n) {
+	Interval t[BATCH_BLOCK_SIZE];
+	bool pos[BATCH_BLOCK_SIZE];
+
+	for (int i0=0; i0<n; i0+=BATCH_BLOCK_SIZE) {
+		int m=n-i0<BATCH_BLOCK_SIZE? n-i0 : BATCH_BLOCK_SIZE;
+
+		for (int i=0; i<m; i++) {
+			const Interval& xi=x[i0+i];
+			pos[i]=!xi.is_empty() && !p.is_empty() && xi.lb()>0 && xi.ub()<POS_INFINITY;
+			t[i]=pos[i]? xi : Interval(1.0);
+		}
+
+		// x^p=exp(p*log(x))
+		batch_log(t,t,m);
+		for (int i=0; i<m; i++) t[i]*=p;
+		batch_exp(t,t,m);
+
+		for (int i=0; i<m; i++) {
+			if (pos[i])
+				y[i0+i]=t[i];
+			else if (p.is_degenerated())
+				y[i0+i]=pow(x[i0+i],p.lb());
+			else
+				y[i0+i]=pow(x[i0+i],p);
+		}
+	}
+}
+
+} // end namespace ibex
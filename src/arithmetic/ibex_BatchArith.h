@@ -0,0 +1,158 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchArith.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BATCH_ARITH_H__
+#define __IBEX_BATCH_ARITH_H__
+
+#include "ibex_IntervalVector.h"
+
+namespace ibex {
+
+/**\ingroup arithmetic */
+/*@{*/
+
+/*
+ * Batch (vectorized) versions of the elementary interval functions.
+ *
+ * The input intervals are processed by blocks of #BATCH_BLOCK_SIZE
+ * intervals. Inside a block, the bounds are stored contiguously and
+ * evaluated with a range reduction followed by a polynomial
+ * approximation, in a loop without data-dependent branches (so that
+ * the compiler can use SIMD instructions). The result of the polynomial
+ * is then enlarged by a certified bound of the (truncation+rounding) error,
+ * so that every result is a rigorous enclosure, whatever the current
+ * rounding mode of the FPU is.
+ *
+ * The enclosures are slightly wider (relatively, about 2^-45) than those
+ * of the underlying interval library. Intervals that fall outside the
+ * domain of the polynomial kernels (empty, unbounded or too large
+ * intervals, non-positive arguments of log, etc.) are transparently
+ * evaluated with the scalar functions of the underlying library.
+ *
+ * In all these functions, \a x and \a y may point to the same array.
+ */
+
+/** \brief Number of intervals processed simultaneously by the batch functions. */
+#define BATCH_BLOCK_SIZE 8
+
+/**
+ * \brief Batch exp.
+ *
+ * Set y[i] to an enclosure of exp(x[i]), for all 0<=i<n.
+ */
+void batch_exp(const Interval* x, Interval* y, int n);
+
+/**
+ * \brief Batch log.
+ *
+ * Set y[i] to an enclosure of log(x[i]), for all 0<=i<n.
+ */
+void batch_log(const Interval* x, Interval* y, int n);
+
+/**
+ * \brief Batch cos.
+ *
+ * Set y[i] to an enclosure of cos(x[i]), for all 0<=i<n.
+ */
+void batch_cos(const Interval* x, Interval* y, int n);
+
+/**
+ * \brief Batch sin.
+ *
+ * Set y[i] to an enclosure of sin(x[i]), for all 0<=i<n.
+ */
+void batch_sin(const Interval* x, Interval* y, int n);
+
+/**
+ * \brief Batch atan.
+ *
+ * Set y[i] to an enclosure of atan(x[i]), for all 0<=i<n.
+ */
+void batch_atan(const Interval* x, Interval* y, int n);
+
+/**
+ * \brief Batch pow with an integer exponent.
+ *
+ * Set y[i] to an enclosure of x[i]^p, for all 0<=i<n.
+ */
+void batch_pow(const Interval* x, int p, Interval* y, int n);
+
+/**
+ * \brief Batch pow with a real exponent.
+ *
+ * Set y[i] to an enclosure of x[i]^p, for all 0<=i<n.
+ * For positive intervals, x^p is calculated as exp(p*log(x)).
+ */
+void batch_pow(const Interval* x, double p, Interval* y, int n);
+
+/**
+ * \brief Batch pow with an interval exponent.
+ *
+ * Set y[i] to an enclosure of x[i]^p, for all 0<=i<n.
+ * For positive intervals, x^p is calculated as exp(p*log(x)).
+ */
+void batch_pow(const Interval* x, const Interval& p, Interval* y, int n);
+
+/** \brief Componentwise exp([x]) (see #batch_exp(const Interval*, Interval*, int)). */
+IntervalVector batch_exp(const IntervalVector& x);
+
+/** \brief Componentwise log([x]) (see #batch_log(const Interval*, Interval*, int)). */
+IntervalVector batch_log(const IntervalVector& x);
+
+/** \brief Componentwise cos([x]) (see #batch_cos(const Interval*, Interval*, int)). */
+IntervalVector batch_cos(const IntervalVector& x);
+
+/** \brief Componentwise sin([x]) (see #batch_sin(const Interval*, Interval*, int)). */
+IntervalVector batch_sin(const IntervalVector& x);
+
+/** \brief Componentwise atan([x]) (see #batch_atan(const Interval*, Interval*, int)). */
+IntervalVector batch_atan(const IntervalVector& x);
+
+/** \brief Componentwise [x]^p. */
+IntervalVector batch_pow(const IntervalVector& x, int p);
+
+/** \brief Componentwise [x]^p. */
+IntervalVector batch_pow(const IntervalVector& x, double p);
+
+/** \brief Componentwise [x]^[p]. */
+IntervalVector batch_pow(const IntervalVector& x, const Interval& p);
+
+/*@}*/
+
+/*============================================ inline implementation ============================================ */
+
+#define __batch_vector_func__(f) \
+		const int n=x.size(); \
+		IntervalVector y(n); \
+		if (x.is_empty()) { y.set_empty(); return y; } \
+		f(&x[0],&y[0],n); \
+		return y;
+
+#define __batch_vector_func_p__(f) \
+		const int n=x.size(); \
+		IntervalVector y(n); \
+		if (x.is_empty()) { y.set_empty(); return y; } \
+		f(&x[0],p,&y[0],n); \
+		return y;
+
+inline IntervalVector batch_exp(const IntervalVector& x)                    { __batch_vector_func__(batch_exp) }
+inline IntervalVector batch_log(const IntervalVector& x)                    { __batch_vector_func__(batch_log) }
+inline IntervalVector batch_cos(const IntervalVector& x)                    { __batch_vector_func__(batch_cos) }
+inline IntervalVector batch_sin(const IntervalVector& x)                    { __batch_vector_func__(batch_sin) }
+inline IntervalVector batch_atan(const IntervalVector& x)                   { __batch_vector_func__(batch_atan) }
+inline IntervalVector batch_pow(const IntervalVector& x, int p)             { __batch_vector_func_p__(batch_pow) }
+inline IntervalVector batch_pow(const IntervalVector& x, double p)          { __batch_vector_func_p__(batch_pow) }
+inline IntervalVector batch_pow(const IntervalVector& x, const Interval& p) { __batch_vector_func_p__(batch_pow) }
+
+#undef __batch_vector_func__
+#undef __batch_vector_func_p__
+
+} // end namespace ibex
+
+#endif // __IBEX_BATCH_ARITH_H__
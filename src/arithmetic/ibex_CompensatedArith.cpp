@@ -0,0 +1,290 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CompensatedArith.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CompensatedArith.h"
+
+#include <math.h>
+#include <fenv.h>
+
+/*
+ * Error analysis
+ * --------------
+ * The accumulation is performed in rounding-to-nearest mode, where
+ * TwoSum and TwoProduct (Dekker's algorithm) are error-free: s+e=a+b
+ * and p+e=a*b exactly. TwoProduct is exact if there is no underflow,
+ * i.e., if |a*b|>=2^-960 (otherwise the term e is dropped and the
+ * error, smaller than 2^-1012, is counted apart) and no overflow in the
+ * splitting (|a|,|b|<=2^996, checked beforehand).
+ *
+ * So the exact sum is s+sum(e_i) where the m error terms e_i are
+ * accumulated in err (with recursive summation) and their absolute values
+ * in abs. We have |err-sum(e_i)|<=gamma_m*sum|e_i|<=gamma_m(1+gamma_m)*abs
+ * which is bounded by 2(m+1)u*abs (u=2^-53). The final bounds s+err-delta
+ * and s+err+delta are rounded outward with previous_float/next_float after
+ * each operation, which is valid in any rounding mode. This matters because
+ * the compiler may move these operations across fesetround (see
+ * Accumulator::close()).
+ */
+
+namespace ibex {
+
+using compensated::Accumulator;
+using compensated::MIN_TERMS;
+using compensated::others;
+
+namespace {
+
+const double SPLITTER  = 134217729.0;             // 2^27+1
+const double SPLIT_MAX = 6.6969287949141707e+299; // 2^996
+const double TINY      = 1.0261342003245941e-289; // 2^-960
+
+inline void split(double a, double& h, double& l) {
+	double c=SPLITTER*a;
+	h=c-(c-a);
+	l=a-h;
+}
+
+inline void two_prod(double a, double b, double& p, double& e) {
+	double ah,al,bh,bl;
+	p=a*b;
+	split(a,ah,al);
+	split(b,bh,bl);
+	e=al*bl-(((p-ah*bh)-al*bh)-ah*bl);
+}
+
+/*
+ * Add to "acc" the exact product a*b.
+ */
+inline void add_prod(Accumulator& acc, double a, double b) {
+	double p,e;
+	two_prod(a,b,p,e);
+	acc.add_prod(p,e,::fabs(p)<TINY && a!=0 && b!=0 ? 1 : 0);
+}
+
+/*
+ * Add to "acc" the exact value min(a1*b1,a2*b2) (or the max if "max" is true).
+ */
+inline void add_prod_minmax(Accumulator& acc, double a1, double b1, double a2, double b2, bool max) {
+	double p1,e1,p2,e2;
+	two_prod(a1,b1,p1,e1);
+	two_prod(a2,b2,p2,e2);
+	if (::fabs(p1)<TINY || ::fabs(p2)<TINY) {
+		// the comparison may be wrong, but by less than 2*2^-1012.
+		acc.add_prod(max? (p1>p2? p1:p2) : (p1<p2? p1:p2), 0, 3);
+	} else {
+		bool first= max? (p1>p2 || (p1==p2 && e1>e2)) : (p1<p2 || (p1==p2 && e1<e2));
+		if (first) acc.add_prod(p1,e1,0);
+		else acc.add_prod(p2,e2,0);
+	}
+}
+
+/*
+ * Add the bounds of x*y to (l,u).
+ */
+inline void add_prod(Accumulator& l, Accumulator& u, const Interval& x, const Interval& y) {
+	const double xl=x.lb(), xu=x.ub(), yl=y.lb(), yu=y.ub();
+
+	if (xl>=0) {
+		if (yl>=0)      { add_prod(l,xl,yl); add_prod(u,xu,yu); }
+		else if (yu<=0) { add_prod(l,xu,yl); add_prod(u,xl,yu); }
+		else            { add_prod(l,xu,yl); add_prod(u,xu,yu); }
+	} else if (xu<=0) {
+		if (yl>=0)      { add_prod(l,xl,yu); add_prod(u,xu,yl); }
+		else if (yu<=0) { add_prod(l,xu,yu); add_prod(u,xl,yl); }
+		else            { add_prod(l,xl,yu); add_prod(u,xl,yl); }
+	} else {
+		if (yl>=0)      { add_prod(l,xl,yu); add_prod(u,xu,yu); }
+		else if (yu<=0) { add_prod(l,xu,yl); add_prod(u,xl,yl); }
+		else {
+			add_prod_minmax(l,xl,yu,xu,yl,false);
+			add_prod_minmax(u,xl,yl,xu,yu,true);
+		}
+	}
+}
+
+inline bool splittable(const Interval& x) {
+	return x.lb()>=-SPLIT_MAX && x.ub()<=SPLIT_MAX;
+}
+
+/*
+ * The terms of a sum
+ */
+class SumTerm {
+public:
+	SumTerm(Interval* x) : x(x) { }
+	Interval& operator()(int i) const { return x[i]; }
+	Interval* x;
+};
+
+/*
+ * Same as compensated::sum_bounds, for the terms x[i]*y[i].
+ *
+ * The products are accumulated exactly (TwoProduct), not computed
+ * with interval arithmetic: the accumulation is performed in
+ * rounding-to-nearest mode, where the interval operators of Gaol
+ * or Bias (that assume the upward rounding mode) are not rigorous.
+ *
+ * Return true if L (resp. U) bounds the sum of the exact lower (resp. upper)
+ * bounds of the products, false if it bounds the sum of the lower (resp. upper)
+ * bounds of the interval products.
+ */
+bool dot_bounds(const Interval* x, const Interval* y, int n, double& L, double& U, int& nl, int& nu) {
+	bool naive=false;
+	for (int i=0; i<n; i++)
+		if (!splittable(x[i]) || !splittable(y[i])) naive=true;
+
+	nl=nu=0;
+
+	if (!naive) {
+		Accumulator l,u;
+		int mode=fegetround();
+
+		fpu_round_near();
+		for (int i=0; i<n; i++)
+			add_prod(l,u,x[i],y[i]);
+		l.close();
+		u.close();
+		fesetround(mode);
+		L=l.lower();
+		U=u.upper();
+
+		if (l.finite() && u.finite()) return true;
+	}
+
+	// infinite bounds or overflow: naive accumulation
+	Interval sl(0), su(0);
+	for (int i=0; i<n; i++) {
+		Interval xy=x[i]*y[i];
+		if (xy.lb()>NEG_INFINITY) sl+=xy.lb(); else nl++;
+		if (xy.ub()<POS_INFINITY) su+=xy.ub(); else nu++;
+	}
+	L=sl.lb();
+	U=su.ub();
+	return false;
+}
+
+/*
+ * Enclosure of the exact lower bound of x*y (or the upper bound if "max" is true).
+ * x and y are bounded.
+ */
+Interval prod_bound(const Interval& x, const Interval& y, bool max) {
+	Interval p[4] = { Interval(x.lb())*y.lb(), Interval(x.lb())*y.ub(),
+	                  Interval(x.ub())*y.lb(), Interval(x.ub())*y.ub() };
+	double l=p[0].lb(), u=p[0].ub();
+	for (int k=1; k<4; k++) {
+		if (max) { if (p[k].lb()>l) l=p[k].lb(); if (p[k].ub()>u) u=p[k].ub(); }
+		else     { if (p[k].lb()<l) l=p[k].lb(); if (p[k].ub()<u) u=p[k].ub(); }
+	}
+	return Interval(l,u);
+}
+
+} // end anonymous namespace
+
+Interval sum(const Interval* x, int n) {
+	return sum_terms(SumTerm((Interval*) x),n);
+}
+
+Interval dot(const Interval* x, const Interval* y, int n) {
+	bool naive=n<MIN_TERMS;
+
+	for (int i=0; i<n; i++) {
+		if (x[i].is_empty() || y[i].is_empty()) return Interval::EMPTY_SET;
+		if (!splittable(x[i]) || !splittable(y[i])) naive=true;
+	}
+
+	if (!naive) {
+		Accumulator l,u;
+		int mode=fegetround();
+
+		fpu_round_near();
+		for (int i=0; i<n; i++)
+			add_prod(l,u,x[i],y[i]);
+		l.close();
+		u.close();
+		fesetround(mode);
+		double L=l.lower();
+		double U=u.upper();
+
+		if (l.finite() && u.finite())
+			return Interval(L,U);
+	}
+
+	Interval res(0);
+	for (int i=0; i<n; i++) res+=x[i]*y[i];
+	return res;
+}
+
+Interval dot(const double* x, const Interval* y, int n) {
+	bool naive=n<MIN_TERMS;
+
+	for (int i=0; i<n; i++) {
+		if (y[i].is_empty()) return Interval::EMPTY_SET;
+		if (::fabs(x[i])>SPLIT_MAX || !splittable(y[i])) naive=true;
+	}
+
+	if (!naive) {
+		Accumulator l,u;
+		int mode=fegetround();
+
+		fpu_round_near();
+		for (int i=0; i<n; i++) {
+			if (x[i]>=0) { add_prod(l,x[i],y[i].lb()); add_prod(u,x[i],y[i].ub()); }
+			else         { add_prod(l,x[i],y[i].ub()); add_prod(u,x[i],y[i].lb()); }
+		}
+		l.close();
+		u.close();
+		fesetround(mode);
+		double L=l.lower();
+		double U=u.upper();
+
+		if (l.finite() && u.finite())
+			return Interval(L,U);
+	}
+
+	Interval res(0);
+	for (int i=0; i<n; i++) res+=x[i]*y[i];
+	return res;
+}
+
+bool proj_sum(const Interval& y, Interval* x, int n) {
+	return proj_sum_terms(y,SumTerm(x),n);
+}
+
+bool proj_dot(const Interval& z, Interval* x, Interval* y, int n) {
+	bool empty=z.is_empty();
+	for (int i=0; !empty && i<n; i++)
+		empty=x[i].is_empty() || y[i].is_empty();
+
+	if (!empty) {
+		double L,U;
+		int nl,nu;
+		bool exact=dot_bounds(x,y,n,L,U,nl,nu);
+
+		for (int i=0; !empty && i<n; i++) {
+			Interval xy=x[i]*y[i];
+			// the bounds of the ith term in L and U (the largest possible
+			// exact lower bound and the smallest possible exact upper bound)
+			double tl=exact? prod_bound(x[i],y[i],false).ub() : xy.lb();
+			double tu=exact? prod_bound(x[i],y[i],true).lb()  : xy.ub();
+			empty = (xy &= z-others(L,U,nl,nu,tl,tu)).is_empty()
+					|| !proj_mul(xy,x[i],y[i]);
+		}
+	}
+
+	if (empty) {
+		for (int i=0; i<n; i++) {
+			x[i].set_empty();
+			y[i].set_empty();
+		}
+		return false;
+	}
+	return true;
+}
+
+} // end namespace ibex
@@ -0,0 +1,293 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CompensatedArith.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_COMPENSATED_ARITH_H__
+#define __IBEX_COMPENSATED_ARITH_H__
+
+#include "ibex_Interval.h"
+
+#include <math.h>
+#include <fenv.h>
+
+namespace ibex {
+
+/**\ingroup arithmetic */
+/*@{*/
+
+/*
+ * Sums and dot products of intervals with compensated accumulation.
+ *
+ * The bounds are accumulated with error-free transformations (TwoSum,
+ * TwoProduct): the sum of the lower (resp. upper) bounds is represented
+ * exactly by a floating-point number and a list of error terms, and
+ * the only rounding is the final (directed) rounding of the error terms.
+ * The result is (almost) the hull of the exact sum, whatever the
+ * number of terms is, while a sequence of n interval additions
+ * enlarges the result by n roundings.
+ *
+ * None of these functions allocates memory.
+ */
+
+/**
+ * \brief Enclosure of x[0]+...+x[n-1].
+ */
+Interval sum(const Interval* x, int n);
+
+/**
+ * \brief Enclosure of x[0]*y[0]+...+x[n-1]*y[n-1].
+ */
+Interval dot(const Interval* x, const Interval* y, int n);
+
+/**
+ * \brief Enclosure of x[0]*y[0]+...+x[n-1]*y[n-1].
+ */
+Interval dot(const double* x, const Interval* y, int n);
+
+/**
+ * \brief Projection of y=x[0]+...+x[n-1].
+ *
+ * Each x[i] is contracted with respect to y and the (initial)
+ * domains of the other terms. The projection runs in O(n).
+ *
+ * \return false if the result is empty (all the x[i] are
+ * then set to the empty set).
+ */
+bool proj_sum(const Interval& y, Interval* x, int n);
+
+/**
+ * \brief Projection of z=x[0]*y[0]+...+x[n-1]*y[n-1].
+ *
+ * Run in O(n) (and without memory allocation).
+ *
+ * \return false if the result is empty (all the x[i] and y[i] are
+ * then set to the empty set).
+ */
+bool proj_dot(const Interval& z, Interval* x, Interval* y, int n);
+
+/**
+ * \brief Enclosure of term(0)+...+term(n-1).
+ *
+ * \a term is any object such that term(i) returns the ith term.
+ * This allows to sum intervals that are not stored contiguously.
+ */
+template<class T>
+Interval sum_terms(const T& term, int n);
+
+/**
+ * \brief Projection of y=term(0)+...+term(n-1).
+ *
+ * term(i) must return a reference to the ith term
+ * (which is contracted in-place).
+ *
+ * \return false if the result is empty (all the terms are
+ * then set to the empty set).
+ */
+template<class T>
+bool proj_sum_terms(const Interval& y, const T& term, int n);
+
+/*@}*/
+
+/*================================== inline implementations ========================================*/
+
+namespace compensated {
+
+/* below this number of terms, the naive accumulation is used */
+const int MIN_TERMS = 3;
+
+/*
+ * Accumulator of floating-point numbers (see ibex_CompensatedArith.cpp
+ * for the error analysis).
+ *
+ * The "add" functions must be called in rounding-to-nearest mode,
+ * followed by close() before the rounding mode is changed.
+ * lower/upper can be called in any rounding mode.
+ *
+ * Infinite values are counted apart (they are not added).
+ */
+class Accumulator {
+public:
+	Accumulator() : s(0), err(0), abs(0), nb_terms(0), nb_tiny(0), nb_inf(0) { }
+
+	/* add a */
+	void add(double a) {
+		if (a==POS_INFINITY || a==NEG_INFINITY) { nb_inf++; return; }
+		// TwoSum
+		double t=s+a;
+		double z=t-s;
+		add_error((s-(t-z))+(a-z));
+		s=t;
+	}
+
+	/* add the product p+e (given by TwoProduct). If the error term e is not
+	 * exact, the error is bounded by tiny*2^-1012 and e is ignored. */
+	void add_prod(double p, double e, int tiny) {
+		add(p);
+		if (tiny) nb_tiny+=tiny;
+		else add_error(e);
+	}
+
+	/* Force the accumulation to be completed here. The compiler is allowed
+	 * to move floating-point operations across a change of the rounding mode
+	 * (even with -frounding-math), but not across a volatile access. */
+	void close() {
+		volatile double v;
+		v=s;   s=v;
+		v=err; err=v;
+		v=abs; abs=v;
+	}
+
+	/* true if no overflow occurred */
+	bool finite() const {
+		return s>NEG_INFINITY && s<POS_INFINITY && err>NEG_INFINITY && err<POS_INFINITY;
+	}
+
+	/* lower bound of the sum of the finite values */
+	double lower() const {
+		if (exact()) return s;
+		// each operation is rounded outward with previous_float/next_float,
+		// whatever the rounding mode is (the correction err-delta is
+		// bounded first so that only one ulp of s is lost)
+		return previous_float(s+previous_float(err-delta()));
+	}
+
+	/* upper bound of the sum of the finite values */
+	double upper() const {
+		if (exact()) return s;
+		return next_float(s+next_float(err+delta()));
+	}
+
+	int nb_infinite() const {
+		return nb_inf;
+	}
+
+private:
+	void add_error(double e) {
+		err+=e;
+		abs+=::fabs(e);
+		nb_terms++;
+	}
+
+	/* true if s is the exact sum */
+	bool exact() const {
+		return abs==0 && nb_tiny==0;
+	}
+
+	/* upper bound of the error, in any rounding mode */
+	double delta() const {
+		// 2^-53 and 2^-1012 (the products by integers are exact)
+		return next_float(next_float((2*(nb_terms+1)*1.1102230246251565e-16)*abs)+nb_tiny*2.2784756311113742e-305);
+	}
+
+	double s, err, abs;
+	int nb_terms, nb_tiny, nb_inf;
+};
+
+/*
+ * Calculate a lower bound L of the sum of the finite lower bounds
+ * of the terms and an upper bound U of the sum of the finite upper bounds.
+ * nl (resp. nu) is the number of infinite lower (resp. upper) bounds.
+ */
+template<class T>
+void sum_bounds(const T& term, int n, double& L, double& U, int& nl, int& nu) {
+	Accumulator l,u;
+	int mode=fegetround();
+
+	fpu_round_near();
+	for (int i=0; i<n; i++) {
+		const Interval& t=term(i);
+		l.add(t.lb());
+		u.add(t.ub());
+	}
+	l.close();
+	u.close();
+	fesetround(mode);
+	L=l.lower();
+	U=u.upper();
+
+	nl=l.nb_infinite();
+	nu=u.nb_infinite();
+
+	if (!l.finite() || !u.finite()) {
+		// overflow: naive accumulation
+		Interval sl(0), su(0);
+		for (int i=0; i<n; i++) {
+			const Interval& t=term(i);
+			if (t.lb()>NEG_INFINITY) sl+=t.lb();
+			if (t.ub()<POS_INFINITY) su+=t.ub();
+		}
+		L=sl.lb();
+		U=su.ub();
+	}
+}
+
+/*
+ * Bounds of the sum of all the terms but one, the bounds of
+ * which are tl and tu.
+ *
+ * tl must be greater or equal to the lower bound of the term
+ * accumulated in L, and tu lower or equal to its upper bound accumulated
+ * in U (e.g., for a product computed exactly in L and U, tl and tu are
+ * not the bounds of the interval product, which is rounded outward).
+ */
+inline Interval others(double L, double U, int nl, int nu, double tl, double tu) {
+	double ol, ou;
+	if (tl==NEG_INFINITY) ol = nl>1 ? NEG_INFINITY : L;
+	else                  ol = nl>0 ? NEG_INFINITY : (Interval(L)-tl).lb();
+	if (tu==POS_INFINITY) ou = nu>1 ? POS_INFINITY : U;
+	else                  ou = nu>0 ? POS_INFINITY : (Interval(U)-tu).ub();
+	return Interval(ol,ou);
+}
+
+} // end namespace compensated
+
+template<class T>
+Interval sum_terms(const T& term, int n) {
+	if (n<compensated::MIN_TERMS) {
+		Interval res(0);
+		for (int i=0; i<n; i++) res+=term(i);
+		return res;
+	}
+
+	for (int i=0; i<n; i++)
+		if (term(i).is_empty()) return Interval::EMPTY_SET;
+
+	double L,U;
+	int nl,nu;
+	compensated::sum_bounds(term,n,L,U,nl,nu);
+	return Interval(nl>0? NEG_INFINITY : L, nu>0? POS_INFINITY : U);
+}
+
+template<class T>
+bool proj_sum_terms(const Interval& y, const T& term, int n) {
+	bool empty=y.is_empty();
+	for (int i=0; !empty && i<n; i++)
+		empty=term(i).is_empty();
+
+	if (!empty) {
+		double L,U;
+		int nl,nu;
+		compensated::sum_bounds(term,n,L,U,nl,nu);
+
+		for (int i=0; !empty && i<n; i++) {
+			Interval& x=term(i);
+			// note: the bounds of x are read before x is contracted
+			empty = (x &= y-compensated::others(L,U,nl,nu,x.lb(),x.ub())).is_empty();
+		}
+	}
+
+	if (empty) {
+		for (int i=0; i<n; i++) term(i).set_empty();
+		return false;
+	}
+	return true;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_COMPENSATED_ARITH_H__
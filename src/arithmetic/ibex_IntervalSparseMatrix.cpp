@@ -0,0 +1,157 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_IntervalSparseMatrix.h"
+
+namespace ibex {
+
+IntervalSparseMatrix::IntervalSparseMatrix() : _nb_rows(0), _nb_cols(0), _row_start(new int[1]), _col(NULL), _val(NULL) {
+	_row_start[0]=0;
+}
+
+IntervalSparseMatrix::IntervalSparseMatrix(int m, int n, const int* row_start, const int* col, const Interval& x) :
+		_nb_rows(m), _nb_cols(n), _row_start(new int[m+1]) {
+	assert(row_start[0]==0);
+
+	for (int i=0; i<=m; i++) _row_start[i]=row_start[i];
+
+	int nnz=_row_start[m];
+	_col=new int[nnz];
+	_val=new Interval[nnz];
+
+	for (int i=0; i<m; i++)
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++) {
+			assert(col[k]>=0 && col[k]<n);
+			assert(k==_row_start[i] || col[k]>col[k-1]);
+			_col[k]=col[k];
+			_val[k]=x;
+		}
+}
+
+IntervalSparseMatrix::IntervalSparseMatrix(const IntervalMatrix& m) :
+		_nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()), _row_start(new int[m.nb_rows()+1]) {
+
+	int nnz=0;
+	for (int i=0; i<_nb_rows; i++)
+		for (int j=0; j<_nb_cols; j++)
+			if (m[i][j]!=Interval::ZERO) nnz++;
+
+	_col=new int[nnz];
+	_val=new Interval[nnz];
+
+	int k=0;
+	for (int i=0; i<_nb_rows; i++) {
+		_row_start[i]=k;
+		for (int j=0; j<_nb_cols; j++)
+			if (m[i][j]!=Interval::ZERO) {
+				_col[k]=j;
+				_val[k++]=m[i][j];
+			}
+	}
+	_row_start[_nb_rows]=k;
+}
+
+IntervalSparseMatrix::IntervalSparseMatrix(const IntervalSparseMatrix& m) :
+		_nb_rows(m._nb_rows), _nb_cols(m._nb_cols), _row_start(new int[m._nb_rows+1]) {
+
+	for (int i=0; i<=_nb_rows; i++) _row_start[i]=m._row_start[i];
+
+	int nnz=nb_nonzeros();
+	_col=new int[nnz];
+	_val=new Interval[nnz];
+	for (int k=0; k<nnz; k++) {
+		_col[k]=m._col[k];
+		_val[k]=m._val[k];
+	}
+}
+
+IntervalSparseMatrix::~IntervalSparseMatrix() {
+	delete[] _row_start;
+	delete[] _col;
+	delete[] _val;
+}
+
+IntervalSparseMatrix& IntervalSparseMatrix::operator=(const IntervalSparseMatrix& m) {
+	if (this==&m) return *this;
+
+	if (_nb_rows!=m._nb_rows || nb_nonzeros()!=m.nb_nonzeros()) {
+		delete[] _row_start;
+		delete[] _col;
+		delete[] _val;
+		_row_start=new int[m._nb_rows+1];
+		_col=new int[m.nb_nonzeros()];
+		_val=new Interval[m.nb_nonzeros()];
+	}
+
+	_nb_rows=m._nb_rows;
+	_nb_cols=m._nb_cols;
+	for (int i=0; i<=_nb_rows; i++) _row_start[i]=m._row_start[i];
+
+	int nnz=nb_nonzeros();
+	for (int k=0; k<nnz; k++) {
+		_col[k]=m._col[k];
+		_val[k]=m._val[k];
+	}
+	return *this;
+}
+
+int IntervalSparseMatrix::find(int i, int j) const {
+	assert(i>=0 && i<_nb_rows);
+	int lo=_row_start[i];
+	int hi=_row_start[i+1]-1;
+	while (lo<=hi) {
+		int k=(lo+hi)/2;
+		if (_col[k]==j) return k;
+		else if (_col[k]<j) lo=k+1;
+		else hi=k-1;
+	}
+	return -1;
+}
+
+void IntervalSparseMatrix::init(const Interval& x) {
+	int nnz=nb_nonzeros();
+	for (int k=0; k<nnz; k++) _val[k]=x;
+}
+
+bool IntervalSparseMatrix::is_empty() const {
+	int nnz=nb_nonzeros();
+	for (int k=0; k<nnz; k++)
+		if (_val[k].is_empty()) return true;
+	return false;
+}
+
+IntervalMatrix IntervalSparseMatrix::dense() const {
+	IntervalMatrix m(_nb_rows,_nb_cols,Interval::ZERO);
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++)
+			m[i][_col[k]]=_val[k];
+	return m;
+}
+
+IntervalVector operator*(const IntervalSparseMatrix& A, const IntervalVector& x) {
+	assert(A.nb_cols()==x.size());
+
+	IntervalVector y(A.nb_rows());
+
+	if (x.is_empty()) { y.set_empty(); return y; }
+
+	for (int i=0; i<A.nb_rows(); i++) {
+		y[i]=Interval::ZERO;
+		for (int k=A.row_begin(i); k<A.row_end(i); k++)
+			y[i]+=A.val(k)*x[A.col(k)];
+	}
+	return y;
+}
+
+std::ostream& operator<<(std::ostream& os, const IntervalSparseMatrix& A) {
+	return os << A.dense();
+}
+
+} // namespace ibex
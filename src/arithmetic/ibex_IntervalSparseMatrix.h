@@ -0,0 +1,208 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_INTERVAL_SPARSE_MATRIX_H__
+#define __IBEX_INTERVAL_SPARSE_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Sparse interval matrix.
+ *
+ * The matrix is stored in compressed sparse row (CSR) format: the
+ * (structurally) non-zero entries of row i are the entries k with
+ * row_begin(i) <= k < row_end(i); col(k) is the column index of
+ * the entry k and val(k) its value. In each row, the column indices
+ * are sorted in increasing order.
+ *
+ * Only the values can be modified once the matrix is built (the
+ * structure is fixed). An entry that is not stored is [0,0].
+ */
+class IntervalSparseMatrix {
+
+public:
+	/**
+	 * \brief Create a 0x0 matrix.
+	 */
+	IntervalSparseMatrix();
+
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix with a given structure.
+	 *
+	 * The column indices of the entries of row i are col[row_start[i]],...,col[row_start[i+1]-1]
+	 * (they must be sorted in increasing order). All the values are initialized to \a x.
+	 *
+	 * \param row_start - array of nb_rows+1 integers (row_start[0] must be 0).
+	 * \param col       - array of row_start[nb_rows] integers.
+	 */
+	IntervalSparseMatrix(int nb_rows, int nb_cols, const int* row_start, const int* col, const Interval& x=Interval::ZERO);
+
+	/**
+	 * \brief Create a sparse matrix from a dense one.
+	 *
+	 * Only the entries different from [0,0] are stored.
+	 */
+	explicit IntervalSparseMatrix(const IntervalMatrix& m);
+
+	/**
+	 * \brief Duplicate a matrix.
+	 */
+	IntervalSparseMatrix(const IntervalSparseMatrix& m);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~IntervalSparseMatrix();
+
+	/**
+	 * \brief Set *this to m (structure and values).
+	 */
+	IntervalSparseMatrix& operator=(const IntervalSparseMatrix& m);
+
+	/**
+	 * \brief Return the number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Return the number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Return the number of stored entries.
+	 */
+	int nb_nonzeros() const;
+
+	/**
+	 * \brief Index of the first entry of the ith row.
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Index of the entry following the last entry of the ith row.
+	 */
+	int row_end(int i) const;
+
+	/**
+	 * \brief Column of the kth entry.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief Value of the kth entry.
+	 */
+	Interval& val(int k);
+
+	/**
+	 * \brief Value of the kth entry (const version).
+	 */
+	const Interval& val(int k) const;
+
+	/**
+	 * \brief Return the index of the entry (i,j), or -1 if (i,j) is not stored.
+	 *
+	 * Complexity: logarithmic in the number of entries of the ith row.
+	 */
+	int find(int i, int j) const;
+
+	/**
+	 * \brief Return the entry (i,j) ([0,0] if it is not stored).
+	 */
+	Interval operator()(int i, int j) const;
+
+	/**
+	 * \brief Set all the stored values to x.
+	 */
+	void init(const Interval& x);
+
+	/**
+	 * \brief True if one of the stored values is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Return the dense matrix.
+	 */
+	IntervalMatrix dense() const;
+
+private:
+	int _nb_rows;
+	int _nb_cols;
+	int* _row_start;  // nb_rows+1 indices
+	int* _col;        // nb_nonzeros column indices
+	Interval* _val;   // nb_nonzeros values
+};
+
+/**
+ * \brief Return A*x.
+ *
+ * Complexity: linear in the number of stored entries.
+ */
+IntervalVector operator*(const IntervalSparseMatrix& A, const IntervalVector& x);
+
+/**
+ * \brief Display the (dense) matrix.
+ */
+std::ostream& operator<<(std::ostream& os, const IntervalSparseMatrix& A);
+
+/*================================== inline implementations ========================================*/
+
+inline int IntervalSparseMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int IntervalSparseMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int IntervalSparseMatrix::nb_nonzeros() const {
+	return _row_start[_nb_rows];
+}
+
+inline int IntervalSparseMatrix::row_begin(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row_start[i];
+}
+
+inline int IntervalSparseMatrix::row_end(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row_start[i+1];
+}
+
+inline int IntervalSparseMatrix::col(int k) const {
+	assert(k>=0 && k<nb_nonzeros());
+	return _col[k];
+}
+
+inline Interval& IntervalSparseMatrix::val(int k) {
+	assert(k>=0 && k<nb_nonzeros());
+	return _val[k];
+}
+
+inline const Interval& IntervalSparseMatrix::val(int k) const {
+	assert(k>=0 && k<nb_nonzeros());
+	return _val[k];
+}
+
+inline Interval IntervalSparseMatrix::operator()(int i, int j) const {
+	int k=find(i,j);
+	return k==-1 ? Interval::ZERO : _val[k];
+}
+
+} // namespace ibex
+
+#endif // __IBEX_INTERVAL_SPARSE_MATRIX_H__
@@ -16,6 +16,7 @@
 #include <math.h>
 #include <float.h>
 #include <algorithm>
+#include "ibex_CompensatedArith.h"
 
 
 #include "ibex_TemplateVector.cpp_"
@@ -280,29 +281,8 @@ bool proj_mul(const Interval& z, IntervalVector& x, IntervalVector& y) {
 		else { x.set_empty(); y.set_empty(); return false; }
 	}
 
-	Interval* xy= new Interval[n];  // xy[i] := x[i]y[i]
-	Interval* sum= new Interval[n-1]; // sum[i] := x[0]y[0]+...x[i]y[i]
-
-	// ------------- forward --------------------
-	for (int i=0; i<n; i++) xy[i]=x[i]*y[i];
-	sum[0]=xy[0];
-	for (int i=1; i<n-1; i++) sum[i]=sum[i-1]+xy[i];
-
-	// ------------- backward -------------------
-	// (rem: we have n>=2)
-	if (!proj_add(z, sum[n-2], xy[n-1])) { x.set_empty(); y.set_empty(); delete[] sum; delete[] xy; return false; }
-
-	for (int i=n-3; i>=0; i--)
-		if (!proj_add(sum[i+1],sum[i],xy[i+1])) { x.set_empty(); y.set_empty(); delete[] sum; delete[] xy; return false; }
-
-	if ((xy[0] &= sum[0]).is_empty()) { x.set_empty(); y.set_empty(); delete[] sum; delete[] xy; return false; }
-
-	for (int i=0; i<n; i++)
-		if (!proj_mul(xy[i],x[i],y[i])) { x.set_empty(); y.set_empty(); delete[] sum; delete[] xy; return false; }
-
-	delete[] sum; 
-	delete[] xy;
-	return true;
+	// x and y are contracted in O(n), without memory allocation
+	return proj_dot(z,&x[0],&y[0],n);
 }
 
 
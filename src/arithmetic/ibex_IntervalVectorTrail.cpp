@@ -0,0 +1,102 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_IntervalVectorTrail.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_IntervalVectorTrail.h"
+
+namespace ibex {
+
+IntervalVectorTrail::IntervalVectorTrail(IntervalVector& box) : _box(&box), saved(box.size(),-1), next_stamp(0) {
+
+}
+
+IntervalVectorTrail::IntervalVectorTrail(int n) : _box(NULL), saved(n,-1), next_stamp(0) {
+
+}
+
+void IntervalVectorTrail::reset(IntervalVector& box) {
+	assert(box.size()==(int) saved.size());
+	_box=&box;
+	vars.clear();
+	values.clear();
+	marks.clear();
+	stamps.clear();
+	// the stamps of the components saved for the previous box are all smaller
+	// than next_stamp: they will not be confused with the next ones.
+}
+
+void IntervalVectorTrail::new_stamp() {
+	stamps.back()=next_stamp++;
+	save(0); // may be modified by IntervalVector::set_empty()
+}
+
+void IntervalVectorTrail::checkpoint() {
+	assert(_box);
+	marks.push_back(vars.size());
+	stamps.push_back(-1);
+	new_stamp();
+}
+
+void IntervalVectorTrail::undo() {
+	assert(!marks.empty());
+	int mark=marks.back();
+	// in reverse order (a component may have been saved
+	// several times, by nested checkpoints)
+	for (int k=vars.size()-1; k>=mark; k--)
+		(*_box)[vars[k]]=values[k];
+	vars.resize(mark);
+	values.resize(mark);
+	new_stamp();
+}
+
+void IntervalVectorTrail::commit() {
+	assert(!marks.empty());
+	int mark=marks.back();
+	marks.pop_back();
+	stamps.pop_back();
+	if (marks.empty()) {
+		vars.clear();
+		values.clear();
+		return;
+	}
+
+	// The saves of the removed checkpoint now belong to the previous one.
+	// The components already saved at the previous level are dropped
+	// (their values at the previous checkpoint are already recorded).
+	int stamp=stamps.back();
+	for (int k=marks.back(); k<mark; k++)
+		saved[vars[k]]=stamp; // may have been overwritten by the removed checkpoint
+	int j=mark;
+	for (unsigned int k=mark; k<vars.size(); k++) {
+		int i=vars[k];
+		if (saved[i]!=stamp) {
+			saved[i]=stamp;
+			vars[j]=i;
+			values[j]=values[k];
+			j++;
+		}
+	}
+	vars.resize(j);
+	values.resize(j);
+}
+
+void IntervalVectorTrail::backtrack() {
+	undo();
+	commit();
+}
+
+double IntervalVectorTrail::rel_distance() const {
+	double max=0;
+	for (int k=0; k<nb_saved(); k++) {
+		double cand=saved_value(k).rel_distance((*_box)[saved_var(k)]);
+		if (max<cand) max=cand;
+	}
+	return max;
+}
+
+} // end namespace ibex
@@ -0,0 +1,198 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_IntervalVectorTrail.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_INTERVAL_VECTOR_TRAIL_H__
+#define __IBEX_INTERVAL_VECTOR_TRAIL_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Trail of the modifications of a box.
+ *
+ * A trail allows to roll back the tentative modifications of a box
+ * (e.g., the contraction of a slice in a shaving) in a time proportional
+ * to the number of modified components, instead of copying the whole box.
+ *
+ * The old value of a component must be saved (see #save(int)) before it is
+ * modified. Only the first save of a component at a given checkpoint level
+ * is recorded. Typically, the components saved before calling a contractor
+ * are its output variables (see #ibex::Ctc::output).
+ *
+ * Checkpoints can be nested. #undo() restores the box as it was
+ * when the last checkpoint was set, and #commit() removes the last checkpoint
+ * but keeps the modifications (they can still be undone by a previous checkpoint).
+ *
+ * Since IntervalVector::set_empty() only modifies the first component, this
+ * component is always saved when a checkpoint is set.
+ *
+ * A trail can be reused for other boxes of the same size (see #reset(IntervalVector&)),
+ * which avoids allocating its data at each use (e.g., in a contractor).
+ *
+ * Example:
+ * <pre>
+ *   IntervalVectorTrail trail(box);
+ *   trail.checkpoint();
+ *   for (...) {
+ *     trail.save(vars);  // the variables modified by ctc
+ *     try { ctc.contract(box); ... } catch (EmptyBoxException&) { }
+ *     trail.undo();      // box is restored
+ *   }
+ *   trail.commit();
+ * </pre>
+ */
+class IntervalVectorTrail {
+public:
+	/**
+	 * \brief Create a trail for \a box, with no checkpoint.
+	 *
+	 * The box is referenced (not copied) and its size must not change.
+	 */
+	IntervalVectorTrail(IntervalVector& box);
+
+	/**
+	 * \brief Create a trail for boxes of size \a n, with no box.
+	 *
+	 * A box must be set with #reset(IntervalVector&) before the first checkpoint.
+	 */
+	explicit IntervalVectorTrail(int n);
+
+	/**
+	 * \brief Use the trail for \a box and remove all the checkpoints.
+	 *
+	 * The modifications of the previous box are kept. This operation
+	 * does not depend on the size of the box.
+	 *
+	 * \pre the size of \a box is the size of the trail.
+	 */
+	void reset(IntervalVector& box);
+
+	/**
+	 * \brief Set a new checkpoint.
+	 */
+	void checkpoint();
+
+	/**
+	 * \brief Save the ith component of the box (if not already saved at the current level).
+	 *
+	 * \pre a checkpoint is set.
+	 */
+	void save(int i);
+
+	/**
+	 * \brief Save the components of the box listed in \a vars.
+	 */
+	void save(const std::vector<int>& vars);
+
+	/**
+	 * \brief Restore the box as it was at the last checkpoint.
+	 *
+	 * The checkpoint remains set.
+	 */
+	void undo();
+
+	/**
+	 * \brief Remove the last checkpoint, keeping the modifications.
+	 */
+	void commit();
+
+	/**
+	 * \brief Restore the box as it was at the last checkpoint and remove this checkpoint.
+	 */
+	void backtrack();
+
+	/**
+	 * \brief Number of checkpoints set.
+	 */
+	int level() const;
+
+	/**
+	 * \brief Number of components saved since the last checkpoint.
+	 */
+	int nb_saved() const;
+
+	/**
+	 * \brief Index of the kth component saved since the last checkpoint.
+	 */
+	int saved_var(int k) const;
+
+	/**
+	 * \brief Value at the last checkpoint of the kth component saved since this checkpoint.
+	 */
+	const Interval& saved_value(int k) const;
+
+	/**
+	 * \brief Relative distance between the box and the box at the last checkpoint.
+	 *
+	 * Same as IntervalVector::rel_distance, but only the saved components are considered.
+	 */
+	double rel_distance() const;
+
+	/**
+	 * \brief The box.
+	 */
+	IntervalVector& box() const;
+
+protected:
+	/* Start a new "stamp" for the current level (the saves of the previous ones are forgotten) */
+	void new_stamp();
+
+	IntervalVector* _box;         // the current box
+	std::vector<int> vars;        // indices of the saved components
+	std::vector<Interval> values; // old values of the saved components
+	std::vector<int> marks;       // position in vars/values of each checkpoint
+	std::vector<int> stamps;      // stamp of each checkpoint
+	std::vector<int> saved;       // stamp of the last save of each component
+	int next_stamp;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void IntervalVectorTrail::save(int i) {
+	assert(!marks.empty());
+	if (saved[i]!=stamps.back()) {
+		saved[i]=stamps.back();
+		vars.push_back(i);
+		values.push_back((*_box)[i]);
+	}
+}
+
+inline void IntervalVectorTrail::save(const std::vector<int>& v) {
+	for (unsigned int k=0; k<v.size(); k++)
+		save(v[k]);
+}
+
+inline IntervalVector& IntervalVectorTrail::box() const {
+	assert(_box);
+	return *_box;
+}
+
+inline int IntervalVectorTrail::level() const {
+	return marks.size();
+}
+
+inline int IntervalVectorTrail::nb_saved() const {
+	return marks.empty()? 0 : vars.size()-marks.back();
+}
+
+inline int IntervalVectorTrail::saved_var(int k) const {
+	return vars[marks.back()+k];
+}
+
+inline const Interval& IntervalVectorTrail::saved_value(int k) const {
+	return values[marks.back()+k];
+}
+
+} // end namespace ibex
+#endif // __IBEX_INTERVAL_VECTOR_TRAIL_H__
@@ -11,6 +11,7 @@
 
 #include "ibex_Affine2Matrix.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_CompensatedArith.h"
 
 namespace ibex {
 
@@ -472,15 +473,19 @@ double operator*(const Vector& v1, const Vector& v2) {
 }
 
 Interval operator*(const Vector& v1, const IntervalVector& v2) {
-	return mulVV<Vector,IntervalVector,Interval>(v1,v2);
+	assert(v1.size()==v2.size());
+	if (v2.is_empty()) return Interval::EMPTY_SET;
+	return dot(&v1[0],&v2[0],v1.size());
 }
 
 Interval operator*(const IntervalVector& v1, const Vector& v2) {
-	return mulVV<IntervalVector,Vector,Interval>(v1,v2);
+	return v2*v1;
 }
 
 Interval operator*(const IntervalVector& v1, const IntervalVector& v2) {
-	return mulVV<IntervalVector,IntervalVector,Interval>(v1,v2);
+	assert(v1.size()==v2.size());
+	if (v1.is_empty() || v2.is_empty()) return Interval::EMPTY_SET;
+	return dot(&v1[0],&v2[0],v1.size());
 }
 
 Matrix outer_product(const Vector& v1, const Vector& v2) {
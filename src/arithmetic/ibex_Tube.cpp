@@ -11,6 +11,7 @@
 
 
 #include "ibex_Tube.h"
+#include "ibex_BatchEval.h"
 #include "assert.h"
 
 namespace ibex {
@@ -246,28 +247,29 @@ Tube& Tube::ctcInf(const Tube& x){
 }
 
 
-Tube& Tube::ctcFwd(const Function& f) {
+IntervalVector Tube::eval_slices(const Function& f) const {
 	assert((f.nb_var()==1)&&(f.nb_arg()==1));
-	IntervalVector lx(1);
-	IntervalVector ux(1);
+	IntervalMatrix slices(size(),1);
+	for(int i=0;i<size();i++)
+		slices[i][0]=Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
+	// all the time slices are evaluated at once
+	return BatchEval(f).eval(slices);
+}
+
+Tube& Tube::ctcFwd(const Function& f) {
+	IntervalVector fx=eval_slices(f);
 	for(int i=0;i<(*this).size()-1;i++){
-		lx[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
-		ux[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
 // Euler formulation  TODO replace it by RK4 or VNODES
-		(*this)[i+1] &=(*this)[i]+Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
+		(*this)[i+1] &=(*this)[i]+fx[i]*_deltaT;
 	}
 	return *this;
 }
 
 Tube& Tube::ctcBwd(const Function& f) {
-	assert((f.nb_var()==1)&&(f.nb_arg()==1));
-	IntervalVector lx(1);
-	IntervalVector ux(1);
+	IntervalVector fx=eval_slices(f);
 	for(int i=(*this).size()-1;i>=1;i--){
-		lx[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
-		ux[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
 // Euler formulation  TODO replace it by RK4 or VNODES
-		(*this)[i-1] &= (*this)[i]-Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
+		(*this)[i-1] &= (*this)[i]-fx[i]*_deltaT;
 	}
 	return *this;
 }
@@ -15,6 +15,7 @@
 #include <cassert>
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
+#include "ibex_BatchArith.h"
 #include "ibex_Function.h"
 
 
@@ -33,6 +34,12 @@ private:
 	double 			_tf;
 	double 			_deltaT;
 
+	/*
+	 * Image by f of all the time slices [t0+i*deltaT,t0+(i+1)*deltaT]
+	 * (evaluated in a single batch).
+	 */
+	IntervalVector eval_slices(const Function& f) const;
+
 public:
 
 	/**
@@ -711,21 +718,31 @@ inline Tube operator/(const Interval& x1, const Tube& x2) {
 		for (int i=0;i<x.size();i++) {vec[i]=f(x[i],p);} \
 		return Tube(x.get_t0(),x.get_tF(),x.get_delta_t(),vec);
 
+#define func_batch_unary_tube(f) \
+		IntervalVector vec(x.size()); \
+		f(&x[0],&vec[0],x.size()); \
+		return Tube(x.get_t0(),x.get_tF(),x.get_delta_t(),vec);
+
+#define func_batch_binary_tube(f) \
+		IntervalVector vec(x.size()); \
+		f(&x[0],p,&vec[0],x.size()); \
+		return Tube(x.get_t0(),x.get_tF(),x.get_delta_t(),vec);
+
 inline Tube abs(const Tube& x)           { func_unary_tube(abs) }
 inline Tube sqr(const Tube& x)           { func_unary_tube(sqr) }
 inline Tube sqrt(const Tube& x)          { func_unary_tube(sqrt)}
 inline Tube pow(const Tube& x, int p)    { func_binary_tube(pow) }
-inline Tube pow(const Tube& x, double p) { func_binary_tube(pow) }
-inline Tube pow(const Tube &x, const Interval &p) { func_binary_tube(pow) }
+inline Tube pow(const Tube& x, double p) { func_batch_binary_tube(batch_pow) }
+inline Tube pow(const Tube &x, const Interval &p) { func_batch_binary_tube(batch_pow) }
 inline Tube root(const Tube& x, int p)   { func_binary_tube(root) }
-inline Tube exp(const Tube& x)           { func_unary_tube(exp) }
-inline Tube log(const Tube& x)           { func_unary_tube(log) }
-inline Tube cos(const Tube& x)           { func_unary_tube(cos) }
-inline Tube sin(const Tube& x)           { func_unary_tube(sin) }
+inline Tube exp(const Tube& x)           { func_batch_unary_tube(batch_exp) }
+inline Tube log(const Tube& x)           { func_batch_unary_tube(batch_log) }
+inline Tube cos(const Tube& x)           { func_batch_unary_tube(batch_cos) }
+inline Tube sin(const Tube& x)           { func_batch_unary_tube(batch_sin) }
 inline Tube tan(const Tube& x)           { func_unary_tube(tan) }
 inline Tube acos(const Tube& x)          { func_unary_tube(acos) }
 inline Tube asin(const Tube& x)          { func_unary_tube(asin) }
-inline Tube atan(const Tube& x)          { func_unary_tube(atan) }
+inline Tube atan(const Tube& x)          { func_batch_unary_tube(batch_atan) }
 inline Tube cosh(const Tube& x)          { func_unary_tube(cosh) }
 inline Tube sinh(const Tube& x)          { func_unary_tube(sinh) }
 inline Tube tanh(const Tube& x)          { func_unary_tube(tanh) }
@@ -10,11 +10,24 @@
 
 #include "ibex_QInter.h"
 #include <algorithm>
+#include <vector>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/* An event of the sweep line: a bound and +1 (lower bound) or -1 (upper bound).
+ * With equal bounds, the lower bounds come first (the intervals are closed). */
+typedef pair<double,int> event;
+
+bool event_before(const event& e1, const event& e2) {
+	return e1.first<e2.first || (e1.first==e2.first && e1.second>e2.second);
+}
+
+}
+
 IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 	assert(_boxes.size()>0);
 	int n=_boxes[0].size();
@@ -156,4 +169,81 @@ IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 	return inner_box;
 }
 
+IntervalVector qinter_projf(const Array<IntervalVector>& boxes, int q) {
+	assert(boxes.size()>0);
+	int n=boxes[0].size();
+	int p=boxes.size();
+
+	// the boxes that still intersect the result
+	vector<bool> active(p);
+	int nb_active=0;
+	for (int j=0; j<p; j++) {
+		active[j]=!boxes[j].is_empty();
+		if (active[j]) nb_active++;
+	}
+
+	IntervalVector hull(n); // the result (all the space initially)
+
+	vector<event> events;
+	events.reserve(2*p);
+
+	bool fixpoint=false;
+
+	while (!fixpoint) {
+
+		if (nb_active<q) return IntervalVector::empty(n);
+
+		fixpoint=true;
+
+		for (int d=0; d<n; d++) {
+			events.clear();
+			for (int j=0; j<p; j++) {
+				if (!active[j]) continue;
+				Interval xj=boxes[j][d] & hull[d];
+				if (xj.is_empty()) continue;
+				events.push_back(event(xj.lb(),1));
+				events.push_back(event(xj.ub(),-1));
+			}
+
+			sort(events.begin(),events.end(),event_before);
+
+			// the first and the last points that belong to at least q intervals
+			double lb=POS_INFINITY;
+			double ub=NEG_INFINITY;
+			int count=0;
+			for (vector<event>::const_iterator it=events.begin(); it!=events.end(); it++) {
+				if (it->second>0) {
+					if (++count>=q && lb==POS_INFINITY) lb=it->first;
+				} else {
+					if (count>=q) ub=it->first;
+					count--;
+				}
+			}
+
+			if (lb==POS_INFINITY) return IntervalVector::empty(n);
+
+			if (hull[d].lb()!=lb || hull[d].ub()!=ub) {
+				hull[d]=Interval(lb,ub);
+				fixpoint=false;
+			}
+		}
+
+		if (!fixpoint) {
+			// remove the boxes that do not intersect the result anymore
+			for (int j=0; j<p; j++) {
+				if (!active[j]) continue;
+				for (int d=0; d<n; d++) {
+					if (boxes[j][d].is_disjoint(hull[d])) {
+						active[j]=false;
+						nb_active--;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	return hull;
+}
+
 } // end namespace ibex
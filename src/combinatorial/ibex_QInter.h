@@ -23,8 +23,26 @@ namespace ibex {
 /**
  * \ingroup combinatorial
  * \brief Q-intersection.
+ *
+ * Return the hull of the set of points that belong to at least q boxes.
+ * The algorithm sweeps a grid of up to (2p-1)^n cells (where p is the number of non-empty boxes):
+ * it is exponential in the dimension n.
  */
 IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
 
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection by projections.
+ *
+ * Return a box that encloses the q-intersection (the result may not be the hull).
+ *
+ * In each dimension, the projection of the q-intersection is enclosed by the hull of the points
+ * that belong to at least q intervals (the projections of the boxes): this hull is computed by a sweep line
+ * in O(p log p). The boxes that do not intersect the resulting box are removed and the other ones are
+ * intersected with it, which can reduce the projections again: the process is repeated until a fixpoint
+ * is reached. The overall complexity is polynomial in n and p.
+ */
+IntervalVector qinter_projf(const Array<IntervalVector>& boxes, int q);
+
 } // end namespace ibex
 #endif // __IBEX_Q_INTER_H__
@@ -13,13 +13,106 @@
 
 namespace ibex {
 
-Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL), _impact(NULL), _output_flags(NULL) {
+Ctc::Ctc(int n) : nb_var(n), input(NULL), output(NULL), _cell(NULL), _impact(NULL), _output_flags(NULL) {
 
 }
 
 Ctc::~Ctc() {
 }
 
+void Ctc::add_backtrackable(Cell& root) {
+
+}
+
+void Ctc::contract(Cell& c) {
+	_cell = &c;
+
+	try {
+		contract(c.box);
+	}
+	catch(EmptyBoxException& e) {
+		_cell = NULL;
+		throw e;
+	}
+
+	_cell = NULL;
+}
+
+void Ctc::contract(Cell& c, const BoolMask& impact) {
+	_cell = &c;
+
+	try {
+		contract(c.box, impact);
+	}
+	catch(EmptyBoxException& e) {
+		_cell = NULL;
+		throw e;
+	}
+
+	_cell = NULL;
+}
+
+void Ctc::subcontract(Ctc& c, IntervalVector& box) {
+	Cell* old_cell = c._cell;
+	c._cell = _cell;
+
+	try {
+		c.contract(box);
+	}
+	catch(EmptyBoxException& e) {
+		c._cell = old_cell;
+		throw e;
+	}
+
+	c._cell = old_cell;
+}
+
+void Ctc::subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact) {
+	Cell* old_cell = c._cell;
+	c._cell = _cell;
+
+	try {
+		c.contract(box, impact);
+	}
+	catch(EmptyBoxException& e) {
+		c._cell = old_cell;
+		throw e;
+	}
+
+	c._cell = old_cell;
+}
+
+void Ctc::subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact, BoolMask& flags) {
+	Cell* old_cell = c._cell;
+	c._cell = _cell;
+
+	try {
+		c.contract(box, impact, flags);
+	}
+	catch(EmptyBoxException& e) {
+		c._cell = old_cell;
+		throw e;
+	}
+
+	c._cell = old_cell;
+}
+
+bool Ctc::try_subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact) {
+	Cell* old_cell = c._cell;
+	c._cell = _cell;
+	bool ok=c.try_contract(box, impact);
+	c._cell = old_cell;
+	return ok;
+}
+
+bool Ctc::try_subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact, BoolMask& flags) {
+	Cell* old_cell = c._cell;
+	c._cell = _cell;
+	bool ok=c.try_contract(box, impact, flags);
+	c._cell = old_cell;
+	return ok;
+}
+
 void Ctc::contract(IntervalVector& box, const BoolMask& impact) {
 	_impact = &impact;
 
@@ -54,4 +147,35 @@ void Ctc::contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags)
 	_output_flags = NULL;
 }
 
+bool Ctc::try_contract(IntervalVector& box) {
+	try {
+		contract(box);
+	}
+	catch(EmptyBoxException&) {
+		box.set_empty();
+		return false;
+	}
+	return true;
+}
+
+bool Ctc::try_contract(IntervalVector& box, const BoolMask& impact) {
+	_impact = &impact;
+	bool ok=try_contract(box);
+	_impact = NULL;
+	return ok;
+}
+
+bool Ctc::try_contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags) {
+	_impact = &impact;
+	_output_flags = &flags;
+
+	flags.unset_all();
+
+	bool ok=try_contract(box);
+
+	_impact = NULL;
+	_output_flags = NULL;
+	return ok;
+}
+
 } // namespace ibex
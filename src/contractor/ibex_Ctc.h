@@ -65,6 +65,65 @@ public:
 	 */
 	void contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags);
 
+	/**
+	 * \brief Contraction without EmptyBoxException.
+	 *
+	 * Same as #contract(IntervalVector&) except that an empty result is
+	 * not signaled by an EmptyBoxException: the box is set to the empty set
+	 * and false is returned. This avoids the cost of an exception when many boxes
+	 * are expected to be infeasible (e.g., the slices of a shaving).
+	 *
+	 * By default, this function calls contract(box) and catches the exception.
+	 * It is overridden by the contractors that can detect emptiness without
+	 * throwing an exception.
+	 *
+	 * \return false iff the box is empty.
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
+	/**
+	 * \brief Contraction without EmptyBoxException, with specified impact.
+	 *
+	 * \see #try_contract(IntervalVector&).
+	 * \see #contract(IntervalVector&, const BoolMask&).
+	 */
+	bool try_contract(IntervalVector& box, const BoolMask& impact);
+
+	/**
+	 * \brief Contraction without EmptyBoxException, with specified impact and output flags.
+	 *
+	 * \see #try_contract(IntervalVector&).
+	 * \see #contract(IntervalVector&, const BoolMask&, BoolMask&).
+	 */
+	bool try_contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags);
+
+	/**
+	 * \brief Add the backtrackable data required by this contractor to the root cell.
+	 *
+	 * By default, does nothing.
+	 *
+	 * \see #contract(Cell&).
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Contraction of the box of a cell.
+	 *
+	 * The contractor can read and update its backtrackable data
+	 * in the cell (see #cell()). By default, this function calls contract(cell.box).
+	 *
+	 * \see #add_backtrackable(Cell&).
+	 */
+	void contract(Cell& cell);
+
+	/**
+	 * \brief Contraction of the box of a cell with specified impact.
+	 *
+	 * \see #contract(Cell&).
+	 * \see #contract(IntervalVector&, const BoolMask&).
+	 */
+	void contract(Cell& cell, const BoolMask& impact);
+
 	/**
 	 * \brief The number of variables this contractor works with.
 	 */
@@ -107,7 +166,51 @@ protected:
 	 */
 	void set_flag(unsigned int);
 
+	/**
+	 * \brief Return the current cell (NULL pointer if none).
+	 *
+	 * The cell is only known when the contractor is called via #contract(Cell&)
+	 * or by a composite contractor (see #subcontract(Ctc&, IntervalVector&)).
+	 */
+	Cell* cell();
+
+	/**
+	 * \brief Call c.contract(box), where c is a sub-contractor of this contractor.
+	 *
+	 * The current cell (if any) is transmitted to \a c.
+	 */
+	void subcontract(Ctc& c, IntervalVector& box);
+
+	/**
+	 * \brief Call c.contract(box,impact), where c is a sub-contractor of this contractor.
+	 *
+	 * The current cell (if any) is transmitted to \a c.
+	 */
+	void subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact);
+
+	/**
+	 * \brief Call c.contract(box,impact,flags), where c is a sub-contractor of this contractor.
+	 *
+	 * The current cell (if any) is transmitted to \a c.
+	 */
+	void subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact, BoolMask& flags);
+
+	/**
+	 * \brief Call c.try_contract(box,impact), where c is a sub-contractor of this contractor.
+	 *
+	 * The current cell (if any) is transmitted to \a c.
+	 */
+	bool try_subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact);
+
+	/**
+	 * \brief Call c.try_contract(box,impact,flags), where c is a sub-contractor of this contractor.
+	 *
+	 * The current cell (if any) is transmitted to \a c.
+	 */
+	bool try_subcontract(Ctc& c, IntervalVector& box, const BoolMask& impact, BoolMask& flags);
+
 private:
+	Cell* _cell;
 	const BoolMask* _impact;
 	BoolMask* _output_flags;
 };
@@ -126,6 +229,10 @@ inline void Ctc::set_flag(unsigned int f) {
 	if (_output_flags) (*_output_flags)[f]=true;
 }
 
+inline Cell* Ctc::cell() {
+	return _cell;
+}
+
 } // namespace ibex
 
 #endif // __IBEX_CONTRACTOR_H__
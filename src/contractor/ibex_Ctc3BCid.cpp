@@ -10,6 +10,8 @@
 //============================================================================
 
 #include "ibex_Ctc3BCid.h"
+#include "ibex_Entailment.h"
+#include <vector>
 
 namespace ibex {
 
@@ -21,18 +23,42 @@ const int Ctc3BCid::LimitCIDDichotomy=16;
 Ctc3BCid::Ctc3BCid(const BoolMask& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
 					Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), s3b(s3b), scid(scid),
 					vhandled(vhandled<=0? cid_vars.nb_set():vhandled),
-					var_min_width(var_min_width), start_var(0), impact(ctc.nb_var) {
-
+					var_min_width(var_min_width), start_var(0), impact(ctc.nb_var),
+					main_trail(ctc.nb_var), right_trail(ctc.nb_var) {
+	init();
 }
 
 Ctc3BCid::Ctc3BCid( Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
   Ctc(ctc.nb_var), cid_vars(BoolMask(ctc.nb_var,1)), ctc(ctc), s3b(s3b), scid(scid),
 					vhandled(vhandled<=0? cid_vars.nb_set():vhandled),
-					var_min_width(var_min_width), start_var(0), impact(ctc.nb_var) {
+					var_min_width(var_min_width), start_var(0), impact(ctc.nb_var),
+					main_trail(ctc.nb_var), right_trail(ctc.nb_var) {
+	init();
+}
+
+void Ctc3BCid::init() {
+	nb_slices = 0;
+	nb_refuted = 0;
+	for (int j=0; j<nb_var; j++)
+		if (!ctc.output || (*ctc.output)[j]) ctc_output.push_back(j);
+}
 
+void Ctc3BCid::save(IntervalVectorTrail& trail, int var) const {
+	trail.save(var);
+	trail.save(ctc_output);                            // the first variable (set by IntervalVector::set_empty() on a
+	                                                   // refuted slice) is always saved by the trail
 }
 
 
+void Ctc3BCid::set_workers(const Array<Ctc>& w) {
+	workers.clear();
+	workers.resize(w.size()>1? w.size() : 0);
+	for (int i=0; i<workers.size(); i++) {
+		assert(w[i].nb_var==nb_var);
+		workers.set_ref(i,w[i]);
+	}
+}
+
 /* compare the boxes in all dimensions except one (var) */
 bool  Ctc3BCid::equalBoxes (int var, IntervalVector &box1, IntervalVector &box2) {
 	int nb_var = box1.size();
@@ -64,8 +90,29 @@ void Ctc3BCid::contract(IntervalVector& box) {
 }
 
 
+void Ctc3BCid::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
 bool Ctc3BCid::var3BCID(IntervalVector& box, int var) {
 
+	// The slices are contracted with the cell (the constraints entailed
+	// in the cell are skipped) but an entailment proven on a slice is not
+	// valid for the whole cell.
+	Entailment* entailment=NULL;
+	if (cell() && cell()->has<Entailment>()) {
+		entailment=&cell()->get<Entailment>();
+		entailment->start_trial();
+	}
+
+	bool r=var3BCID_shave(box, var);                   // no EmptyBoxException (the box is emptied)
+
+	if (entailment) entailment->end_trial();
+	return r;
+}
+
+bool Ctc3BCid::var3BCID_shave(IntervalVector& box, int var) {
+
 	Interval& dom(box[var]);
 
 	if (dom.diam() < var_min_width) return false;      // domain already small enough : nothing to do
@@ -90,35 +137,41 @@ bool Ctc3BCid::var3BCID(IntervalVector& box, int var) {
 }
 
 bool Ctc3BCid::var3BCID_dicho(IntervalVector& box, int var, double w3b) {
-	IntervalVector initbox = box;
+	if (workers.size()>1) return parallel_var3BCID_dicho(box, var, w3b);
 
-	bool r0= shave_bound_dicho(box, var, w3b, true);    // left shaving , after box contains the left slide
+	IntervalVectorTrail& trail(main_trail);            // records the initial domains of the modified variables
+	trail.reset(box);
+	trail.checkpoint();
+	double sup0 = box[var].ub();
 
-	if (box[var].ub() == initbox[var].ub())
+	bool r0= shave_bound_dicho(ctc, trail, var, w3b, true); // left shaving , after box contains the left slide
+
+	if (box.is_empty())
+		return true;                                   // the whole domain is refuted
+
+	if (box[var].ub() == sup0)
 		return true;                                   // the left slide reaches the right bound : nothing more to do
 
 	IntervalVector leftbox=box;
-	box=initbox;
-	box[var]= Interval(leftbox[var].lb(),initbox[var].ub());
-	bool r1=false;
-	try {
-		r1= shave_bound_dicho (box, var,  w3b, false); // may throw EmptyBoxException
-	}
-	catch (EmptyBoxException& e) {
-		box=leftbox; return true;                      // in case of EmptyBoxException of the right shaving,
+	trail.undo();                                      // box=initbox
+	trail.save(var);
+	box[var]= Interval(leftbox[var].lb(),sup0);
+	bool r1= shave_bound_dicho (ctc, trail, var,  w3b, false);
+	if (box.is_empty()) {
+		box=leftbox; return true;                      // if the right shaving empties the box,
 		                                               // the contracted box becomes the left box
 	}
 
 	IntervalVector rightbox=box;
-	box=initbox;
+	trail.undo();                                      // box=initbox
+	trail.save(var);
 	box[var]= Interval(leftbox[var].ub(),rightbox[var].lb()); // the central part
-	IntervalVector savebox=box;
 	IntervalVector newbox= leftbox | rightbox;         // the hull
-	if(varCID(var,savebox,newbox)) {
+	if(varCID(var,box,newbox)) {
 		box = newbox; return true;                     // the contracted box is in newbox
 	}
 	else {                                             // VarCID was useless : one returns the result of only 3B:
-		box = initbox;                                 // var is the only contracted variable
+		                                               // var is the only contracted variable
 		box[var] = Interval(leftbox[var].lb(),rightbox[var].ub());
 		return (r0 | r1);
 	}
@@ -140,9 +193,60 @@ bool _3BCID::var3BCID_dicho(int var, double w3b){
 }
  */
 
+bool Ctc3BCid::parallel_var3BCID_dicho(IntervalVector& box, int var, double w3b) {
+	IntervalVector initbox = box;
+
+	// side[0]: the left slide, side[1]: the right slide
+	std::vector<IntervalVector> side(2, box);
+	bool r[2];
+
+#pragma omp parallel for
+	for (int s=0; s<2; s++) {
+		IntervalVectorTrail& trail(s==0? main_trail : right_trail);
+		trail.reset(side[s]);
+		trail.checkpoint();
+		r[s]=shave_bound_dicho(workers[s], trail, var, w3b, s==0);
+	}
+
+	if (side[0].is_empty() || side[1].is_empty()) {   // one side has refuted the whole domain
+		box.set_empty();
+		return true;
+	}
+
+	IntervalVector& leftbox=side[0];
+	IntervalVector& rightbox=side[1];
+
+	if (leftbox[var].ub() >= rightbox[var].lb()) {     // the two slides overlap: no central part
+		box = leftbox | rightbox;
+		return true;
+	}
+
+	box=initbox;
+	box[var]= Interval(leftbox[var].ub(),rightbox[var].lb()); // the central part
+	IntervalVector savebox=box;
+	IntervalVector newbox= leftbox | rightbox;         // the hull
+	if(varCID(var,savebox,newbox)) {
+		box = newbox; return true;                     // the contracted box is in newbox
+	}
+	else {                                             // VarCID was useless : one returns the result of only 3B:
+		box = initbox;                                 // var is the only contracted variable
+		box[var] = Interval(leftbox[var].lb(),rightbox[var].ub());
+		return (r[0] | r[1]);
+	}
+}
+
 bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool left) {
+	main_trail.reset(box);
+	main_trail.checkpoint();
+	bool r=shave_bound_dicho(ctc, main_trail, var, wv, left);
+	if (box.is_empty()) throw EmptyBoxException();
+	return r;
+}
 
-	IntervalVector initbox = box;
+bool Ctc3BCid::shave_bound_dicho(Ctc& c, IntervalVectorTrail& trail, int var,  double wv, bool left) {
+
+	IntervalVector& box(trail.box());
+	trail.checkpoint();                                // the initial box
 	Interval& x(box[var]);
 
 	double inf = x.lb();                                // inf bound (to increase)
@@ -161,10 +265,13 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 		                                               // left, thanks to the "bound" test -not yet-)
 		while (1) {
 			//      cout << "  inf=" << inf << " lb=" << lb << " rb=" << rb << " sup=" << sup << endl;
+			save(trail, var);
 			box[var] = Interval(inf,lb);
 
-			try {
-				ctc.contract(box,impact);              // [gch] only "var" is set in "impact".
+			#pragma omp atomic
+			nb_slices++;
+
+			if (contract_slice(c,box)) {               // [gch] only "var" is set in "impact".
 				inf=box[var].lb();
 				volatile double mid = (inf+lb)/2;      // we must subdivide the current slice (declared volatile to prevent
 				                                       //   the compiler from expanding mid in the next line and using higher
@@ -173,19 +280,19 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 					break;
 				else lb=mid;                           // useless to restore domains (we divide the same slice)
 
-			} catch(EmptyBoxException& e) {            // the current slice has been cut off
+			} else {                                   // the current slice has been cut off
 				//	cout << "      slice removed.\n";
-				if (inf==lb) {                         // border is degenerated and current=border
-					if (inf==sup)                      // current=border=the whole interval itself:
-						throw e;                       //   in this case the box must remain entirely emptied
-					else break;                        // return anyway (no more to do).
-				}
+				#pragma omp atomic
+				nb_refuted++;
+				if (inf==lb)                           // border is degenerated and current=border
+					break;                             // return anyway (no more to do). If current=border=the whole
+				                                       //   interval itself, the box must remain entirely emptied.
 				tmp = inf;                             // current value of inf is used two lines below, save it
 				inf = lb;                              // increase the inf bound
 				// lb = 3*lb-2*tmp;                    // optimistic choice: we double the width of the slice
 				lb = 2*lb-tmp;                         // more realistic  choice: we take the width of the slice
 				if (lb>rb) lb = rb;                    // the largest possible: lb<-rb => try the whole border interval once
-				box = initbox;                         // restore domains (slice has changed)
+				trail.undo();                          // restore domains (slice has changed)
 			}
 		}
 	} else {
@@ -195,10 +302,13 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 		                                               // right, thanks to the "bound" test -not yet-)
 		while (1) {
 			//      cout << "  inf=" << inf << " lb=" << lb << " rb=" << rb << " sup=" << sup << endl;
+			save(trail, var);
 			box[var] = Interval(rb,sup);
 
-			try {
-				ctc.contract(box,impact);              // [gch] only "var" is set in "impact".
+			#pragma omp atomic
+			nb_slices++;
+
+			if (contract_slice(c,box)) {               // [gch] only "var" is set in "impact".
 				sup=box[var].ub();
 				volatile double mid = (rb+sup)/2;      // we must subdivide the current interval (declared volatile to prevent
 				                                       //   the compiler from expanding mid in the next line and using higher
@@ -207,29 +317,46 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 					break;
 				else rb=mid;                           // useless to restore domains (we divide the same slice)
 
-			} catch(EmptyBoxException& e) {            // the current slice has been cut off
+			} else {                                   // the current slice has been cut off
 				//cout << "      slice removed.\n";
-				if (sup==rb) {                         // border is degenerated and current=border
-					if (inf==sup)                      // current=border=the whole interval itself:
-						throw e;                       //   in this case the box must remain entirely emptied
-					else break;                        // return anyway (no more to do).
-				}
+				#pragma omp atomic
+				nb_refuted++;
+				if (sup==rb)                           // border is degenerated and current=border
+					break;                             // return anyway (no more to do). If current=border=the whole
+				                                       //   interval itself, the box must remain entirely emptied.
 				tmp = sup;                             // current value of sup is used two lines below, save it
 				sup = rb;                              // decrease the sup bound
 				//   	rb = 3*rb-2*tmp;               // optimistic choice: we double the width of the slice
 				rb = 2*rb-tmp;                         // more realistic  choice: we take the width of the slice
 				if (rb<lb)  rb = lb;                   // the largest possible: rb<-lb => try the whole border interval once
-				box = initbox;                         // restore domains (slice has changed)
+				trail.undo();                          // restore domains (slice has changed)
 			}
 		}
 	}
+	trail.commit();
 	if (inf < inf0 +wv && sup > sup0 -wv) return false;
 	else return true;
 }
 
 bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom) {
 
-	IntervalVector savebox(box);
+	if (workers.size()>1) {                            // all the slices are contracted in parallel
+		int refuted;
+		IntervalVector hull=parallel_slices(box, var, locs3b, refuted);
+		nb_slices += locs3b;
+		nb_refuted += refuted;
+		if (hull.is_empty()) {
+			box.set_empty();
+			return true;
+		}
+		if (scid==0) box[var]=hull[var];               // standard shaving: only var is contracted
+		else box=hull;
+		return true;
+	}
+
+	IntervalVectorTrail& trail(main_trail);            // records the initial domains of the modified variables
+	trail.reset(box);
+	trail.checkpoint();
 
 	// Reduce left bound by shaving:
 
@@ -243,16 +370,17 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 	while (k < locs3b && ! stopLeft) {
 
 		// Compute a slice 'dom'
-		if (k > 0) box = savebox;
+		if (k > 0) trail.undo();
+		save(trail, var);
 		double inf_k = dom.lb()+k*w_DC;
 		double sup_k = dom.lb()+(k+1)*w_DC;
 		if (sup_k > dom.ub() || (k == locs3b - 1 && sup_k<dom.ub())) sup_k = dom.ub();
 		dom = Interval(inf_k, sup_k);
 
 		// Try to refute this slice
-		try {
-			ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-		} catch(EmptyBoxException& e) {
+		nb_slices++;
+		if (!contract_slice(ctc,box)) {                // [gch] only "var" is set in "impact".
+			nb_refuted++;
 			leftBound = sup_k;
 			k++;
 			continue;
@@ -266,7 +394,7 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 
 	if (!stopLeft) {                                   // all slices give an empty box
 		box.set_empty();
-		throw EmptyBoxException();
+		return true;
 	} else if (k == locs3b) {
 		// Only the last slice gives a non-empty box : box is reduced to this last slice
 		return true;
@@ -284,7 +412,8 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 		while (k2 > kLeft && ! stopRight) {
 
 			// Compute slice
-			box = savebox;
+			trail.undo();
+			save(trail, var);
 			double inf_k = dom.lb() + k2 * w_DC;
 			double sup_k = dom.lb() + (k2+1) * w_DC;
 			if (sup_k > dom.ub() || (k2 == locs3b - 1 && sup_k < dom.ub())) sup_k = dom.ub();
@@ -292,9 +421,9 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 			dom = Interval(inf_k, sup_k);
 
 			// Try to refute the slice
-			try {
-				ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-			} catch(EmptyBoxException& e) {
+			nb_slices++;
+			if (!contract_slice(ctc,box)) {                // [gch] only "var" is set in "impact".
+				nb_refuted++;
 				rightBound = sup_k;
 				k2--;
 				continue;
@@ -323,12 +452,12 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 			else {                                     // A varCID operation is performed on the remaining box :
 
 				newbox = newbox | box;
-				savebox[var]=Interval(leftCID, lastInf_k);
+				trail.undo();
+				box[var]=Interval(leftCID, lastInf_k);
 
-				if(varCID(var,savebox,newbox)) {       // Call to the central CID contraction
+				if(varCID(var,box,newbox)) {           // Call to the central CID contraction
 					box = newbox;
 				} else {                               // VarCID was useless : one returns the result of only 3B
-					box = savebox;
 					box[var] = Interval(leftBound, rightBound);
 				}
 			}
@@ -399,26 +528,34 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 
 	if(scid==0 || equalBoxes (var, varcid_box, var3Bcid_box)) return false;
 
-	IntervalVector box=varcid_box;
+	if (workers.size()>1 && scid>1) {                 // the slices are contracted in parallel
+		int refuted;
+		var3Bcid_box |= parallel_slices(varcid_box, var, scid, refuted);
+		return !equalBoxes (var, varcid_box, var3Bcid_box);
+	}
+
+	IntervalVector& box=varcid_box;
+	IntervalVectorTrail& trail(main_trail);            // box is restored after each slice
+	trail.reset(box);
+	trail.checkpoint();
 	Interval& dom(box[var]);
 
 	double w_DC = dom.diam() / scid;
 	for (int k = 0 ; k < scid ; k++) {
-		if(k>0) box=varcid_box;
+		save(trail, var);
 		// compute slice:
 		double inf_k = dom.lb() + k * w_DC;
 		double sup_k = dom.lb() + (k+1) * w_DC;
 		if (sup_k > dom.ub() || (k == scid-1 && sup_k < dom.ub())) sup_k = dom.ub();
 		dom = Interval(inf_k, sup_k);
 
-		try {
-			ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-		}
-		catch(EmptyBoxException& e) {
+		if (!contract_slice(ctc,box)) {                // [gch] only "var" is set in "impact".
+			trail.undo();
 			continue;                                  // the current slice is infeasible : nothing to add to the hull
 		}
 
 		var3Bcid_box |= box;                           // add box to the hull
+		trail.undo();
 		if(equalBoxes (var, varcid_box, var3Bcid_box))
 			return false;                              // VarCID was useless
 	}
@@ -426,5 +563,46 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 	return true;
 }
 
+bool Ctc3BCid::contract_slice(Ctc& c, IntervalVector& slice) {
+	if (&c==&ctc)
+		return try_subcontract(c,slice,impact);
+	else
+		return c.try_contract(slice,impact);
+}
+
+IntervalVector Ctc3BCid::parallel_slices(const IntervalVector& box, int var, int ns, int& refuted) {
+
+	const Interval& dom(box[var]);
+	double w_DC = dom.diam() / ns;
+
+	std::vector<IntervalVector> slice(ns, box);
+	for (int k = 0 ; k < ns ; k++) {
+		double inf_k = dom.lb() + k * w_DC;
+		double sup_k = dom.lb() + (k+1) * w_DC;
+		if (sup_k > dom.ub() || (k == ns-1 && sup_k < dom.ub())) sup_k = dom.ub();
+		slice[k][var] = Interval(inf_k, sup_k);
+	}
+
+	// the slices are handled by batches of (at most) one slice per worker
+	int nb_workers=workers.size();
+	for (int k0 = 0; k0 < ns; k0 += nb_workers) {
+		int nb_tasks = ns-k0 < nb_workers ? ns-k0 : nb_workers;
+
+#pragma omp parallel for
+		for (int w = 0; w < nb_tasks; w++) {
+			contract_slice(workers[w],slice[k0+w]);        // [gch] only "var" is set in "impact".
+			                                               // (an infeasible slice is set to the empty set)
+		}
+	}
+
+	refuted=0;
+	IntervalVector hull(box.size(), Interval::EMPTY_SET);
+	for (int k = 0 ; k < ns ; k++) {
+		if (slice[k].is_empty()) refuted++;
+		else hull |= slice[k];
+	}
+
+	return hull;
+}
 
 } // end namespace ibex
@@ -13,7 +13,11 @@
 #define __IBEX_CTC_3B_CID_H__
 
 #include "ibex_Ctc.h"
+#include "ibex_IntervalVectorTrail.h"
 #include "ibex_BoolMask.h"
+#include "ibex_Array.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -114,9 +118,42 @@ class Ctc3BCid : public Ctc {
 	 */
 	virtual void contract(IntervalVector& box);
 
+	using Ctc::contract; // contract(Cell&)
+
+	/**
+	 * \brief Add the backtrackable data required by the sub-contractor.
+	 *
+	 * When called with a cell, the slices are contracted with this cell,
+	 * as tentative contractions (see #ibex::Entailment::start_trial()).
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Parallel mode.
+	 *
+	 * The slices of a variable are contracted concurrently, each by a worker, and the
+	 * contracted slices are merged by hull. In the linear shaving, all the slices are
+	 * contracted (instead of stopping at the first non-empty slice on each side) and
+	 * the CID step is replaced by the hull. In the dichotomic shaving, the left and
+	 * right shavings are run concurrently. In the CID step, the \a scid slices are
+	 * contracted concurrently.
+	 *
+	 * \param workers - copies of the sub-contractor #ctc, one per thread (at least two;
+	 *                  otherwise the parallel mode is disabled). They are called concurrently
+	 *                  and must not share any data: typically, each one is built on its own copy
+	 *                  of the system (see System(const System&, copy_mode)).
+	 */
+	void set_workers(const Array<Ctc>& workers);
+
 	/** The variables to which var3BCID is applied **/
 	BoolMask cid_vars;
 
+	/** Number of slices handled by the shaving (3B) process (since the creation of *this). **/
+	long nb_slices;
+
+	/** Number of slices refuted by the shaving (3B) process (since the creation of *this). **/
+	long nb_refuted;
+
 	/** The sub-contractor */
 	Ctc& ctc;
 
@@ -140,9 +177,17 @@ class Ctc3BCid : public Ctc {
 	 * Computes the actual number of slices and the size of a slice,
 	 * taking into account the size limit #var_min_width.
 	 * Decides the shaving mode : dichotomy or slices
+	 *
+	 * The slices are contracted without EmptyBoxException. If the whole domain of
+	 * \a var is refuted, the box is set to the empty set (no exception is thrown).
 	 */
 	bool var3BCID(IntervalVector& box, int var);
 
+	/**
+	 * Same as #var3BCID (without the handling of the entailed constraints).
+	 */
+	bool var3BCID_shave(IntervalVector& box, int var);
+
 	/**
 	 * Applies 3BCID contraction on the variable var with a dichotomic 3B algorithm
 	 *
@@ -186,6 +231,44 @@ class Ctc3BCid : public Ctc {
 	 */
 	bool shave_bound_dicho(IntervalVector& box, int var, double wv, bool left);
 
+	/**
+	 * Left or right shaving in a dichotomic way, with the sub-contractor \a c,
+	 * of the box of \a trail.
+	 *
+	 * The refuted slices are undone with the trail. On return, the modifications of
+	 * the box are recorded in the current level of the trail (they can be undone by
+	 * the caller). If the whole domain is refuted, the box is set to the empty set
+	 * (no EmptyBoxException is thrown).
+	 */
+	bool shave_bound_dicho(Ctc& c, IntervalVectorTrail& trail, int var, double wv, bool left);
+
+	/**
+	 * Parallel version of #var3BCID_dicho: the left and right shavings are run
+	 * concurrently by two workers.
+	 */
+	bool parallel_var3BCID_dicho(IntervalVector& box, int var, double wv);
+
+	/**
+	 * Splits [var] in \a ns slices of equal width and contracts the corresponding
+	 * sub-boxes of \a box concurrently with the workers.
+	 *
+	 * \param refuted - (output) the number of refuted slices.
+	 * \return the hull of the contracted sub-boxes (empty if all the slices are refuted).
+	 */
+	IntervalVector parallel_slices(const IntervalVector& box, int var, int ns, int& refuted);
+
+	/**
+	 * Contracts a slice with \a c (#ctc or a worker).
+	 *
+	 * The current cell (if any) is only transmitted to #ctc: the workers
+	 * run concurrently and the backtrackable data of the cell are not thread-safe.
+	 *
+	 * No EmptyBoxException is thrown (see #ibex::Ctc::try_contract(IntervalVector&)).
+	 *
+	 * \return false iff the slice is refuted (it is then set to the empty set).
+	 */
+	bool contract_slice(Ctc& c, IntervalVector& slice);
+
 	/**
 	 * Contracts with CID \a box slicing the variable \a var.
 	 *
@@ -199,7 +282,7 @@ class Ctc3BCid : public Ctc {
 	 * returns true if one other variable, different from var, is contracted
 	 *
 	 * \param var     The current variable.
-	 * \param savebox The box to be contracted.
+	 * \param savebox The box to be contracted (restored on return).
 	 * \param newbox  The resulting contracted box
 	 * \return        true iff varCID was useful
 	 */
@@ -210,6 +293,12 @@ class Ctc3BCid : public Ctc {
 	 */
 	bool equalBoxes (int var, IntervalVector &box1, IntervalVector &box2);
 
+	/**
+	 * Records in \a trail the domains that the contraction of a slice of \a var
+	 * can modify: the output variables of the sub-contractor and \a var.
+	 */
+	void save(IntervalVectorTrail& trail, int var) const;
+
 	/** The maximum number of slices that the contractor will try to refute **/
 	int s3b;
 
@@ -228,6 +317,21 @@ class Ctc3BCid : public Ctc {
 	/** Used to pass the shaved variable to the sub-contractor.
 	 * Allow to benefit from the incrementality of the sub-contractor. */
 	BoolMask impact;
+
+	/** The copies of the sub-contractor used in parallel mode (see #set_workers). */
+	Array<Ctc> workers;
+
+	/** Restores the box between two slices (reset at each shaving). */
+	IntervalVectorTrail main_trail;
+
+	/** Restores the box of the right shaving in #parallel_var3BCID_dicho. */
+	IntervalVectorTrail right_trail;
+
+private:
+	void init();
+
+	/** The output variables of the sub-contractor (all the variables if unspecified). */
+	std::vector<int> ctc_output;
 };
 
 } // end namespace ibex
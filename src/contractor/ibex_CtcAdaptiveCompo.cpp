@@ -0,0 +1,192 @@
+//============================================================================
+//                                  I B E X
+// File        : Adaptive composition of contractors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcAdaptiveCompo.h"
+#include "ibex_EmptyBoxException.h"
+#include "ibex_Cell.h"
+
+#include <algorithm>
+#include <ctime>
+#include <iostream>
+
+using namespace std;
+
+namespace ibex {
+
+const int CtcAdaptiveCompo::default_tuning_calls = 50;
+const int CtcAdaptiveCompo::default_tuning_period = 1000;
+const double CtcAdaptiveCompo::default_gain_ratio = 0.002;
+const int CtcAdaptiveCompo::default_max_period = 64;
+
+namespace {
+
+// average relative reduction of the diameters (as in ACID)
+double relative_gain(const IntervalVector& old_box, const IntervalVector& box) {
+	double g=0;
+	for (int j=0; j<box.size(); j++) {
+		if (old_box[j].diam()!=0 && box[j].diam()!=POS_INFINITY)
+			g += 1 - box[j].diam()/old_box[j].diam();
+	}
+	return g/box.size();
+}
+
+// sort the contractors by decreasing efficiency
+struct more_efficient {
+	more_efficient(const vector<double>& eff) : eff(eff) { }
+	bool operator()(int i, int j) const { return eff[i]>eff[j]; }
+	const vector<double>& eff;
+};
+
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(const Array<Ctc>& list) : CtcCompo(list) {
+	init();
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(Ctc& c1, Ctc& c2) : CtcCompo(c1,c2) {
+	init();
+}
+
+CtcAdaptiveCompo::CtcAdaptiveCompo(Ctc& c1, Ctc& c2, Ctc& c3) : CtcCompo(c1,c2,c3) {
+	init();
+}
+
+void CtcAdaptiveCompo::init() {
+	int n=list.size();
+
+	adaptive.assign(n,true);
+	period.assign(n,1);
+	min_depth.assign(n,0);
+	reorder=false;
+	tuning_calls=default_tuning_calls;
+	tuning_period=default_tuning_period;
+	gain_ratio=default_gain_ratio;
+	max_period=default_max_period;
+
+	nb_calls.assign(n,0);
+	nb_skips.assign(n,0);
+	nb_useful.assign(n,0);
+	time.assign(n,0);
+	gain.assign(n,0);
+	nb_compo_calls=0;
+	nb_tunings=0;
+
+	for (int i=0; i<n; i++) _order.push_back(i);
+
+	tuning_nb_calls.assign(n,0);
+	tuning_nb_useful.assign(n,0);
+	tuning_time.assign(n,0);
+	tuning_gain.assign(n,0);
+}
+
+void CtcAdaptiveCompo::add_backtrackable(Cell& root) {
+	root.add<CellDepth>();
+	CtcCompo::add_backtrackable(root);
+}
+
+void CtcAdaptiveCompo::contract(IntervalVector& box) {
+
+	int depth=-1; // unknown
+	if (cell() && cell()->has<CellDepth>())
+		depth=cell()->get<CellDepth>().depth;
+
+	int call=nb_compo_calls++;
+	int phase=call % tuning_period;
+	bool tuning=phase < tuning_calls;
+	bool end_tuning=(phase==tuning_calls-1);
+
+	IntervalVector old_box(box);
+
+	for (unsigned int k=0; k<_order.size(); k++) {
+		int i=_order[k];
+
+		if ((depth>=0 && depth<min_depth[i]) || (!tuning && call % period[i]!=0)) {
+			nb_skips[i]++;
+			continue;
+		}
+
+		old_box=box;
+		clock_t start=clock();
+		double g;
+
+		try {
+			subcontract(list[i],box);
+			g=relative_gain(old_box,box);
+		} catch (EmptyBoxException& e) {
+			box.set_empty();
+			g=1;
+		}
+
+		double t=((double) (clock()-start))/CLOCKS_PER_SEC;
+
+		nb_calls[i]++;
+		time[i]+=t;
+		gain[i]+=g;
+		if (tuning) {
+			tuning_nb_calls[i]++;
+			tuning_time[i]+=t;
+			tuning_gain[i]+=g;
+			if (g>gain_ratio) {
+				tuning_nb_useful[i]++;
+				nb_useful[i]++;
+			}
+		}
+
+		if (box.is_empty()) {
+			if (end_tuning) tune();
+			throw EmptyBoxException();
+		}
+	}
+
+	if (end_tuning) tune();
+}
+
+void CtcAdaptiveCompo::tune() {
+	int n=list.size();
+
+	vector<double> eff(n,0);
+
+	for (int i=0; i<n; i++) {
+		if (tuning_nb_calls[i]==0) continue;
+
+		if (adaptive[i]) {
+			if (tuning_nb_useful[i]==0)
+				period[i]=max_period;
+			else {
+				int p=(int) (((double) tuning_nb_calls[i])/tuning_nb_useful[i] + 0.5);
+				period[i]= p<1? 1 : (p>max_period? max_period : p);
+			}
+		}
+
+		eff[i]=tuning_gain[i]/(tuning_time[i]>0? tuning_time[i] : 1.0/CLOCKS_PER_SEC);
+	}
+
+	if (reorder)
+		stable_sort(_order.begin(),_order.end(),more_efficient(eff));
+
+	tuning_nb_calls.assign(n,0);
+	tuning_nb_useful.assign(n,0);
+	tuning_time.assign(n,0);
+	tuning_gain.assign(n,0);
+
+	nb_tunings++;
+}
+
+void CtcAdaptiveCompo::report() const {
+	cout << " adaptive composition: " << nb_compo_calls << " calls, " << nb_tunings << " tunings" << endl;
+	for (unsigned int k=0; k<_order.size(); k++) {
+		int i=_order[k];
+		cout << "  contractor " << i << (adaptive[i]? " (adaptive)" : "")
+			 << " period " << period[i] << " min depth " << min_depth[i]
+			 << " calls " << nb_calls[i] << " skips " << nb_skips[i] << " useful " << nb_useful[i]
+			 << " time " << time[i] << "s. avg gain " << (nb_calls[i]>0? gain[i]/nb_calls[i] : 0) << endl;
+	}
+}
+
+} // end namespace ibex
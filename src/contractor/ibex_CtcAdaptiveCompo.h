@@ -0,0 +1,180 @@
+//============================================================================
+//                                  I B E X
+// File        : Adaptive composition of contractors
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_ADAPTIVE_COMPO_H__
+#define __IBEX_CTC_ADAPTIVE_COMPO_H__
+
+#include "ibex_CtcCompo.h"
+#include "ibex_Backtrackable.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ * \brief Depth of a cell in the search tree (0 for the root cell).
+ */
+class CellDepth : public Backtrackable {
+public:
+	CellDepth() : depth(0) { }
+
+	CellDepth(int d) : depth(d) { }
+
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new CellDepth(depth+1),new CellDepth(depth+1));
+	}
+
+	int depth;
+};
+
+/**
+ * \ingroup contractor
+ * \brief Composition of contractors with adaptive scheduling.
+ *
+ * This composition monitors the time spent in each sub-contractor and the reduction
+ * it obtains, and calls the sub-contractors that are rarely useful less often.
+ *
+ * The ith sub-contractor is only called:
+ * <ul>
+ * <li> every #period[i] calls of the composition,
+ * <li> at a depth greater or equal to #min_depth[i] in the search tree (when the
+ *      composition is called with a cell, see #ibex::Ctc::contract(Cell&)).
+ * </ul>
+ *
+ * As in ACID, the scheduling alternates small tuning phases (#tuning_calls calls, every #tuning_period calls)
+ * where all the sub-contractors are called, and running phases. During a tuning phase, a call to a sub-contractor
+ * is useful if it reduces the box by more than #gain_ratio (the gain is the average relative reduction of the
+ * diameters, as in ACID) or if it proves that the box is empty.
+ * At the end of the tuning phase, the period of an "adaptive" sub-contractor (see #adaptive)
+ * is set to the inverse of the proportion of useful calls (bounded by #max_period). If #reorder is true,
+ * the sub-contractors are also sorted by decreasing efficiency (gain per second).
+ */
+class CtcAdaptiveCompo : public CtcCompo {
+public:
+	/**
+	 * \brief Build an adaptive composition.
+	 */
+	CtcAdaptiveCompo(const Array<Ctc>& list);
+
+	/**
+	 * \brief Build the adaptive composition of c1 and c2.
+	 */
+	CtcAdaptiveCompo(Ctc& c1, Ctc& c2);
+
+	/**
+	 * \brief Build the adaptive composition of c1, c2 and c3.
+	 */
+	CtcAdaptiveCompo(Ctc& c1, Ctc& c2, Ctc& c3);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	using Ctc::contract; // contract(Cell&)
+
+	/**
+	 * \brief Add the backtrackable data required by the sub-contractors
+	 * and the depth of the cells.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Print the policy and the statistics of each sub-contractor.
+	 */
+	void report() const;
+
+	/**
+	 * \brief Current order of the sub-contractors.
+	 *
+	 * The list itself (#list) is not modified.
+	 */
+	const std::vector<int>& order() const;
+
+	/** Whether the period of each sub-contractor is tuned (by default: true). */
+	std::vector<bool> adaptive;
+
+	/** Call the ith sub-contractor every period[i] calls (by default: 1). */
+	std::vector<int> period;
+
+	/** Minimal depth for calling the ith sub-contractor (by default: 0). */
+	std::vector<int> min_depth;
+
+	/** Sort the sub-contractors by decreasing efficiency at the end of each tuning (by default: false). */
+	bool reorder;
+
+	/** Number of calls of a tuning phase. */
+	int tuning_calls;
+
+	/** Number of calls between the beginnings of two tuning phases. */
+	int tuning_period;
+
+	/** Minimal gain of a useful call. */
+	double gain_ratio;
+
+	/** Maximal period of an adaptive sub-contractor. */
+	int max_period;
+
+	/** Number of calls to each sub-contractor. */
+	std::vector<int> nb_calls;
+
+	/** Number of times each sub-contractor has been skipped. */
+	std::vector<int> nb_skips;
+
+	/** Number of useful calls to each sub-contractor (during the tuning phases). */
+	std::vector<int> nb_useful;
+
+	/** Time spent in each sub-contractor (CPU seconds). */
+	std::vector<double> time;
+
+	/** Sum of the gains of each sub-contractor. */
+	std::vector<double> gain;
+
+	/** Number of calls to the composition. */
+	int nb_compo_calls;
+
+	/** Number of completed tuning phases. */
+	int nb_tunings;
+
+	/** Default number of calls of a tuning phase, set to 50. */
+	static const int default_tuning_calls;
+
+	/** Default number of calls between two tuning phases, set to 1000. */
+	static const int default_tuning_period;
+
+	/** Default minimal gain of a useful call, set to 0.002. */
+	static const double default_gain_ratio;
+
+	/** Default maximal period, set to 64. */
+	static const int default_max_period;
+
+protected:
+	void init();
+
+	/* End of a tuning phase: update the periods and the order */
+	void tune();
+
+	std::vector<int> _order;
+
+	/* statistics of the current tuning phase */
+	std::vector<int> tuning_nb_calls;
+	std::vector<int> tuning_nb_useful;
+	std::vector<double> tuning_time;
+	std::vector<double> tuning_gain;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const std::vector<int>& CtcAdaptiveCompo::order() const {
+	return _order;
+}
+
+} // end namespace ibex
+#endif // __IBEX_CTC_ADAPTIVE_COMPO_H__
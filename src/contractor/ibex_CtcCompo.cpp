@@ -94,9 +94,15 @@ void CtcCompo::contract(IntervalVector& box) {
 //	}
 
 	for (int i=0; i<list.size(); i++) {
-		list[i].contract(box);
+		subcontract(list[i],box);
 	}
 
 }
 
+void CtcCompo::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++) {
+		list[i].add_backtrackable(root);
+	}
+}
+
 } // end namespace ibex
@@ -68,6 +68,13 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	using Ctc::contract; // contract(Cell&)
+
+	/**
+	 * \brief Add the backtrackable data required by the sub-contractors.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/** The list of sub-contractors */
 	Array<Ctc> list;
 
@@ -9,22 +9,60 @@
 
 #include "ibex_CtcExist.h"
 
+#include <stack>
+
 
 namespace ibex {
 
+namespace {
+
+/* true if the first res.size() components of box are included in res */
+bool is_subset_prefix(const IntervalVector& box, const IntervalVector& res) {
+	if (res.is_empty()) return false;
+	for (int i=0; i<res.size(); i++)
+		if (!box[i].is_subset(res[i])) return false;
+	return true;
+}
+
+/* res := res | (first res.size() components of box) */
+void hull_prefix(IntervalVector& res, const IntervalVector& box) {
+	if (res.is_empty())
+		for (int i=0; i<res.size(); i++) res[i] = box[i];
+	else
+		for (int i=0; i<res.size(); i++) res[i] |= box[i];
+}
+
+/* maximal diameter of the components of box from the nth one */
+double max_diam_suffix(const IntervalVector& box, int n) {
+	double d=0;
+	for (int i=n; i<box.size(); i++)
+		if (box[i].diam()>d) d=box[i].diam();
+	return d;
+}
+
+}
+
 CtcExist::CtcExist(const NumConstraint& ctr, double prec,const  IntervalVector& init_box) :
 		Ctc(ctr.f.nb_var()-init_box.size()), _ctc(*new CtcFwdBwd(ctr)), _init(init_box), _prec(prec)  {
 	assert(init_box.size()<ctr.f.nb_var());
+	init();
 }
 
 CtcExist::CtcExist(Function& f, CmpOp op, double prec,const  IntervalVector& init_box) :
 		Ctc(f.nb_var()-init_box.size()), _ctc(*new CtcFwdBwd(f, op)), _init(init_box), _prec(prec)  {
 	assert(init_box.size()<f.nb_var());
+	init();
 }
 
 CtcExist::CtcExist(Ctc& p, double prec,const  IntervalVector& init_box) :
 		Ctc(p.nb_var-init_box.size()), _ctc(p), _init(init_box), _prec(prec)  {
 	assert(init_box.size()<p.nb_var);
+	init();
+}
+
+void CtcExist::init() {
+	for (int j=0; j<_ctc.nb_var; j++)
+		if (!_ctc.output || (*_ctc.output)[j]) ctc_output.push_back(j);
 }
 
 IntervalVector& CtcExist::getInit(){
@@ -36,52 +74,121 @@ void CtcExist::setInit(IntervalVector& init){
 
 
 
+void CtcExist::set_workers(const Array<Ctc>& w) {
+	workers.clear();
+	workers.resize(w.size()>1? w.size() : 0);
+	for (int i=0; i<workers.size(); i++) {
+		assert(w[i].nb_var==_ctc.nb_var);
+		workers.set_ref(i,w[i]);
+	}
+}
+
+bool CtcExist::explore(Ctc& c, IntervalVectorTrail& trail, IntervalVector& mid, const IntervalVector& res) {
+
+	IntervalVector& box(trail.box());
+
+	// the projection of the sub-box is already covered
+	// (the contraction cannot enlarge it)
+	if (is_subset_prefix(box, res)) return false;
+
+	try {
+		c.contract(box);
+	} catch (EmptyBoxException&) { return false; }
+
+	if (box.is_empty() || is_subset_prefix(box, res)) return false;
+
+	if (max_diam_suffix(box, nb_var) > _prec) {
+		// the parameters are fixed to their midpoint in the sub-box
+		// itself (only the modified domains are restored)
+		trail.checkpoint();
+		trail.save(ctc_output);
+		for(int i=0; i< _init.size() ; i++) {
+			trail.save(i+nb_var);
+			box[i+nb_var] = box[i+nb_var].mid();
+		}
+		try {
+			c.contract(box);
+			if (box.is_empty()) mid.set_empty();
+			else for(int i=0; i< nb_var; i++) mid[i] = box[i];
+		} catch (EmptyBoxException&) {
+			mid.set_empty();
+		}
+		trail.backtrack();
+	}
+	return true;
+}
+
 void CtcExist::contract(IntervalVector& x) {
 	assert(x.size()==nb_var);
 
-	IntervalVector  box(nb_var+_init.size()), save(nb_var+_init.size());
+	int n=nb_var+_init.size();
+	IntervalVector  box(n);
 	IntervalVector res(nb_var); res.set_empty();
-	IntervalVector  sub1(nb_var), sub2(_init.size());
 	box.put(0, x);
 	box.put(x.size(), _init);
 
+	// in sequential mode: a batch of one sub-box, contracted by _ctc
+	int nb_tasks = workers.size()>1 ? workers.size() : 1;
+	Array<IntervalVector> boxes(nb_tasks), mids(nb_tasks);
+	Array<IntervalVectorTrail> trails(nb_tasks);
+	for (int k=0; k<nb_tasks; k++) {
+		boxes.set_ref(k,*new IntervalVector(n));
+		mids.set_ref(k,*new IntervalVector(nb_var));
+		trails.set_ref(k,*new IntervalVectorTrail(boxes[k]));
+	}
+	bool* useful = new bool[nb_tasks];
+
 	LargestFirst bsc;
 	std::stack<IntervalVector> l;
 	l.push(box);
 	
 	while (!l.empty()) {
-		box = l.top();	l.pop();
-		try {
-			_ctc.contract(box);
-		} catch (EmptyBoxException&) { continue; }
-
-		sub1 = box.subvector(0, nb_var - 1);
-		if (not(sub1.is_subset(res))) {
-			sub2 = box.subvector(nb_var, nb_var+_init.size() - 1);
-			if (sub2.max_diam()<= _prec) {
-				res |= sub1;
-				if (res==x) return;
-			}
+		int nb=0;
+		while (nb<nb_tasks && !l.empty()) {
+			boxes[nb++] = l.top(); l.pop();
+		}
+
+		if (nb_tasks==1)
+			useful[0] = explore(_ctc, trails[0], mids[0], res);
+		else {
+			#pragma omp parallel for
+			for (int k=0; k<nb; k++)
+				useful[k] = explore(workers[k], trails[k], mids[k], res);
+		}
+
+		for (int k=0; k<nb; k++) {
+			if (!useful[k] || is_subset_prefix(boxes[k], res)) continue;
+
+			if (max_diam_suffix(boxes[k], nb_var) <= _prec)
+				hull_prefix(res, boxes[k]);
 			else {
-				for(int i=0; i< nb_var; i++)        save[i]= box[i];
-				for(int i=0; i< _init.size() ; i++) save[i+nb_var] = sub2[i].mid();
-				try {
-					_ctc.contract(save);
-					res |= save.subvector(0, nb_var - 1);
-					if (res==x) return;
-				} catch (EmptyBoxException&) {	}
+				if (!mids[k].is_empty())
+					hull_prefix(res, mids[k]);
 
+				IntervalVector sub2 = boxes[k].subvector(nb_var, n-1);
 				std::pair<IntervalVector, IntervalVector> cut = bsc.bisect(sub2);
-				box.put(nb_var, cut.first);
-				l.push(box);
-				box.put(nb_var, cut.second);
-				l.push(box);
+				boxes[k].put(nb_var, cut.first);
+				l.push(boxes[k]);
+				boxes[k].put(nb_var, cut.second);
+				l.push(boxes[k]);
 			}
 		}
+
+		// early cut-off: the union covers the input box
+		if (res==x) break;
 	}
+
+	for (int k=0; k<nb_tasks; k++) {
+		delete &trails[k];
+		delete &boxes[k];
+		delete &mids[k];
+	}
+	delete[] useful;
+
+	if (res==x) return;
+
 	x &= res;
 	if (x.is_empty()) throw EmptyBoxException();
-
 }
 
 } // end namespace ibex
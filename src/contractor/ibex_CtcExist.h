@@ -13,7 +13,10 @@
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_Ctc.h"
 #include "ibex_LargestFirst.h"
+#include "ibex_Array.h"
+#include "ibex_IntervalVectorTrail.h"
 #include <list>
+#include <vector>
 
 namespace ibex {
 
@@ -42,7 +45,41 @@ public:
 	IntervalVector& getInit();
 	void setInit(IntervalVector& init);
 
+	/**
+	 * \brief Parallel mode.
+	 *
+	 * The sub-boxes of the parameters are explored by batches: the sub-boxes of a batch
+	 * are contracted concurrently, each by a worker, and the results are merged in the
+	 * same order as in the sequential exploration.
+	 *
+	 * \param workers - copies of the contractor, one per thread (at least two;
+	 *                  otherwise the parallel mode is disabled). They are called concurrently
+	 *                  and must not share any data (e.g., the same function).
+	 */
+	void set_workers(const Array<Ctc>& workers);
+
 private:
+	/**
+	 * \brief Contract a sub-box with c.
+	 *
+	 * The sub-box is the box of \a trail. If the parameters are larger than the precision,
+	 * the sub-box with the parameters fixed to their midpoint is also contracted (and undone
+	 * with the trail) and \a mid is set to the projection of the result.
+	 * The sub-box is skipped (return false) if it is empty or if its projection
+	 * is already in \a res.
+	 */
+	bool explore(Ctc& c, IntervalVectorTrail& trail, IntervalVector& mid, const IntervalVector& res);
+
+	/**
+	 * \brief Initialize #ctc_output.
+	 */
+	void init();
+
+	/**
+	 * \brief The copies of the contractor used in parallel mode (see #set_workers).
+	 */
+	Array<Ctc> workers;
+
 	/**
 	 * \brief The Contractor.
 	 */
@@ -58,6 +95,11 @@ private:
 	 * \brief precision
 	 */
 	double _prec;
+
+	/**
+	 * \brief The output variables of the contractor (all the variables if unspecified).
+	 */
+	std::vector<int> ctc_output;
 };
 
 typedef  CtcExist CtcProjUnion;
@@ -16,16 +16,27 @@ namespace ibex {
 const double CtcFixPoint::default_ratio = 0.1;
 
 CtcFixPoint::CtcFixPoint(Ctc& ctc, double ratio) :
-		Ctc(ctc.nb_var), ctc(ctc), ratio(ratio) {
+		Ctc(ctc.nb_var), ctc(ctc), ratio(ratio), trail(ctc.nb_var) {
+	for (int j=0; j<nb_var; j++)
+		if (!ctc.output || (*ctc.output)[j]) ctc_output.push_back(j);
 }
 
 void CtcFixPoint::contract(IntervalVector& box) {
 
-	IntervalVector old_box(box);
+	// the old domains of the output variables only are recorded
+	trail.reset(box);
+	double dist;
 	do {
-		old_box=box;
-		ctc.contract(box);
-	} while (old_box.rel_distance(box)>ratio);
+		trail.checkpoint();
+		trail.save(ctc_output);
+		subcontract(ctc,box);
+		dist=trail.rel_distance();
+		trail.commit();
+	} while (dist>ratio);
+}
+
+void CtcFixPoint::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
 }
 
 } // end namespace ibex
@@ -12,6 +12,9 @@
 #define __IBEX_CTC_FIX_POINT_H__
 
 #include "ibex_Ctc.h"
+#include "ibex_IntervalVectorTrail.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -36,6 +39,13 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	using Ctc::contract; // contract(Cell&)
+
+	/**
+	 * \brief Add the backtrackable data required by the sub-contractor.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/** The sub-contractor */
 	Ctc& ctc;
 
@@ -48,6 +58,13 @@ public:
 
 	/** Default ratio used, set to 0.1. */
 	static const double default_ratio;
+
+private:
+	/* the output variables of ctc (all the variables if unspecified) */
+	std::vector<int> ctc_output;
+
+	/* records the domains of the output variables before each iteration */
+	IntervalVectorTrail trail;
 };
 
 } // end namespace ibex
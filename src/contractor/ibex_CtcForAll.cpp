@@ -9,6 +9,8 @@
 
 #include "ibex_CtcForAll.h"
 
+#include <stack>
+
 namespace ibex {
 
 CtcForAll::CtcForAll(const NumConstraint& ctr, double prec,const  IntervalVector& init_box) :
@@ -34,55 +36,95 @@ void CtcForAll::setInit(IntervalVector& init){
 	_init = init;
 }
 
+void CtcForAll::set_workers(const Array<Ctc>& w) {
+	workers.clear();
+	workers.resize(w.size()>1? w.size() : 0);
+	for (int i=0; i<workers.size(); i++) {
+		assert(w[i].nb_var==_ctc.nb_var);
+		workers.set_ref(i,w[i]);
+	}
+}
+
+bool CtcForAll::explore(Ctc& c, IntervalVector& box, IntervalVector& mid) {
+	for(int i=0; i< _init.size(); i++) mid[i+nb_var] = box[i+nb_var];
+	try {
+		c.contract(box);
+	} catch (EmptyBoxException&) {
+		return false;
+	}
+	for(int i=0; i< _init.size(); i++) {
+		if (mid[i+nb_var] != box[i+nb_var]) return false;
+		mid[i+nb_var] = box[i+nb_var].mid();
+	}
+	for(int i=0; i<nb_var; i++)  mid[i]= box[i];
+
+	try {
+		c.contract(mid);
+	} catch (EmptyBoxException&) {
+		return false;
+	}
+	return true;
+}
+
 void CtcForAll::contract(IntervalVector& x) {
 	assert(x.size()==nb_var);
 
-	IntervalVector  box(nb_var+_init.size());
-	IntervalVector 	box_mid(nb_var+_init.size());
-	IntervalVector  sub(_init.size());
+	int n=nb_var+_init.size();
+	IntervalVector  box(n);
 	box.put(0, x);
 	box.put(nb_var, _init);
 
+	// in sequential mode: a batch of one sub-box, contracted by _ctc
+	int nb_tasks = workers.size()>1 ? workers.size() : 1;
+	Array<IntervalVector> boxes(nb_tasks), mids(nb_tasks);
+	for (int k=0; k<nb_tasks; k++) {
+		boxes.set_ref(k,*new IntervalVector(n));
+		mids.set_ref(k,*new IntervalVector(n));
+	}
+	bool* ok = new bool[nb_tasks];
+
 	LargestFirst bsc;
 	std::stack<IntervalVector> l;
 	l.push(box);
 
-	while (!l.empty()) {
-		box = l.top(); l.pop();
-		
-		for(int i=0; i< _init.size(); i++) box_mid[i+nb_var] = box[i+nb_var];
-		try {
-			_ctc.contract(box);
-		} catch (EmptyBoxException& e) {
-			x.set_empty();
-			throw e;
-		}
-		sub = box.subvector(nb_var, nb_var+_init.size() - 1);
-		for(int i=0; i< _init.size(); i++) {
-			if (box_mid[i+nb_var] != sub[i]) {
-				x.set_empty();  throw EmptyBoxException();
-			}
-			box_mid[i+nb_var] = sub[i].mid();
+	while (!l.empty() && !x.is_empty()) {
+		int nb=0;
+		while (nb<nb_tasks && !l.empty()) {
+			boxes[nb++] = l.top(); l.pop();
 		}
-		for(int i=0; i<nb_var; i++)  box_mid[i]= box[i];
 
-		try {
-			_ctc.contract(box_mid);
-		} catch (EmptyBoxException& e) {
-			x.set_empty();
-			throw e;
+		if (nb_tasks==1)
+			ok[0] = explore(_ctc, boxes[0], mids[0]);
+		else {
+			#pragma omp parallel for
+			for (int k=0; k<nb; k++)
+				ok[k] = explore(workers[k], boxes[k], mids[k]);
 		}
-		x &= box_mid.subvector(0, nb_var - 1);
-		if (x.is_empty()) throw EmptyBoxException();
-
-		if (sub.max_diam()>= _prec) {
-			std::pair<IntervalVector, IntervalVector> cut = bsc.bisect(sub);
-			box.put(nb_var, cut.first);
-			l.push(box);
-			box.put(nb_var, cut.second);
-			l.push(box);
+
+		for (int k=0; k<nb; k++) {
+			if (!ok[k]) { x.set_empty(); break; }
+
+			x &= mids[k].subvector(0, nb_var - 1);
+			if (x.is_empty()) break;
+
+			IntervalVector sub = boxes[k].subvector(nb_var, n-1);
+			if (sub.max_diam()>= _prec) {
+				std::pair<IntervalVector, IntervalVector> cut = bsc.bisect(sub);
+				boxes[k].put(nb_var, cut.first);
+				l.push(boxes[k]);
+				boxes[k].put(nb_var, cut.second);
+				l.push(boxes[k]);
+			}
 		}
 	}
+
+	for (int k=0; k<nb_tasks; k++) {
+		delete &boxes[k];
+		delete &mids[k];
+	}
+	delete[] ok;
+
+	if (x.is_empty()) throw EmptyBoxException();
 }
 
 } // end namespace ibex
@@ -13,6 +13,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_LargestFirst.h"
+#include "ibex_Array.h"
 
 namespace ibex {
 
@@ -40,7 +41,33 @@ public:
 	IntervalVector& getInit();
 	void setInit(IntervalVector& init);
 
+	/**
+	 * \brief Parallel mode.
+	 *
+	 * The sub-boxes of the parameters are explored by batches: the sub-boxes of a batch
+	 * are contracted concurrently, each by a worker.
+	 *
+	 * \param workers - copies of the contractor, one per thread (at least two;
+	 *                  otherwise the parallel mode is disabled). They are called concurrently
+	 *                  and must not share any data (e.g., the same function).
+	 */
+	void set_workers(const Array<Ctc>& workers);
+
 private:
+	/**
+	 * \brief Contract a sub-box and the sub-box with the parameters fixed
+	 * to their midpoint (\a mid) with c.
+	 *
+	 * Return false if the parameters of the sub-box are contracted (or if
+	 * one of the two boxes is empty).
+	 */
+	bool explore(Ctc& c, IntervalVector& box, IntervalVector& mid);
+
+	/**
+	 * \brief The copies of the contractor used in parallel mode (see #set_workers).
+	 */
+	Array<Ctc> workers;
+
 	/**
 	 * \brief The larger contractor.
 	 */
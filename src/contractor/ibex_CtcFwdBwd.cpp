@@ -10,33 +10,73 @@
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_CtcFwdBwd.h"
+#include "ibex_Entailment.h"
 
 
 namespace ibex {
 
-CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op, FwdMode mode) : Ctc(f.nb_var()), ctr(f,op), hc4r(mode) {
-	input = new BoolMask(nb_var);
-	output = new BoolMask(nb_var);
-
-	for (int v=0; v<ctr.f.nb_var(); v++)
-		(*output)[v]=(*input)[v]=ctr.f.used(v);
+CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op, FwdMode mode) : Ctc(f.nb_var()), ctr(f,op), incremental(true), hc4r(mode), last_box(f.nb_var()) {
+	init();
+}
 
+CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr, FwdMode mode) : Ctc(ctr.f.nb_var()), ctr(ctr.f,ctr.op), incremental(true), hc4r(mode), last_box(ctr.f.nb_var()) {
+	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr, FwdMode mode) : Ctc(ctr.f.nb_var()), ctr(ctr.f,ctr.op), hc4r(mode) {
+void CtcFwdBwd::init() {
 	input = new BoolMask(nb_var);
 	output = new BoolMask(nb_var);
 
 	for (int v=0; v<ctr.f.nb_var(); v++)
 		(*output)[v]=(*input)[v]=ctr.f.used(v);
+
+	last_fwd = 0;
+	last_valid = false;
+	updated = new bool[nb_var];
+	skip = new bool[ctr.f.expr().size];
 }
 
 CtcFwdBwd::~CtcFwdBwd() {
 	delete input;
 	delete output;
+	delete[] updated;
+	delete[] skip;
+}
+
+void CtcFwdBwd::add_backtrackable(Cell& root) {
+	root.add<Entailment>();
+}
+
+bool CtcFwdBwd::reusable(const IntervalVector& box) {
+	if (!incremental || !last_valid || !ctr.f.all_args_scalar() || ctr.f.nb_forward()!=last_fwd)
+		return false;
+
+	for (int i=0; i<ctr.f.nb_used_vars; i++) {
+		int j=ctr.f.used_var[i];
+		if (!box[j].is_subset(last_box[j])) return false;
+	}
+	return true;
 }
 
 void CtcFwdBwd::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
+bool CtcFwdBwd::try_contract(IntervalVector& box) {
+
+	Entailment* entailment=NULL;
+	if (cell() && cell()->has<Entailment>()) {
+		if (cell()->get<Entailment>().is_entailed(ctr)) {  // entailed in a parent cell
+			set_flag(INACTIVE);
+			set_flag(FIXPOINT);
+			return true;
+		}
+		// the entailment is only valid in the subtree if
+		// the box is the box of the cell (not a copy or a slice)
+		if (&box==&cell()->box && !cell()->get<Entailment>().in_trial())
+			entailment=&cell()->get<Entailment>();
+	}
+
 	const Dim& d=ctr.f.expr().dim;
 	Domain root_label(d);
 	Interval right_cst;
@@ -57,15 +97,41 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 	case Dim::MATRIX_ARRAY: assert(false); /* impossible */ break;
 	}
 
+	bool* s=NULL;
+
+	// note: the entailment cannot be proven by an incremental evaluation
+	if (!entailment && reusable(box)) {
+		const BoolMask* imp=impact();
+		for (int i=0; i<ctr.f.nb_used_vars; i++) {
+			int j=ctr.f.used_var[i];
+			updated[j]=(!imp || (*imp)[j]) && box[j]!=last_box[j];
+		}
+		ctr.f.unaffected(updated,skip);
+		s=skip;
+	}
+
+	last_valid=false;
+
 	try {
-		if (hc4r.proj(ctr.f,root_label,box)) {
+		if (hc4r.proj(ctr.f,root_label,box,s)) {
 			set_flag(INACTIVE);
 			set_flag(FIXPOINT);
+			if (entailment) entailment->set_entailed(ctr);
 		}
-	} catch (EmptyBoxException& e) {
+	} catch (EmptyBoxException&) {                     // thrown by the backward phase
 		box.set_empty();
-		throw e;
+		return false;
+	}
+
+	if (incremental) {
+		for (int i=0; i<ctr.f.nb_used_vars; i++) {
+			int j=ctr.f.used_var[i];
+			last_box[j]=box[j];
+		}
+		last_fwd=ctr.f.nb_forward();
+		last_valid=true;
 	}
+	return true;
 }
 
 } // namespace ibex
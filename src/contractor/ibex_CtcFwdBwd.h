@@ -47,9 +47,30 @@ public:
 
 	/**
 	 * \brief Contract the box.
+	 *
+	 * When called with a cell (see #ibex::Ctc::contract(Cell&)), the box is not
+	 * contracted if the constraint is entailed in the cell (see #ibex::Entailment).
+	 * If the constraint is proven to be entailed on the box of the cell, this is
+	 * recorded in the cell.
 	 */
 	virtual void contract(IntervalVector& box);
 
+	using Ctc::contract; // contract(IntervalVector&, const BoolMask&)
+
+	/**
+	 * \brief Contract the box, without EmptyBoxException.
+	 *
+	 * \see #contract(IntervalVector&).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
+	using Ctc::try_contract; // try_contract(IntervalVector&, const BoolMask&)
+
+	/**
+	 * \brief Add the entailed constraints (#ibex::Entailment) to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/*
 	 * \brief Whether this contractor is idempotent (optional)
 	 */
@@ -62,8 +83,35 @@ public:
 	 */
 	const NumConstraint ctr;
 
+	/**
+	 * \brief Incremental forward evaluation (by default: true).
+	 *
+	 * If true, and if the box is included in the box obtained at the end of
+	 * the last call, only the subexpressions that depend on an updated variable are
+	 * re-evaluated in the forward phase. The updated variables are the variables given
+	 * in the impact (see #ibex::Ctc::contract(IntervalVector&, const BoolMask&)), or
+	 * all the variables if no impact is given, whose domain has changed since the last call.
+	 * The other subexpressions keep the domain computed by the last call.
+	 *
+	 * Only used with interval arithmetic and scalar arguments, and not when an entailment
+	 * can be recorded in the cell (it cannot be proven by an incremental evaluation).
+	 */
+	bool incremental;
+
 protected:
 	HC4Revise hc4r;
+
+	/* Initialize the structures of the incremental evaluation */
+	void init();
+
+	/* True if the labels of the last call can be reused for box */
+	bool reusable(const IntervalVector& box);
+
+	IntervalVector last_box; // box at the end of the last call
+	unsigned long last_fwd;  // number of forward evaluations of ctr.f at the end of the last call
+	bool last_valid;         // false if the last call has failed
+	bool* updated;           // variables updated since the last call
+	bool* skip;              // nodes not re-evaluated
 };
 
 } // namespace ibex
@@ -0,0 +1,160 @@
+/* ============================================================================
+ * I B E X - Forward-backward contractor on a family of constraints
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CtcFwdBwdFamily.h"
+#include "ibex_BatchArith.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* number of instances contracted simultaneously (the values of all
+ * the nodes for a block must fit in the cache) */
+const int FAMILY_BLOCK = 32*BATCH_BLOCK_SIZE;
+
+}
+
+CtcFwdBwdFamily::CtcFwdBwdFamily(Function& f, int nb_var) : Ctc(nb_var), f(f), eval(f),
+		nb_args(f.nb_var()), var(f.nb_var()), value(f.nb_var()), block(FAMILY_BLOCK) {
+
+	input = new BoolMask(nb_var);
+	output = new BoolMask(nb_var);
+	input->unset_all();
+	output->unset_all();
+
+	int n=eval.nb_nodes();
+	val = new Interval*[n];
+	for (int i=0; i<n; i++) val[i]=new Interval[block];
+	dom = new Interval*[nb_args];
+	for (int j=0; j<nb_args; j++) dom[j]=new Interval[block];
+}
+
+CtcFwdBwdFamily::~CtcFwdBwdFamily() {
+	for (int i=0; i<eval.nb_nodes(); i++) delete[] val[i];
+	delete[] val;
+	for (int j=0; j<nb_args; j++) delete[] dom[j];
+	delete[] dom;
+	delete input;
+	delete output;
+}
+
+int CtcFwdBwdFamily::add(const int* v, const IntervalVector& x, const Interval& _y) {
+	assert(x.size()==nb_args);
+	for (int j=0; j<nb_args; j++) {
+		assert(v[j]<nb_var);
+		var[j].push_back(v[j]);
+		value[j].push_back(x[j]);
+		if (v[j]>=0) (*input)[v[j]]=(*output)[v[j]]=true;
+	}
+	y.push_back(_y);
+	return y.size()-1;
+}
+
+int CtcFwdBwdFamily::add(const int* v, const Interval& _y) {
+	return add(v,IntervalVector(nb_args),_y);
+}
+
+void CtcFwdBwdFamily::contract(IntervalVector& box) {
+	assert(box.size()==nb_var);
+
+	int nb=nb_instances();
+	const BoolMask* imp=impact();
+
+	// the instances to be contracted
+	vector<int> active;
+	active.reserve(nb);
+	for (int k=0; k<nb; k++) {
+		bool a=(imp==NULL);
+		for (int j=0; !a && j<nb_args; j++)
+			a = var[j][k]>=0 && (*imp)[var[j][k]];
+		if (a) active.push_back(k);
+	}
+
+	if (!eval.vectorized()) {
+		for (unsigned int k=0; k<active.size(); k++)
+			contract_instance(box,active[k]);
+		return;
+	}
+
+	for (unsigned int k=0; k<active.size(); k+=block) {
+		int m=active.size()-k<(unsigned int) block ? active.size()-k : block;
+		contract_block(box,active,k,m);
+	}
+}
+
+void CtcFwdBwdFamily::contract_block(IntervalVector& box, const vector<int>& active, int k0, int m) {
+
+	// gather the arguments (by columns)
+	for (int j=0; j<nb_args; j++) {
+		const int* v=&var[j][0];
+		const Interval* x=&value[j][0];
+		Interval* in=dom[j];
+		for (int i=0; i<m; i++) {
+			int k=active[k0+i];
+			in[i] = v[k]>=0 ? box[v[k]] : x[k];
+		}
+	}
+
+	eval.forward(dom,val,m);
+
+	bool ok=true;
+	for (int i=0; i<m; i++) {
+		val[0][i] &= y[active[k0+i]];
+		ok &= !val[0][i].is_empty();
+	}
+
+	if (!ok || !eval.backward(val,dom,m)) {
+		box.set_empty();
+		throw EmptyBoxException();
+	}
+
+	// scatter the contracted domains
+	for (int j=0; j<nb_args; j++) {
+		const int* v=&var[j][0];
+		const Interval* in=dom[j];
+		for (int i=0; i<m; i++) {
+			int k=active[k0+i];
+			if (v[k]>=0) {
+				box[v[k]] &= in[i];
+				if (box[v[k]].is_empty()) {
+					box.set_empty();
+					throw EmptyBoxException();
+				}
+			}
+		}
+	}
+}
+
+void CtcFwdBwdFamily::contract_instance(IntervalVector& box, int k) {
+	IntervalVector z(nb_args);
+	for (int j=0; j<nb_args; j++)
+		z[j] = var[j][k]>=0 ? box[var[j][k]] : value[j][k];
+
+	try {
+		f.backward(y[k],z);
+	} catch (EmptyBoxException& e) {
+		box.set_empty();
+		throw e;
+	}
+
+	for (int j=0; j<nb_args; j++) {
+		if (var[j][k]>=0) {
+			box[var[j][k]] &= z[j];
+			if (box[var[j][k]].is_empty()) {
+				box.set_empty();
+				throw EmptyBoxException();
+			}
+		}
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,130 @@
+/* ============================================================================
+ * I B E X - Forward-backward contractor on a family of constraints
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CTC_FWDBWD_FAMILY_H__
+#define __IBEX_CTC_FWDBWD_FAMILY_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_BatchEval.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ * \brief Forward-backward contractor on a family of constraints with the same shape.
+ *
+ * The family is made of a real-valued function f(z) and of instances f(z_k) in y_k
+ * (k=0,1,...), where each component of z_k is either a variable of the box or a
+ * constant (a parameter of the instance). For example, the distance measurements
+ * dist(x[t],beacons[b])=d[t][b] of a SLAM problem form a family where f(a,b)=||a-b||,
+ * a is mapped to the variables x[t], b to the constants beacons[b] and y is d[t][b].
+ *
+ * The function is compiled once (see #ibex::BatchEval) and each instance only
+ * stores its mapping, its parameters and its right-hand side. The instances are
+ * contracted by blocks with HC4Revise: the forward and backward phases process
+ * each node of f for all the instances of the block at once, with the batch
+ * (vectorized) evaluation of the elementary functions. The instances of a block
+ * are contracted independently on the same box and the results are intersected,
+ * so that one call is (at most) as strong as the composition of the corresponding
+ * CtcFwdBwd; use a fixpoint (see #ibex::CtcFixPoint) to propagate the reductions.
+ *
+ * If the function cannot be evaluated by blocks (see #ibex::BatchEval), the
+ * instances are contracted one by one with Function::backward.
+ *
+ * When called with an impact (see #ibex::Ctc::contract(IntervalVector&, const BoolMask&)),
+ * only the instances with an impacted variable are contracted.
+ */
+class CtcFwdBwdFamily : public Ctc {
+public:
+	/**
+	 * \brief Create an empty family on boxes of size \a nb_var.
+	 *
+	 * \pre \a f must be real-valued. The function must not be destroyed
+	 *      before this object.
+	 */
+	CtcFwdBwdFamily(Function& f, int nb_var);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~CtcFwdBwdFamily();
+
+	/**
+	 * \brief Add the instance f(z) in y.
+	 *
+	 * The jth component of z (0<=j<f.nb_var()) is the variable of index var[j]
+	 * of the box if var[j]>=0, and the constant value[j] otherwise.
+	 * For f(z)=0 (resp. f(z)<=0), set y to 0 (resp. [-oo,0]).
+	 *
+	 * \return the number of the instance.
+	 */
+	int add(const int* var, const IntervalVector& value, const Interval& y);
+
+	/**
+	 * \brief Add the instance f(z) in y, where all the components of z
+	 * are variables of the box.
+	 */
+	int add(const int* var, const Interval& y);
+
+	/**
+	 * \brief Number of instances.
+	 */
+	int nb_instances() const;
+
+	/**
+	 * \brief Contract the box.
+	 *
+	 * \throw EmptyBoxException if one of the instances has no solution in the box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	using Ctc::contract;
+
+	/**
+	 * \brief The function.
+	 */
+	Function& f;
+
+protected:
+	/* Contract the instances active[k0..k0+m-1] by blocks */
+	void contract_block(IntervalVector& box, const std::vector<int>& active, int k0, int m);
+
+	/* Contract an instance with Function::backward */
+	void contract_instance(IntervalVector& box, int k);
+
+	BatchEval eval;
+
+	/* number of components of z */
+	int nb_args;
+
+	/* var[j][k] and value[j][k]: the jth component of z in the kth instance */
+	std::vector<std::vector<int> > var;
+	std::vector<std::vector<Interval> > value;
+
+	/* right-hand side of each instance */
+	std::vector<Interval> y;
+
+	/* workspace: values of the nodes and domains of the components of z
+	 * (one array of #block intervals for each one) */
+	int block;
+	Interval** val;
+	Interval** dom;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int CtcFwdBwdFamily::nb_instances() const {
+	return y.size();
+}
+
+} // end namespace ibex
+#endif // __IBEX_CTC_FWDBWD_FAMILY_H__
@@ -23,8 +23,8 @@ Array<Ctc> convert(const Array<NumConstraint>& csp) {
 }
 }
 
-CtcHC4::CtcHC4(const Array<NumConstraint>& csp, double ratio, bool incremental) :
-		CtcPropag(convert(csp), ratio, incremental) {
+CtcHC4::CtcHC4(const Array<NumConstraint>& csp, double ratio, bool incremental, agenda_mode mode) :
+		CtcPropag(convert(csp), ratio, incremental, mode) {
 }
 
 CtcHC4::~CtcHC4() {
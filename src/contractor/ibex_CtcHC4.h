@@ -29,8 +29,9 @@ class CtcHC4 : public CtcPropag {
    * \param csp - The CSP
    * \param ratio (optional) - \see #ibex::Propagation
    * \param incremental (optional) - \see #ibex::Propagation
+   * \param mode (optional) - Agenda, \see #ibex::CtcPropag::agenda_mode
    */
-  CtcHC4(const Array<NumConstraint>& csp, double ratio=default_ratio, bool incremental=false);
+  CtcHC4(const Array<NumConstraint>& csp, double ratio=default_ratio, bool incremental=false, agenda_mode mode=FIFO);
 
   /**
    * \brief Delete *this.
@@ -0,0 +1,31 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcHansenSengupta.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcHansenSengupta.h"
+#include "ibex_Exception.h"
+
+namespace ibex {
+
+CtcHansenSengupta::CtcHansenSengupta(const Fnc& f, double ceil, double prec, double ratio) :
+		Ctc(f.nb_var()), f(f), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio), cache(f.nb_var()),
+		certified(false), nb_certified(0) {
+
+	if (f.nb_var()!=f.image_dim()) {
+		not_implemented("Hansen-Sengupta operator with rectangular systems.");
+	}
+}
+
+void CtcHansenSengupta::contract(IntervalVector& box) {
+	certified=false;
+	if (!(box.max_diam()<=ceil)) return;
+	hansen_sengupta(f,box,cache,certified,prec,gauss_seidel_ratio);
+	if (certified) nb_certified++;
+}
+
+} // end namespace ibex
@@ -0,0 +1,60 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcHansenSengupta.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_HANSEN_SENGUPTA_H__
+#define __IBEX_CTC_HANSEN_SENGUPTA_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_Preconditioner.h"
+
+namespace ibex {
+
+/** \ingroup contractor
+ * \brief Hansen-Sengupta contractor.
+ *
+ * See #ibex::hansen_sengupta(const Fnc&, IntervalVector&, Preconditioner&, bool&, double, double).
+ *
+ * Contrary to #CtcNewton, the Jacobian matrix is used (instead of the Hansen matrix), which allows
+ * to certify the existence and uniqueness of a solution.
+ * When a box is proven to contain a unique solution, the iteration goes on
+ * until the box is not contracted anymore. So the box is typically reduced to the
+ * precision of floating-point numbers and a solver does not bisect it anymore.
+ */
+class CtcHansenSengupta : public Ctc {
+public:
+	/**
+	 * \param ceil - Criterion for applying the contractor (see #CtcNewton).
+	 * \param prec - Precision (see #ibex::newton(const Fnc&, IntervalVector&, double, double)).
+	 * \param ratio - Gauss-Seidel ratio (see #ibex::newton(const Fnc&, IntervalVector&, double, double)).
+	 */
+	CtcHansenSengupta(const Fnc& f, double ceil=CtcNewton::default_ceil, double prec=default_newton_prec,
+			double ratio=default_gauss_seidel_ratio);
+
+	void contract(IntervalVector& box);
+
+	/** The function. */
+	const Fnc& f;
+	/** Application ceiling. */
+	const double ceil;
+	/** Precision. */
+	const double prec;
+	/** Gauss-Seidel ratio. */
+	const double gauss_seidel_ratio;
+	/** Preconditioning matrix, reused from one box to the other. */
+	Preconditioner cache;
+
+	/** True if the last contracted box is proven to contain a unique solution. */
+	bool certified;
+	/** Number of certified boxes. */
+	int nb_certified;
+};
+
+} // end namespace ibex
+#endif // __IBEX_CTC_HANSEN_SENGUPTA_H__
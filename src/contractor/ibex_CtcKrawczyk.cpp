@@ -0,0 +1,31 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcKrawczyk.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcKrawczyk.h"
+#include "ibex_Exception.h"
+
+namespace ibex {
+
+CtcKrawczyk::CtcKrawczyk(const Fnc& f, double ceil, double prec) :
+		Ctc(f.nb_var()), f(f), ceil(ceil), prec(prec), cache(f.nb_var()),
+		certified(false), nb_certified(0) {
+
+	if (f.nb_var()!=f.image_dim()) {
+		not_implemented("Krawczyk operator with rectangular systems.");
+	}
+}
+
+void CtcKrawczyk::contract(IntervalVector& box) {
+	certified=false;
+	if (!(box.max_diam()<=ceil)) return;
+	krawczyk(f,box,cache,certified,prec);
+	if (certified) nb_certified++;
+}
+
+} // end namespace ibex
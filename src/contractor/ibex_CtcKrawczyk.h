@@ -0,0 +1,54 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcKrawczyk.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_KRAWCZYK_H__
+#define __IBEX_CTC_KRAWCZYK_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_CtcNewton.h"
+#include "ibex_Preconditioner.h"
+
+namespace ibex {
+
+/** \ingroup contractor
+ * \brief Krawczyk contractor.
+ *
+ * See #ibex::krawczyk(const Fnc&, IntervalVector&, Preconditioner&, bool&, double).
+ *
+ * When a box is proven to contain a unique solution, the Krawczyk iteration goes on
+ * until the box is not contracted anymore. So the box is typically reduced to the
+ * precision of floating-point numbers and a solver does not bisect it anymore.
+ */
+class CtcKrawczyk : public Ctc {
+public:
+	/**
+	 * \param ceil - Criterion for applying the contractor (see #CtcNewton).
+	 * \param prec - Precision (see #ibex::krawczyk(const Fnc&, IntervalVector&, Preconditioner&, bool&, double)).
+	 */
+	CtcKrawczyk(const Fnc& f, double ceil=CtcNewton::default_ceil, double prec=default_newton_prec);
+
+	void contract(IntervalVector& box);
+
+	/** The function. */
+	const Fnc& f;
+	/** Application ceiling. */
+	const double ceil;
+	/** Precision. */
+	const double prec;
+	/** Preconditioning matrix, reused from one box to the other. */
+	Preconditioner cache;
+
+	/** True if the last contracted box is proven to contain a unique solution. */
+	bool certified;
+	/** Number of certified boxes. */
+	int nb_certified;
+};
+
+} // end namespace ibex
+#endif // __IBEX_CTC_KRAWCZYK_H__
@@ -15,17 +15,23 @@ namespace ibex {
 
 const double CtcNewton::default_ceil = 0.01;
 
-CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio, bool sparse) :
+		Ctc(f.nb_var()), f(f), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		sparse_f(sparse? dynamic_cast<const Function*>(&f) : NULL), cache(f.nb_var()) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
 	}
+
+	if (sparse && !sparse_f) {
+		not_implemented("Sparse Newton operator with a function that is not symbolic.");
+	}
 }
 
 void CtcNewton::contract(IntervalVector& box) {
 	if (!(box.max_diam()<=ceil)) return;
-	else newton(f,box,prec,gauss_seidel_ratio);
+	else if (sparse_f) sparse_newton(*sparse_f,box,prec,gauss_seidel_ratio);
+	else newton(f,box,cache,prec,gauss_seidel_ratio);
 
 }
 
@@ -30,11 +30,15 @@ public:
 	 *  computations of the Jacobian matrix for wide boxes.
 	 *
 	 *  Default value is #default_ceil.
+	 * \param sparse - If true, the sparse variant of Newton is applied
+	 *  (see #ibex::sparse_newton(const Function&, IntervalVector&, double, double, int)).
+	 *  This requires \a f to be a Function.
 	 */
 	CtcNewton(const Fnc& f,
 			double ceil=default_ceil,
 			double prec=default_newton_prec,
-			double ratio=default_gauss_seidel_ratio);
+			double ratio=default_gauss_seidel_ratio,
+			bool sparse=false);
 
 	void contract(IntervalVector& box);
 
@@ -46,6 +50,10 @@ public:
 	const double prec;
 	/** Gauss-Seidel ratio. See #ibex::newton(const Function&, IntervalVector&, double, double);*/
 	const double gauss_seidel_ratio;
+	/** Sparse variant of Newton (NULL if the dense variant is applied). */
+	const Function* const sparse_f;
+	/** Preconditioning matrix (dense variant), reused from one box to the other. */
+	Preconditioner cache;
 
 	/** Initialized to 0.01 */
 	static const double default_ceil;
@@ -10,11 +10,47 @@
 
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_ExtendedSystem.h"
+#include "ibex_LinearRelaxCache.h"
+#include "ibex_Cell.h"
+#include "ibex_Entailment.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace ibex {
 
-CtcPolytopeHull::CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode, int max_iter, int time_out, double eps, Interval limit_diam, bool init_lp) : Ctc(lr.sys.nb_var), lr(lr), sys(lr.sys),
-		goal_var(-1), cmode(cmode), limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()) {
+namespace {
+
+// true if the value x of a variable (in a primal solution) reaches its bound b
+bool reached(double x, double b) {
+	double prec_bound = 1.e-8; // relative precision for the indicators      :  compatibility for testing  BNE
+	double delta = fabs(x-b);
+	return (fabs(b) < 1 && delta < prec_bound) || (fabs(b) >= 1 && fabs(delta/b) < prec_bound);
+}
+
+// set the entailed constraints of a linear relaxation during a linearization
+struct EntailmentScope {
+	EntailmentScope(LinearRelax& lr, const Entailment* e) : lr(lr) { lr.set_entailment(e); }
+	~EntailmentScope() { lr.set_entailment(NULL); }
+	LinearRelax& lr;
+};
+
+}
+
+const double CtcPolytopeHull::default_min_gain = 0.005;
+
+const int CtcPolytopeHull::default_tuning_calls = 50;
+
+const int CtcPolytopeHull::default_tuning_period = 1000;
+
+CtcPolytopeHull::CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode, int max_iter, int time_out, double eps, Interval limit_diam, bool init_lp, int nb_workers) : Ctc(lr.sys.nb_var),
+		reuse_ratio(LinearRelax::default_reuse_ratio), nb_lp(0), nb_simplex_iter(0), nb_warm_lp(0), nb_warm_iter(0),
+		nb_lp_skipped(0), nb_call_skipped(0), lr(lr), sys(lr.sys),
+		goal_var(-1), cmode(cmode), limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()),
+		B(1), relax_ok(false), nb_workers(nb_workers), worker_lp(NULL), pool(NULL),
+		adaptive(false), min_gain(default_min_gain), tuning_calls(default_tuning_calls), tuning_period(default_tuning_period),
+		nb_calls(0), call_gain(0), call_lp(0) {
 
 	if (dynamic_cast<const ExtendedSystem*>(&lr.sys)) {
 		(int&) goal_var=((const ExtendedSystem&) lr.sys).goal_var();
@@ -23,10 +59,83 @@ CtcPolytopeHull::CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode, int max_iter,
 	mylinearsolver = NULL;
 	if (init_lp) mylinearsolver = new LinearSolver(nb_var, lr.sys.nb_ctr, max_iter, time_out, eps);
 
+	if (this->nb_workers<=0) {
+#ifdef _OPENMP
+		this->nb_workers = omp_get_max_threads();
+#else
+		this->nb_workers = 1;
+#endif
+	}
+
+	if (this->nb_workers>1 && mylinearsolver!=NULL) {
+		worker_lp = new LinearSolver*[this->nb_workers];
+		for (int k=0; k<this->nb_workers; k++)
+			worker_lp[k] = new LinearSolver(nb_var, lr.sys.nb_ctr, max_iter, time_out, eps);
+	}
 }
 
 CtcPolytopeHull::~CtcPolytopeHull() {
 	if (mylinearsolver!=NULL) delete mylinearsolver;
+	if (worker_lp!=NULL) {
+		for (int k=0; k<nb_workers; k++) delete worker_lp[k];
+		delete[] worker_lp;
+	}
+	if (pool!=NULL) delete pool;
+}
+
+void CtcPolytopeHull::use_cut_pool(double max_parallelism, int max_age) {
+	if (pool!=NULL) delete pool;
+	pool = new CutPool(nb_var, max_parallelism, max_age);
+}
+
+void CtcPolytopeHull::use_adaptive_mode(double min_gain, int tuning_calls, int tuning_period) {
+	adaptive = true;
+	this->min_gain = min_gain;
+	this->tuning_calls = tuning_calls;
+	this->tuning_period = tuning_period;
+	nb_calls = 0;
+	sum_gain.assign(2*nb_var,0.0);
+	nb_tried.assign(2*nb_var,0);
+}
+
+double CtcPolytopeHull::predicted_gain(int i, bool lower) const {
+	int k=2*i+(lower? 0 : 1);
+	if (!adaptive || nb_tried[k]==0) return 1.0;
+	return sum_gain[k]/nb_tried[k];
+}
+
+bool CtcPolytopeHull::tuning() const {
+	return (nb_calls-1) % tuning_period < tuning_calls;
+}
+
+void CtcPolytopeHull::learn(int i, bool lower, double gain) {
+	if (!adaptive) return;
+	call_gain += gain;
+	call_lp++;
+	if (tuning()) {
+		int k=2*i+(lower? 0 : 1);
+		sum_gain[k] += gain;
+		nb_tried[k]++;
+	}
+}
+
+double CtcPolytopeHull::gain(const Interval& before, const Interval& after, bool lower) {
+	if (after.is_empty()) return 1.0;
+	double red = lower? after.lb()-before.lb() : before.ub()-after.ub();
+	if (red<=0) return 0.0;
+	if (before.diam()==POS_INFINITY) return 1.0;
+	return red/before.diam();
+}
+
+void CtcPolytopeHull::add_backtrackable(Cell& root) {
+	root.add<LinearRelaxCache>();
+	root.add<PolytopeHullGain>();
+}
+
+double CtcPolytopeHull::saved_iterations() const {
+	int nb_cold_lp=nb_lp-nb_warm_lp;
+	if (nb_cold_lp==0) return 0;
+	return ((double) (nb_simplex_iter-nb_warm_iter))/nb_cold_lp*nb_warm_lp - nb_warm_iter;
 }
 
 void CtcPolytopeHull::contract(IntervalVector& box) {
@@ -35,38 +144,109 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 	// is it necessary?  YES (BNE) Soplex can give false infeasible results with large numbers
 	//       	cout << " box before LR " << box << endl;
 
+	if (adaptive) {
+		// the previous call on the same cell (e.g., in a fixpoint) was not worth it
+		if (cell()!=NULL && cell()->has<PolytopeHullGain>()) {
+			std::map<const CtcPolytopeHull*,double>& g=cell()->get<PolytopeHullGain>().gain_per_lp;
+			std::map<const CtcPolytopeHull*,double>::const_iterator it=g.find(this);
+			if (it!=g.end() && it->second<min_gain) {
+				nb_call_skipped++;
+				return;
+			}
+		}
+		if (nb_calls % tuning_period==0) { // start of a tuning phase
+			sum_gain.assign(2*nb_var,0.0);
+			nb_tried.assign(2*nb_var,0);
+		}
+		nb_calls++;
+		call_gain=0;
+		call_lp=0;
+	}
+
+	int* inf_bound = new int[nb_var]; // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
+	int* sup_bound = new int[nb_var]; // indicator sup_bound = 1 means the sup bound is feasible or already contracted, call to simplex useless
+
+	if (init_indicators(inf_bound, sup_bound)==0 && adaptive) {
+		// all the LPs are skipped
+		nb_call_skipped++;
+		delete[] inf_bound;
+		delete[] sup_bound;
+		return;
+	}
 
 	try {
 		// Update the bounds the variables
 		mylinearsolver->initBoundVar(box);
 
 		//returns the number of constraints in the linearized system
-		int cont = lr.linearization(box,mylinearsolver);
-
-		if(cont<1)  return;
-		optimizer(box);
-
-		//	mylinearsolver->writeFile("LP.lp");
-		//		system ("cat LP.lp");
-		//		cout << " box after  LR " << box << endl;
-		mylinearsolver->cleanConst();
-
-
+		int cont = linearize(box);
+
+		if(cont>=1) {
+			store_relaxation();
+			if (worker_lp!=NULL && relax_ok)
+				parallel_optimizer(box, inf_bound, sup_bound);
+			else
+				optimizer(box, inf_bound, sup_bound);
+
+			//	mylinearsolver->writeFile("LP.lp");
+			//		system ("cat LP.lp");
+			//		cout << " box after  LR " << box << endl;
+			clean_lps();
+		}
 	}
 	catch(EmptyBoxException&) {
 		box.set_empty(); // empty the box before exiting in case of EmptyBoxException
-		mylinearsolver->cleanConst();
+		clean_lps();
+		delete[] inf_bound;
+		delete[] sup_bound;
 		throw EmptyBoxException();
 	}
 
+	delete[] inf_bound;
+	delete[] sup_bound;
+
+	if (adaptive && cell()!=NULL && cell()->has<PolytopeHullGain>())
+		cell()->get<PolytopeHullGain>().gain_per_lp[this] = call_lp>0 ? call_gain/call_lp : 0;
 }
 
-void CtcPolytopeHull::optimizer(IntervalVector& box) {
+int CtcPolytopeHull::linearize(IntervalVector& box) {
 
-	Interval opt(0.0);
-	int* inf_bound = new int[nb_var]; // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
-	int* sup_bound = new int[nb_var]; // indicator sup_bound = 1 means the sup bound is feasible or already contracted, call to simplex useless
+	LinearRelaxCache* cache=NULL;
+	if (cell()!=NULL && cell()->has<LinearRelaxCache>())
+		cache=&cell()->get<LinearRelaxCache>();
+
+	// the constraints entailed in the current cell are not linearized
+	EntailmentScope scope(lr, cell()!=NULL && cell()->has<Entailment>() ? &cell()->get<Entailment>() : NULL);
+
+	if (pool!=NULL) {
+		LinearRows rows;
+		if (lr.generate_rows(box,mylinearsolver,rows,cache,reuse_ratio)>=0) {
+			LinearRows selected;
+			pool->select(box,rows,selected);
+			if (selected.size()>0 && mylinearsolver->addConstraints(selected)==LinearSolver::OK)
+				return selected.size();
+			else
+				return 0;
+		}
+		// otherwise: the cut pool is not supported by the linear relaxation
+	}
+
+	if (cache!=NULL)
+		return lr.linearization(box,mylinearsolver,*cache,reuse_ratio);
+	else
+		return lr.linearization(box,mylinearsolver);
+}
+
+void CtcPolytopeHull::score_cuts(LinearSolver& lp) {
+	if (pool==NULL) return;
 
+	Vector primal(nb_var);
+	Vector dual(lp.getNbRows());
+	if (lp.getPrimalSol(primal)==LinearSolver::OK && lp.getDualSol(dual)==LinearSolver::OK)
+		pool->update(primal,dual);
+}
+
+int CtcPolytopeHull::init_indicators(int* inf_bound, int* sup_bound) {
 	if (cmode==ONLY_Y) {
 		for (int i=0; i<nb_var; i++) {
 			// in the case of lower_bounding, only the left bound of y is contracted
@@ -84,6 +264,22 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		if (goal_var>-1) sup_bound[goal_var]=1;
 	}
 
+	int nb=0;
+	for (int i=0; i<nb_var; i++) {
+		// adaptive mode: the LPs unlikely to reduce the box are skipped
+		if (adaptive && !tuning()) {
+			if (inf_bound[i]==0 && predicted_gain(i,true)<min_gain)  { inf_bound[i]=1; nb_lp_skipped++; }
+			if (sup_bound[i]==0 && predicted_gain(i,false)<min_gain) { sup_bound[i]=1; nb_lp_skipped++; }
+		}
+		nb += (inf_bound[i]==0) + (sup_bound[i]==0);
+	}
+	return nb;
+}
+
+void CtcPolytopeHull::optimizer(IntervalVector& box, int* inf_bound, int* sup_bound) {
+
+	Interval opt(0.0);
+
 	int nexti=-1;   // the next variable to be contracted
 	int infnexti=0; // the bound to be contracted contract  infnexti=0 for the lower bound, infnexti=1 for the upper bound
 	LinearSolver::Status_Sol stat=LinearSolver::UNKNOWN;
@@ -97,17 +293,24 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		if (infnexti==0 && inf_bound[i]==0)  // computing the left bound : minimizing x_i
 		{
 			inf_bound[i]=1;
-			stat = run_simplex(box, LinearSolver::MINIMIZE, i, opt,box[i].lb());
+			Interval before=box[i];
+			stat = run_simplex(*mylinearsolver, B, box, LinearSolver::MINIMIZE, i, opt,box[i].lb());
+			count_lp(*mylinearsolver);
+			if (stat != LinearSolver::OPTIMAL)
+				learn(i, true, stat==LinearSolver::INFEASIBLE? 1.0 : 0.0);
 			//			cout << " stat " << stat <<  " opt " << opt << endl;
 			if (stat == LinearSolver::OPTIMAL) {
+				score_cuts(*mylinearsolver);
 				if(opt.lb()>box[i].ub()) {
+					learn(i, true, 1.0);
 					throw EmptyBoxException();
 				}
 
 				if(opt.lb() > box[i].lb()) {
 					box[i]=Interval(opt.lb(),box[i].ub());
-					mylinearsolver->setBoundVar(i,box[i]);
+					update_bound(box,i);
 				}
+				learn(i, true, gain(before,box[i],true));
 
 				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
@@ -141,17 +344,24 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		else if (infnexti==1 && sup_bound[i]==0) { // computing the right bound :  maximizing x_i
 			sup_bound[i]=1;
-			stat= run_simplex(box, LinearSolver::MAXIMIZE, i, opt, box[i].ub());
+			Interval before=box[i];
+			stat= run_simplex(*mylinearsolver, B, box, LinearSolver::MAXIMIZE, i, opt, box[i].ub());
+			count_lp(*mylinearsolver);
+			if (stat != LinearSolver::OPTIMAL)
+				learn(i, false, stat==LinearSolver::INFEASIBLE? 1.0 : 0.0);
 			//			cout << " stat " << stat <<  " opt " << opt << endl;
 			if( stat == LinearSolver::OPTIMAL) {
+				score_cuts(*mylinearsolver);
 				if(opt.ub() <box[i].lb()) {
+					learn(i, false, 1.0);
 					throw EmptyBoxException();
 				}
 
 				if (opt.ub() < box[i].ub()) {
 					box[i] =Interval( box[i].lb(), opt.ub());
-					mylinearsolver->setBoundVar(i,box[i]);
+					update_bound(box,i);
 				}
+				learn(i, false, gain(before,box[i],false));
 
 				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
@@ -183,30 +393,25 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		else break; // in case of stat==MAX_ITER  we do not recall the simplex on a another variable  (for efficiency reason)
 	}
-	delete[] inf_bound;
-	delete[] sup_bound;
-
 
 }
 
-LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box,
+LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(LinearSolver& lp, IntervalVector& B, IntervalVector& box,
 		LinearSolver::Sense sense, int var, Interval& obj, double bound) {
-	int nvar=nb_var;
-	int nctr=mylinearsolver->getNbRows();
 	// the linear solver is always called in a minimization mode : in case of maximization of var , the opposite of var is minimized
 	if(sense==LinearSolver::MINIMIZE)
-		mylinearsolver->setVarObj(var, 1.0);
+		lp.setVarObj(var, 1.0);
 	else
-		mylinearsolver->setVarObj(var, -1.0);
+		lp.setVarObj(var, -1.0);
 
-	//	mylinearsolver->writeFile("coucou.lp");
+	//	lp.writeFile("coucou.lp");
 	//	system("cat coucou.lp");
-	LinearSolver::Status_Sol stat = mylinearsolver->solve();
+	LinearSolver::Status_Sol stat = lp.solve();
 	//	cout << " stat solver " << stat << endl;
 
 	if(stat == LinearSolver::OPTIMAL) {
-		if( ((sense==LinearSolver::MINIMIZE) && (  mylinearsolver->getObjValue() <=bound)) ||
-				((sense==LinearSolver::MAXIMIZE) && ((-mylinearsolver->getObjValue())>=bound))) {
+		if( ((sense==LinearSolver::MINIMIZE) && (  lp.getObjValue() <=bound)) ||
+				((sense==LinearSolver::MAXIMIZE) && ((-lp.getObjValue())>=bound))) {
 			stat = LinearSolver::UNKNOWN;
 		}
 	}
@@ -215,28 +420,15 @@ LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box,
 	if(stat == LinearSolver::OPTIMAL) {
 
 		// the dual solution : used to compute the bound
-		Vector dual_solution(mylinearsolver->getNbRows());
-		LinearSolver::Status stat_dual = mylinearsolver->getDualSol(dual_solution);
-
-		Matrix A_trans (nb_var,mylinearsolver->getNbRows()) ;
-		LinearSolver::Status stat_A = mylinearsolver->getCoefConstraint_trans(A_trans);
-
-		/*	IntervalMatrix IA_trans (nb_var,mylinearsolver->getNbRows());
-		for (int i=0;i<nvar; i++){
-		  for(int j=0; j<nctr; j++)
-		    IA_trans[i][j]= A_trans[i][j];
-		}*/
-		IntervalVector B(mylinearsolver->getNbRows());
-		LinearSolver::Status stat_B = mylinearsolver->getB(B);
+		Vector dual_solution(lp.getNbRows());
+		LinearSolver::Status stat_dual = lp.getDualSol(dual_solution);
 
 		bool minimization=false;
 		if (sense==LinearSolver::MINIMIZE)
 			minimization=true;
-		//	  cout << "B " << B << endl;
-		//	  cout << "A_trans " << IA_trans << endl;
 
-		if ((stat_dual==LinearSolver::OK) && (stat_A==LinearSolver::OK) && (stat_B==LinearSolver::OK))
-			NeumaierShcherbina_postprocessing( mylinearsolver->getNbRows(), var, obj, box, A_trans, B, dual_solution, minimization);
+		if ((stat_dual==LinearSolver::OK) && relax_ok)
+			NeumaierShcherbina_postprocessing(var, obj, box, B, dual_solution, minimization);
 		else
 			stat = LinearSolver::UNKNOWN;
 
@@ -245,68 +437,193 @@ LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box,
 	// infeasibility test  cf Neumaier Shcherbina paper
 	if(stat == LinearSolver::INFEASIBLE_NOTPROVED) {
 
-		Vector infeasible_dir(mylinearsolver->getNbRows());
-		LinearSolver::Status stat1 = mylinearsolver->getInfeasibleDir(infeasible_dir);
-
-		Matrix A_trans (nb_var,mylinearsolver->getNbRows()) ;
-		LinearSolver::Status stat2 = mylinearsolver->getCoefConstraint_trans(A_trans);
+		Vector infeasible_dir(lp.getNbRows());
+		LinearSolver::Status stat1 = lp.getInfeasibleDir(infeasible_dir);
 
-		IntervalVector B(mylinearsolver->getNbRows());
-		LinearSolver::Status stat3 = mylinearsolver->getB(B);
-
-		if ((stat1==LinearSolver::OK) && (stat2==LinearSolver::OK) && (stat3==LinearSolver::OK) &&
-				(NeumaierShcherbina_infeasibilitytest (mylinearsolver->getNbRows(), box, A_trans, B, infeasible_dir))) {
+		if ((stat1==LinearSolver::OK) && relax_ok &&
+				(NeumaierShcherbina_infeasibilitytest(box, B, infeasible_dir))) {
 			stat = LinearSolver::INFEASIBLE;
 		}
 	}
 
 	// Reset the objective of the LP solver
-	mylinearsolver->setVarObj(var, 0.0);
+	lp.setVarObj(var, 0.0);
 
 	return stat;
 
 }
 
-void CtcPolytopeHull::NeumaierShcherbina_postprocessing ( int nr, int var, Interval & obj, IntervalVector& box,
-		Matrix & A_trans, IntervalVector& B, Vector & dual_solution, bool minimization) {
+void CtcPolytopeHull::count_lp(LinearSolver& lp) {
+	nb_lp++;
+	nb_simplex_iter += lp.getNbIter();
+	if (lp.isWarmStart()) {
+		nb_warm_lp++;
+		nb_warm_iter += lp.getNbIter();
+	}
+}
+
+void CtcPolytopeHull::store_relaxation() {
+	int nr=mylinearsolver->getNbRows();
 
-	//std::cout <<" BOUND_test "<<std::endl;
-	IntervalVector Rest(nb_var);
+	Matrix A(nb_var,nr);
+	B.resize(nr);
+	relax_ok = (mylinearsolver->getCoefConstraint_trans(A)==LinearSolver::OK) &&
+			(mylinearsolver->getB(B)==LinearSolver::OK);
+	if (!relax_ok) return;
 
-	IntervalVector Lambda(nr);
+	A_trans=IntervalSparseMatrix(IntervalMatrix(A));
+}
+
+void CtcPolytopeHull::update_bound(IntervalVector& box, int i) {
+	mylinearsolver->setBoundVar(i,box[i]);
+	// the bounds of the variables are also the first rows of the LP
+	if (relax_ok) B[i]=box[i];
+}
 
-	for (int i=0; i<nr; i++) {
-		Lambda[i]=dual_solution[i];
+void CtcPolytopeHull::load_workers(IntervalVector& box) {
+	int nr=mylinearsolver->getNbRows();
+
+	// the rows of the linear constraints (A_trans is stored by columns)
+	Matrix rows(nr-nb_var, nb_var, 0.0);
+	for (int j=0; j<nb_var; j++)
+		for (int k=A_trans.row_begin(j); k<A_trans.row_end(j); k++)
+			if (A_trans.col(k)>=nb_var)
+				rows[A_trans.col(k)-nb_var][j]=A_trans.val(k).mid();
+
+	for (int w=0; w<nb_workers; w++) {
+		LinearSolver& lp=*worker_lp[w];
+		lp.initBoundVar(box);
+		for (int i=nb_var; i<nr; i++) {
+			Vector row=rows.row(i-nb_var);
+			// the rows generated by the linearization are one-sided
+			if (B[i].ub()<LinearSolver::default_max_bound)
+				lp.addConstraint(row, LEQ, B[i].ub());
+			else
+				lp.addConstraint(row, GEQ, B[i].lb());
+		}
 	}
+}
+
+void CtcPolytopeHull::clean_lps() {
+	mylinearsolver->cleanConst();
+	if (worker_lp!=NULL)
+		for (int w=0; w<nb_workers; w++)
+			worker_lp[w]->cleanConst();
+}
+
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box, int* inf_bound, int* sup_bound) {
+
+	load_workers(box);
+
+	int* task_var = new int[nb_workers];
+	bool* task_min = new bool[nb_workers];
+	LinearSolver::Status_Sol* task_stat = new LinearSolver::Status_Sol[nb_workers];
+	Interval* task_opt = new Interval[nb_workers];
+
+	bool stop=false;
 
-	Rest = A_trans * Lambda ;   // Rest = Transpose(As) * Lambda
+	try {
+		while (!stop) {
+			// a batch of (at most nb_workers) bounds to contract
+			int nb_tasks=0;
+			for (int j=0; j<nb_var && nb_tasks<nb_workers; j++) {
+				if (inf_bound[j]==0) {
+					inf_bound[j]=1;
+					task_var[nb_tasks]=j; task_min[nb_tasks++]=true;
+				}
+				if (sup_bound[j]==0 && nb_tasks<nb_workers) {
+					sup_bound[j]=1;
+					task_var[nb_tasks]=j; task_min[nb_tasks++]=false;
+				}
+			}
+			if (nb_tasks==0) break;
+
+#pragma omp parallel for
+			for (int w=0; w<nb_tasks; w++) {
+				LinearSolver& lp=*worker_lp[w];
+				int i=task_var[w];
+				lp.initBoundVar(box);
+				IntervalVector Bw(B.size());
+				if (lp.getB(Bw)!=LinearSolver::OK) {
+					task_stat[w]=LinearSolver::UNKNOWN;
+					continue;
+				}
+
+				if (task_min[w])
+					task_stat[w]=run_simplex(lp, Bw, box, LinearSolver::MINIMIZE, i, task_opt[w], box[i].lb());
+				else
+					task_stat[w]=run_simplex(lp, Bw, box, LinearSolver::MAXIMIZE, i, task_opt[w], box[i].ub());
+			}
+
+			// merge the results of the batch
+			for (int w=0; w<nb_tasks; w++) {
+				count_lp(*worker_lp[w]);
+				int i=task_var[w];
+				if (task_stat[w]!=LinearSolver::OPTIMAL)
+					learn(i, task_min[w], task_stat[w]==LinearSolver::INFEASIBLE? 1.0 : 0.0);
+
+				switch (task_stat[w]) {
+				case LinearSolver::OPTIMAL: {
+					score_cuts(*worker_lp[w]);
+					Interval bound = task_min[w] ? Interval(task_opt[w].lb(),POS_INFINITY) : Interval(NEG_INFINITY,task_opt[w].ub());
+					Interval xi = box[i] & bound;
+					learn(i, task_min[w], gain(box[i],xi,task_min[w]));
+					if (xi.is_empty()) throw EmptyBoxException();
+					if (xi!=box[i]) {
+						box[i]=xi;
+						update_bound(box,i);
+					}
+
+					// bounds reached by the primal solution cannot be contracted (cf Baharev)
+					Vector primal_solution(nb_var);
+					if (worker_lp[w]->getPrimalSol(primal_solution)==LinearSolver::OK) {
+						for (int j=0; j<nb_var; j++) {
+							if (inf_bound[j]==0 && reached(primal_solution[j],box[j].lb())) inf_bound[j]=1;
+							if (sup_bound[j]==0 && reached(primal_solution[j],box[j].ub())) sup_bound[j]=1;
+						}
+					}
+					break;
+				}
+				case LinearSolver::INFEASIBLE:
+					// the infeasibility is proved, the EmptyBox exception is raised
+					throw EmptyBoxException();
+				case LinearSolver::UNKNOWN:
+					break;
+				default:
+					// infeasibility not proved, MAX_ITER or TIME_OUT: no other call
+					stop=true;
+				}
+			}
+		}
+	}
+	catch(EmptyBoxException& e) {
+		delete[] task_var; delete[] task_min; delete[] task_stat; delete[] task_opt;
+		throw e;
+	}
+
+	delete[] task_var; delete[] task_min; delete[] task_stat; delete[] task_opt;
+}
+
+void CtcPolytopeHull::NeumaierShcherbina_postprocessing (int var, Interval & obj, IntervalVector& box,
+		IntervalVector& B, Vector & dual_solution, bool minimization) {
+
+	IntervalVector Rest = A_trans * IntervalVector(dual_solution);   // Rest = Transpose(As) * Lambda
 	if (minimization==true)
 		Rest[var] -=1; // because C is a vector of zero except for the coef "var"
 	else
 		Rest[var] +=1;
 
-	//	cout << " Rest " << Rest << endl;
-	//	cout << " dual " << Lambda << endl;
-	//	cout << " dual B " << Lambda * B << endl;
-	//	cout << " rest box " << Rest * box  << endl;
 	if(minimization==true)
-		obj = Lambda * B - Rest * box;
+		obj = dual_solution * B - Rest * box;
 	else
-		obj = -(Lambda * B - Rest * box);
+		obj = -(dual_solution * B - Rest * box);
 }
 
-bool CtcPolytopeHull::NeumaierShcherbina_infeasibilitytest(int nr, IntervalVector& box,
-		Matrix& A_trans, IntervalVector& B, Vector& infeasible_dir) {
+bool CtcPolytopeHull::NeumaierShcherbina_infeasibilitytest(IntervalVector& box, IntervalVector& B, Vector& infeasible_dir) {
 
-	IntervalVector Lambda(nr);
+	IntervalVector Rest = A_trans * IntervalVector(infeasible_dir);
 
-	for (int i =0; i<nr; i++) {
-		Lambda[i]=infeasible_dir[i];
-	}
-
-	IntervalVector Rest(nb_var);
-	Rest = A_trans * Lambda ;
-	Interval d= Rest *box - Lambda * B;
+	Interval d= Rest *box - infeasible_dir*B;
 
 	// if 0 does not belong to d, the infeasibility is proved
 
@@ -332,7 +649,6 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box,
 		// called only when a primal solution is found by the LP solver (use of primal_solution)
 
 		// double prec_bound = mylinearsolver->getEpsilon(); // relative precision for the indicators TODO change with the precision of the optimizer ??
-		double prec_bound = 1.e-8; // relative precision for the indicators      :  compatibility for testing  BNE
 		double delta=1.e100;
 		double deltaj=delta;
 
@@ -340,8 +656,7 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box,
 
 			if (inf_bound[j]==0) {
 				deltaj= fabs(primal_solution[j]- box[j].lb());
-				if ((fabs (box[j].lb()) < 1 && deltaj < prec_bound) ||
-						(fabs (box[j].lb()) >= 1 && fabs (deltaj /(box[j].lb())) < prec_bound))	{
+				if (reached(primal_solution[j], box[j].lb())) {
 					inf_bound[j]=1;
 				}
 				if (inf_bound[j]==0 && deltaj < delta) 	{
@@ -352,9 +667,7 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box,
 			if (sup_bound[j]==0) {
 				deltaj = fabs (primal_solution[j]- box[j].ub());
 
-
-				if ((fabs (box[j].ub()) < 1 && deltaj < prec_bound) 	||
-						(fabs (box[j].ub()) >= 1 && fabs (deltaj/(box[j].ub())) < prec_bound)) {
+				if (reached(primal_solution[j], box[j].ub())) {
 					sup_bound[j]=1;
 				}
 				if (sup_bound[j]==0 && deltaj < delta) {
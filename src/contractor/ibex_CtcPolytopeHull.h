@@ -14,9 +14,39 @@
 #include "ibex_Ctc.h"
 #include "ibex_LinearRelax.h"
 #include "ibex_LinearSolver.h"
+#include "ibex_IntervalSparseMatrix.h"
+#include "ibex_CutPool.h"
+#include "ibex_Backtrackable.h"
+#include <map>
 
 namespace ibex {
 
+class CtcPolytopeHull;
+
+/**
+ * \brief Gain of the last call of the polytope hull contractors on a cell.
+ *
+ * Used by the adaptive mode of #ibex::CtcPolytopeHull to detect repeated
+ * calls on the same cell. The data is not inherited by the children cells.
+ */
+class PolytopeHullGain : public Backtrackable {
+public:
+	/**
+	 * \brief Create the data of the root cell.
+	 */
+	PolytopeHullGain();
+
+	/**
+	 * \brief Create empty data for the left/right nodes
+	 */
+	std::pair<Backtrackable*,Backtrackable*> down();
+
+	/**
+	 * \brief The gain per LP of the last call of each contractor on the cell.
+	 */
+	std::map<const CtcPolytopeHull*,double> gain_per_lp;
+};
+
 /**
  * \brief Contract the bounds of a box with respect to a polytope.
  *
@@ -44,27 +74,180 @@ public:
 	 * \param timeout  - TODO: add comment
 	 * \param eps      - TODO: add comment
 	 * \param init_lp  - TODO: add comment
+	 * \param nb_workers - Number of LPs solved in parallel (each by its own copy of the LP).
+	 *                   By default (1), the LPs are solved sequentially. With 0, this is
+	 *                   the number of OpenMP threads (1 if IBEX is not compiled with OpenMP).
 	 */
 
 	CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode=ALL_BOX, int max_iter=LinearSolver::default_max_iter,
 			int time_out=LinearSolver::default_max_time_out, double eps=LinearSolver::default_eps,
-			Interval limit_diam=LinearSolver::default_limit_diam_box, bool init_lp=true);
+			Interval limit_diam=LinearSolver::default_limit_diam_box, bool init_lp=true, int nb_workers=1);
 
 	virtual void contract(IntervalVector& box);
 
+	using Ctc::contract; // contract(Cell&)
+
+	/**
+	 * \brief Add a #ibex::LinearRelaxCache and a #ibex::PolytopeHullGain to the root cell.
+	 *
+	 * When the contractor is called on a cell, the linearization of the
+	 * constraints is then incremental: the rows computed in a node are stored
+	 * in the cell and reused by the descendants as long as the domains of
+	 * the variables do not shrink significantly (see #reuse_ratio).
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	virtual ~CtcPolytopeHull();
 
+	/**
+	 * \brief Ratio for reusing the cached linearization of a constraint.
+	 *
+	 * See #ibex::LinearRelax::linearization(IntervalVector&, LinearSolver*, LinearRelaxCache&, double).
+	 * Default value: LinearRelax::default_reuse_ratio.
+	 */
+	double reuse_ratio;
+
+	/**
+	 * \brief Filter the rows of the relaxation with a cut pool.
+	 *
+	 * The rows generated by the linear relaxation are given to a #ibex::CutPool,
+	 * that removes the redundant and nearly parallel ones and keeps the useful rows
+	 * from one call to the other, as long as the box is included in the box they have
+	 * been generated on (e.g., in a fixpoint loop with other contractors).
+	 * Requires a linear relaxation that implements LinearRelax::linearization_ctr(...).
+	 */
+	void use_cut_pool(double max_parallelism=CutPool::default_max_parallelism, int max_age=CutPool::default_max_age);
+
+	/**
+	 * \brief The cut pool (NULL if not used).
+	 */
+	const CutPool* cut_pool() const;
+
+	/**
+	 * \brief Adaptive mode.
+	 *
+	 * The contractor learns, for each variable and each side (lower/upper bound), the mean
+	 * gain of the corresponding LP, i.e., the reduction of the bound relative to the
+	 * diameter of the domain (1 if the LP proves the box infeasible).
+	 * As in #ibex::CtcAcid, the search alternates:
+	 * <ul>
+	 * <li> tuning phases of \a tuning_calls calls, where all the LPs are solved and the gains recorded;
+	 * <li> running phases (until \a tuning_period calls since the start of the tuning phase),
+	 *      where the LP of a bound is skipped if its mean gain in the last tuning phase is less than \a min_gain.
+	 * </ul>
+	 * Furthermore, when the contractor is called several times on the same cell (e.g., in a fixpoint
+	 * loop, see #contract(Cell&)), the call is skipped if the gain per LP of the previous call
+	 * was less than \a min_gain: the other contractors of the fixpoint then usually stop the loop.
+	 * This requires the #ibex::PolytopeHullGain data in the cell (see #add_backtrackable(Cell&)).
+	 */
+	void use_adaptive_mode(double min_gain=default_min_gain, int tuning_calls=default_tuning_calls, int tuning_period=default_tuning_period);
+
+	/**
+	 * \brief Mean gain of the LP of a bound in the last tuning phase (1 if never solved).
+	 *
+	 * \param lower - true for the lower bound of x_i, false for the upper one.
+	 */
+	double predicted_gain(int i, bool lower) const;
+
+	/** Default minimal gain of an LP in adaptive mode (0.005) */
+	static const double default_min_gain;
+
+	/** Default number of calls of a tuning phase in adaptive mode (50) */
+	static const int default_tuning_calls;
+
+	/** Default number of calls between two tuning phases in adaptive mode (1000) */
+	static const int default_tuning_period;
+
+	/**
+	 * \brief Estimated number of simplex iterations saved by the warm starts.
+	 *
+	 * This is the mean number of iterations of a cold-started LP times the
+	 * number of warm-started LPs, minus the iterations of the warm-started LPs.
+	 */
+	double saved_iterations() const;
+
+	/** Number of LPs solved */
+	int nb_lp;
+
+	/** Total number of simplex iterations */
+	int nb_simplex_iter;
+
+	/**
+	 * Number of LPs started from the basis of a previous LP: the previous
+	 * objective in the same contraction, or the last LP of the previous
+	 * contraction when the relaxation has the same number of constraints
+	 * (see #LinearSolver::isWarmStart()).
+	 */
+	int nb_warm_lp;
+
+	/** Number of simplex iterations of the warm-started LPs */
+	int nb_warm_iter;
+
+	/** Number of LPs skipped in adaptive mode */
+	int nb_lp_skipped;
+
+	/** Number of calls skipped in adaptive mode */
+	int nb_call_skipped;
+
 protected:
 
+	/**
+	 * \brief Generate the rows of the linear relaxation on the box
+	 * and add them to the LP. Return the number of rows.
+	 */
+	int linearize(IntervalVector& box);
+
+	/**
+	 * \brief Score the rows of the cut pool with the last optimum of \a lp.
+	 */
+	void score_cuts(LinearSolver& lp);
+
+	/**
+	 * \brief True if the current call is in a tuning phase (adaptive mode).
+	 */
+	bool tuning() const;
+
+	/**
+	 * \brief Record the gain of the LP of a bound (adaptive mode).
+	 */
+	void learn(int i, bool lower, double gain);
+
+	/**
+	 * \brief Gain of the LP of a bound, from the domains before and after.
+	 */
+	static double gain(const Interval& before, const Interval& after, bool lower);
+
+	/**
+	 * Store the rows of the LP (generated by the linearization)
+	 * in #A_trans and #B. Called once per linearization.
+	 */
+	void store_relaxation();
+
+	/**
+	 * Update the bounds of the ith variable in the LP (and in #B).
+	 */
+	void update_bound(IntervalVector& box, int i);
+
+	/**
+	 * Copy the bounds of the box and the linear constraints of the LP into the
+	 * LPs of the workers.
+	 */
+	void load_workers(IntervalVector& box);
+
+	/**
+	 * Remove the linear constraints of the LP and of the LPs of the workers.
+	 */
+	void clean_lps();
+
 	/**
 	 * Neumaier Shcherbina postprocessing in case of optimal solution found : the result obj is made reliable
 	 */
-	void NeumaierShcherbina_postprocessing(int nr, int var, Interval & obj, IntervalVector& box, Matrix & As, IntervalVector& B,  Vector &dual_solution, bool minimization);
+	void NeumaierShcherbina_postprocessing(int var, Interval & obj, IntervalVector& box, IntervalVector& B, Vector &dual_solution, bool minimization);
 
 	/**
 	 *  Neumaier Shcherbina postprocessing in case of infeasibilty found by LP  returns true if the infeasibility is proved
 	 */
-	bool NeumaierShcherbina_infeasibilitytest(int nr, IntervalVector& box, Matrix & As, IntervalVector& B, Vector & infeasible_dir);
+	bool NeumaierShcherbina_infeasibilitytest(IntervalVector& box, IntervalVector& B, Vector & infeasible_dir);
 
 	/**
 	 * Achterberg heuristic for choosing the next variable  and which bound to optimize
@@ -72,14 +255,32 @@ protected:
 	bool choose_next_variable(IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
 
 	/**
-	 * Call to linear solver
+	 * Call to linear solver lp, where B are the bounds of the rows of lp
 	 */
-	LinearSolver::Status_Sol run_simplex(IntervalVector &box, LinearSolver::Sense sense, int var, Interval & obj, double bound);
+	LinearSolver::Status_Sol run_simplex(LinearSolver& lp, IntervalVector& B, IntervalVector &box, LinearSolver::Sense sense, int var, Interval & obj, double bound);
+
+	/**
+	 * Update the statistics with the last resolution of lp
+	 */
+	void count_lp(LinearSolver& lp);
+
+	/**
+	 * Initialize the indicators of the bounds to be contracted
+	 * and return the number of bounds to be contracted
+	 * (in adaptive mode, the bounds unlikely to be reduced are skipped).
+	 */
+	int init_indicators(int* inf_bound, int* sup_bound);
 
 	/**
 	 * TODO: add comment
 	 */
-	void optimizer(IntervalVector &box);
+	void optimizer(IntervalVector &box, int* inf_bound, int* sup_bound);
+
+	/**
+	 * Parallel version of #optimizer: the LPs are solved by batches of
+	 * #nb_workers LPs; the box is updated between two batches.
+	 */
+	void parallel_optimizer(IntervalVector &box, int* inf_bound, int* sup_bound);
 
 	/**
 	 * \brief The linearization technique
@@ -113,9 +314,76 @@ protected:
 	 */
 	LinearSolver *mylinearsolver;
 
+	/**
+	 * \brief Transpose of the matrix of the LP (bound constraints of
+	 * the variables and linear constraints), in sparse form.
+	 */
+	IntervalSparseMatrix A_trans;
+
+	/**
+	 * \brief Bounds of the rows of the LP.
+	 */
+	IntervalVector B;
 
+	/**
+	 * \brief False if the linear constraints could not be retrieved from the LP solver
+	 * (the results of the LPs cannot be made reliable).
+	 */
+	bool relax_ok;
+
+	/**
+	 * \brief Number of LPs solved in parallel.
+	 */
+	int nb_workers;
+
+	/**
+	 * \brief The LPs of the workers (NULL if nb_workers==1).
+	 */
+	LinearSolver** worker_lp;
+
+	/**
+	 * \brief The cut pool (NULL if not used).
+	 */
+	CutPool* pool;
+
+	/** Adaptive mode? */
+	bool adaptive;
+
+	/** Parameters of the adaptive mode (see #use_adaptive_mode(double,int,int)) */
+	double min_gain;
+	int tuning_calls;
+	int tuning_period;
+
+	/** Number of calls (adaptive mode) */
+	int nb_calls;
+
+	/**
+	 * Sum of the gains and number of LPs solved for each bound
+	 * (the lower bound of x_i at 2i, the upper bound at 2i+1)
+	 * in the current or last tuning phase.
+	 */
+	std::vector<double> sum_gain;
+	std::vector<int> nb_tried;
+
+	/** Gain and number of LPs of the current call */
+	double call_gain;
+	int call_lp;
 
 };
 
+/*================================== inline implementations ========================================*/
+
+inline PolytopeHullGain::PolytopeHullGain() {
+
+}
+
+inline std::pair<Backtrackable*,Backtrackable*> PolytopeHullGain::down() {
+	return std::pair<Backtrackable*,Backtrackable*>(new PolytopeHullGain(),new PolytopeHullGain());
+}
+
+inline const CutPool* CtcPolytopeHull::cut_pool() const {
+	return pool;
+}
+
 } // end namespace ibex
 #endif // __IBEX_CTC_POLYTOPE_HULL_H__
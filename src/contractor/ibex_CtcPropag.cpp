@@ -21,10 +21,11 @@ namespace ibex {
 /*! Default propagation ratio. */
 #define __IBEX_DEFAULT_RATIO_PROPAG           0.01
 
-CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
-		  Ctc(cl[0].nb_var), list(cl), ratio(ratio), incremental(incremental),
-		  accumulate(false), g(cl.size(), cl[0].nb_var), agenda(cl.size()),
-		  _impact(nb_var), flags(Ctc::NB_OUTPUT_FLAGS), active(cl.size()) {
+CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental, agenda_mode mode) :
+		  Ctc(cl[0].nb_var), list(cl), ratio(ratio), incremental(incremental), mode(mode),
+		  accumulate(false), nb_revise(cl.size(),0), nb_reduce(cl.size(),0),
+		  g(cl.size(), cl[0].nb_var), agenda(cl.size()), priority_agenda(cl.size()), cost(cl.size()),
+		  _impact(cl.size(),BoolMask(nb_var)), flags(Ctc::NB_OUTPUT_FLAGS), active(cl.size()) {
 
 	for (int i=1; i<list.size(); i++)
 		assert(list[i].nb_var==nb_var);
@@ -35,20 +36,80 @@ CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
 		}
 
+	for (int i=0; i<list.size(); i++) {
+		cost[i]=g.input_vars(i).size();
+		if (cost[i]==0) cost[i]=1;
+	}
+
+	// the input (resp. output) variables are those of the sub-contractors,
+	// if all of them are specified
+	bool specified=true;
+	for (int i=0; i<list.size(); i++)
+		specified &= list[i].input!=NULL && list[i].output!=NULL;
+
+	if (specified) {
+		input = new BoolMask(nb_var);
+		output = new BoolMask(nb_var);
+		input->unset_all();
+		output->unset_all();
+		for (int i=0; i<list.size(); i++)
+			for (int j=0; j<nb_var; j++) {
+				if ((*list[i].input)[j]) input->set(j);
+				if ((*list[i].output)[j]) output->set(j);
+			}
+	}
+
 //	cout << g << endl;
 }
 
-void  CtcPropag::contract(IntervalVector& box) {
+CtcPropag::~CtcPropag() {
+	if (input) {
+		delete input;
+		delete output;
+	}
+}
+
+void CtcPropag::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
+void CtcPropag::push(int c, double reduction) {
+	if (mode==FIFO)
+		agenda.push(c);
+	else {
+		// effectiveness: proportion of useful calls (with a neutral prior of 1/2)
+		double eff=(1.0+nb_reduce[c])/(2.0+nb_revise[c]);
+		priority_agenda.push(c, reduction*eff/cost[c]);
+	}
+}
+
+void CtcPropag::pop(int& c) {
+	if (mode==FIFO) agenda.pop(c);
+	else priority_agenda.pop(c);
+}
+
+int CtcPropag::revise_count() const {
+	int n=0;
+	for (int i=0; i<list.size(); i++) n+=nb_revise[i];
+	return n;
+}
+
+void CtcPropag::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
+bool CtcPropag::try_contract(IntervalVector& box) {
 
 	/*
-	 * When we call a contractor, we assume all
-	 * its variables have been impacted although there might be
-	 * only one of them impacted. In a future version, we may
-	 * consider a more fine propagation where the information
-	 * about the variables that are actually impacted is
-	 * given to the awaken contractor.
+	 * The first time a contractor is called, we assume all
+	 * its variables have been impacted (the box may have been
+	 * modified in any way since its last call). Then, it
+	 * is only given the variables reduced by the other
+	 * contractors in the meantime.
 	 */
-	_impact.set_all();
+	for (int i=0; i<list.size(); i++)
+		_impact[i].set_all();
 
 	// By default, all contractors are active
 	active.set_all();
@@ -72,12 +133,12 @@ void  CtcPropag::contract(IntervalVector& box) {
 			if (!impact() || (*impact())[i]) {
 				set<int> ctrs=g.output_ctrs(i);
 				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
-					agenda.push(*c);
+					push(*c,1.0);
 			}
 		}
 	} else { // push all the contractors
 		for (int i=0; i<list.size(); i++)
-			agenda.push(i);
+			push(i,1.0);
 	}
 
 	int c; // current contractor
@@ -95,9 +156,9 @@ void  CtcPropag::contract(IntervalVector& box) {
 	//     if (thres(i)<w) thres(i)=w;
 	//   }
 	//cout << "=========== Start propagation ==========" << endl;
-	while (!agenda.empty()) {
+	while (!agenda.empty() || !priority_agenda.empty()) {
 
-		agenda.pop(c);
+		pop(c);
 
 		set<int> vars=g.output_vars(c);
 
@@ -112,31 +173,37 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 		//cout << "Contraction with " << c << endl;
 
-		try {
-			list[c].contract(box, _impact, flags);
-			if (flags[INACTIVE]) {
-				active[c]=false;
-			}
-		}
-		catch (EmptyBoxException& e) {
+		nb_revise[c]++;
+
+		if (!try_subcontract(list[c], box, _impact[c], flags)) {
 			agenda.flush();
+			priority_agenda.flush();
 			//cout << "=========== End propagation ==========" << endl;
 			//cout << "   empty!" << endl;
-			throw e;
+			return false;
+		}
+		_impact[c].unset_all();
+		if (flags[INACTIVE]) {
+			active[c]=false;
 		}
 
 		//cout << "  =>" << box[v] << endl;
 		//cout << agenda << endl;
 
+		bool reduced=false;
+
 		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
 			int v=*it;
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
-			if (old_box[v].ratiodelta(box[v])>=ratio) {
+			double reduction=old_box[v].ratiodelta(box[v]);
+			if (reduction>=ratio) {
+				reduced=true;
 				set<int> ctrs=g.output_ctrs(v);
 				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+					if (c!=*c2) _impact[*c2].set(v);
 					if ((c!=*c2 && active[*c2]) || (c==*c2 && !flags[FIXPOINT]))
-						agenda.push(*c2);
+						push(*c2,reduction);
 				}
 				// ===================== coarse propagation =========================
 				// reset the old box to the current domains just after propagation
@@ -145,6 +212,8 @@ void  CtcPropag::contract(IntervalVector& box) {
 				// ================================================================
 			}
 		}
+
+		if (reduced) nb_reduce[c]++;
 	}
 	//cout << "=========== End propagation ==========" << endl;
 	/* we cancel the "residual" contractions
@@ -154,6 +223,7 @@ void  CtcPropag::contract(IntervalVector& box) {
 	 * small w.r.t the ratio here. */
 	//   if (!reducted) box = propbox; // restore domains
 
+	return true;
 }
 
 const double CtcPropag::default_ratio = __IBEX_DEFAULT_RATIO_PROPAG;
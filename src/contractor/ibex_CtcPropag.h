@@ -13,9 +13,11 @@
 #define __IBEX_CTC_PROPAG_H__
 
 #include "ibex_Agenda.h"
+#include "ibex_PriorityAgenda.h"
 #include "ibex_Ctc.h"
 #include "ibex_DirectedHyperGraph.h"
 #include "ibex_Array.h"
+#include <vector>
 
 namespace ibex {
 
@@ -31,6 +33,20 @@ namespace ibex {
 class CtcPropag : public Ctc {
 public:
 
+	/**
+	 * \brief Order in which the contractors of the agenda are called.
+	 *
+	 * <ul>
+	 * <li> FIFO:     first in, first out (the classical AC3 agenda).
+	 * <li> PRIORITY: the contractor with the highest priority first. The priority of a contractor
+	 *                is the largest relative reduction (see Interval::ratiodelta) of the domains that
+	 *                have triggered it, multiplied by its historical effectiveness (the proportion of
+	 *                its calls that have reduced a domain by more than #ratio) and divided by its cost
+	 *                (its number of input variables).
+	 * </ul>
+	 */
+	typedef enum { FIFO, PRIORITY } agenda_mode;
+
 	/**
 	 * \brief Create a AC3-like propagation with a list of contractors.
 	 *
@@ -40,10 +56,16 @@ public:
 	 *                           reduction is not propagated. The default value is #default_ratio.
 	 * \param incr (optional)  - Whether the propagation works incrementally. This parameter is
 	 *                           only used when contraction is called with an "impact" bool mask.
+	 * \param mode (optional)  - Agenda (see #agenda_mode). By default: FIFO.
 	 *
 	 * \see #contract(IntervalVector&, const BoolMask&).
 	 */
-	CtcPropag(const Array<Ctc>& cl, double ratio=default_ratio, bool incr=false);
+	CtcPropag(const Array<Ctc>& cl, double ratio=default_ratio, bool incr=false, agenda_mode mode=FIFO);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~CtcPropag();
 
 	/**
 	 * \brief Enforces propagation (e.g.: HC4 or BOX) fitering.
@@ -58,6 +80,29 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	using Ctc::contract; // contract(Cell&)
+
+	/**
+	 * \brief Enforces propagation, without EmptyBoxException.
+	 *
+	 * The sub-contractors are called with #ibex::Ctc::try_contract(IntervalVector&, const BoolMask&, BoolMask&).
+	 *
+	 * \see #contract(IntervalVector&).
+	 * \return false iff inconsistency is detected.
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
+	using Ctc::try_contract; // try_contract(IntervalVector&, const BoolMask&)
+
+	/**
+	 * \brief Add the backtrackable data required by the sub-contractors.
+	 *
+	 * When the propagation is called with a cell, the cell is transmitted to the
+	 * sub-contractors. In particular, the constraints entailed in the cell are
+	 * skipped (see #ibex::Entailment).
+	 */
+	virtual void add_backtrackable(Cell& root);
+
 	/** The list of contractors to propagate */
 	Array<Ctc> list;
 
@@ -67,9 +112,21 @@ public:
 	/** Agenda initialization mode (see \link CtcPropag(const Array<Ctc>&, double, bool) constructor \endlink for details).*/
 	const bool incremental;
 
+	/** Agenda mode (see \link CtcPropag(const Array<Ctc>&, double, bool, agenda_mode) constructor \endlink for details).*/
+	const agenda_mode mode;
+
 	/** Accumulate residual contractions? */
 	bool accumulate;
 
+	/** Number of calls to each contractor (since the creation of *this). */
+	std::vector<int> nb_revise;
+
+	/** Number of calls to each contractor that have reduced a domain by more than #ratio. */
+	std::vector<int> nb_reduce;
+
+	/** Total number of calls to the contractors (since the creation of *this). */
+	int revise_count() const;
+
 	/** Default ratio used by propagation, set to 0.1. */
 	static const double default_ratio;
 
@@ -79,7 +136,20 @@ protected:
 
 	Agenda agenda;
 
-	BoolMask _impact; // impact given to sub-contractors
+	PriorityAgenda priority_agenda; // agenda in PRIORITY mode
+
+	/* Push the contractor c, triggered by a relative reduction "reduction" of one of its variables */
+	void push(int c, double reduction);
+
+	/* Pop the next contractor */
+	void pop(int& c);
+
+	/* Cost of each contractor (number of input variables) */
+	std::vector<int> cost;
+
+	/* Impact given to each sub-contractor: the variables that have been reduced
+	 * (by more than #ratio) since its last call */
+	std::vector<BoolMask> _impact;
 
 	BoolMask flags;   // status of a contraction
 
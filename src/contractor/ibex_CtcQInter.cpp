@@ -14,8 +14,8 @@
 
 namespace ibex {
 
-CtcQInter::CtcQInter(const Array<Ctc>& list, int q) : Ctc(list[0].nb_var), list(list),
-		n(list[0].nb_var), q(q), boxes(list.size(), n) {
+CtcQInter::CtcQInter(const Array<Ctc>& list, int q, qinter_algo algo) : Ctc(list[0].nb_var), list(list),
+		n(list[0].nb_var), q(q), algo(algo), parallel(false), boxes(list.size(), n) {
 
 	for (int i=0; i<list.size(); i++) {
 		assert(list[i].nb_var==n);
@@ -23,19 +23,39 @@ CtcQInter::CtcQInter(const Array<Ctc>& list, int q) : Ctc(list[0].nb_var), list(
 }
 
 void CtcQInter::contract(IntervalVector& box) {
-	Array<IntervalVector> refs(list.size());
+	int p=list.size();
+	Array<IntervalVector> refs(p);
 
-	for (int i=0; i<list.size(); i++) {
+	#pragma omp parallel for if(parallel)
+	for (int i=0; i<p; i++) {
 		try {
 			boxes[i]=box;
 			list[i].contract(boxes[i]);
 		} catch(EmptyBoxException&) {
-			assert(boxes[i].is_empty());
+			boxes[i].set_empty();
 		}
-		refs.set_ref(i,boxes[i]);
 	}
 
-	box = qinter(refs,q);
+	for (int i=0; i<p; i++)
+		refs.set_ref(i,boxes[i]);
+
+	switch (algo) {
+	case GRID:
+		box = qinter(refs,q);
+		break;
+	case PROJ:
+		box = qinter_projf(refs,q);
+		break;
+	case PROJ_GRID:
+		box = qinter_projf(refs,q);
+		if (!box.is_empty()) {
+			// q-intersection of the boxes that intersect the enclosure
+			for (int i=0; i<p; i++)
+				boxes[i] &= box;
+			box = qinter(refs,q);
+		}
+		break;
+	}
 
 	if (box.is_empty()) throw EmptyBoxException();
 }
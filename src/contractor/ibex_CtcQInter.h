@@ -24,12 +24,27 @@ namespace ibex {
  */
 class CtcQInter : public Ctc {
 public:
+	/**
+	 * \brief Algorithm for the q-intersection of the contracted boxes.
+	 *
+	 * <ul>
+	 * <li> GRID:        the hull of the q-intersection (see #ibex::qinter). Exponential in the dimension.
+	 * <li> PROJ:        a box enclosing the q-intersection, obtained by projections (see #ibex::qinter_projf).
+	 *                   Polynomial in the dimension and the number of boxes.
+	 * <li> PROJ_GRID:   PROJ then GRID on the boxes that intersect the result of PROJ (which is usually much
+	 *                   cheaper than GRID alone). The result is the hull of the q-intersection.
+	 * </ul>
+	 */
+	typedef enum { GRID, PROJ, PROJ_GRID } qinter_algo;
+
 	/**
 	 * \brief q-intersection on a list of contractors.
 	 *
 	 * The list itself is not kept by reference.
+	 *
+	 * \param algo (optional) - see #qinter_algo. By default: GRID.
 	 */
-	CtcQInter(const Array<Ctc>& list, int q);
+	CtcQInter(const Array<Ctc>& list, int q, qinter_algo algo=GRID);
 
 	/**
 	 * \brief Contract the box.
@@ -52,6 +67,19 @@ public:
 	 */
 	int q;
 
+	/**
+	 * The q-intersection algorithm.
+	 */
+	qinter_algo algo;
+
+	/**
+	 * \brief Contract with the sub-contractors in parallel (by default: false).
+	 *
+	 * Only used when IBEX is compiled with OpenMP. The sub-contractors must not share any data
+	 * (in particular, not the same function).
+	 */
+	bool parallel;
+
 protected:
 	IntervalMatrix boxes; // store boxes for each contraction
 };
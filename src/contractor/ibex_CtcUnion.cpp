@@ -12,42 +12,99 @@
 
 namespace ibex {
 
-CtcUnion::CtcUnion(const Array<Ctc>& list) : Ctc(list[0].nb_var), list(list) {
+CtcUnion::CtcUnion(const Array<Ctc>& list) : Ctc(list[0].nb_var), list(list), parallel(false), trail(nb_var) {
 	for (int i=1; i<list.size(); i++) {
 		assert(list[i].nb_var==nb_var);
 	}
+	init();
 }
 
-CtcUnion::CtcUnion(Ctc& c1, Ctc& c2) : Ctc(c1.nb_var), list(2) {
+CtcUnion::CtcUnion(Ctc& c1, Ctc& c2) : Ctc(c1.nb_var), list(2), parallel(false), trail(c1.nb_var) {
 	list.set_ref(0,c1);
 	assert(c2.nb_var==nb_var);
 	list.set_ref(1,c2);
+	init();
 }
 
-CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3) : Ctc(c1.nb_var), list(3) {
+CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3) : Ctc(c1.nb_var), list(3), parallel(false), trail(c1.nb_var) {
 	list.set_ref(0,c1);
 	assert(c2.nb_var==nb_var);
 	list.set_ref(1,c2);
 	assert(c3.nb_var==nb_var);
 	list.set_ref(2,c3);
+	init();
+}
+
+void CtcUnion::init() {
+	for (int j=0; j<nb_var; j++) {
+		int i=0;
+		while (i<list.size() && list[i].output && !(*list[i].output)[j]) i++;
+		if (i<list.size()) output_vars.push_back(j);
+	}
 }
 
 
 void CtcUnion::contract(IntervalVector& box) {
-	IntervalVector savebox(box);
-	IntervalVector result(IntervalVector::empty(box.size()));
+	if (parallel) {
+		parallel_contract(box);
+		return;
+	}
+
+	// Only the output variables of the sub-contractors are restored
+	// between two sub-contractors and hulled.
+	trail.reset(box);
+	std::vector<Interval> hull(output_vars.size(), Interval::EMPTY_SET);
+	bool empty=true;
 
+	trail.checkpoint();
 	for (int i=0; i<list.size(); i++) {
-		if (i>0) box=savebox;
+		trail.save(output_vars);
 		try {
 			list[i].contract(box);
-			result |= box;
+			if (!box.is_empty()) {
+				for (unsigned int k=0; k<output_vars.size(); k++)
+					hull[k] |= box[output_vars[k]];
+				empty=false;
+			}
+		}
+		catch(EmptyBoxException&) {
+		}
+		trail.undo();
+	}
+	trail.commit();
+
+	if (empty) {
+		box.set_empty();
+		throw EmptyBoxException();
+	}
+	for (unsigned int k=0; k<output_vars.size(); k++)
+		box[output_vars[k]] = hull[k];
+}
+
+void CtcUnion::parallel_contract(IntervalVector& box) {
+	int n=list.size();
+	Array<IntervalVector> boxes(n);
+	for (int i=0; i<n; i++)
+		boxes.set_ref(i,*new IntervalVector(box));
+
+	#pragma omp parallel for
+	for (int i=0; i<n; i++) {
+		try {
+			list[i].contract(boxes[i]);
 		}
 		catch(EmptyBoxException&) {
+			boxes[i].set_empty();
 		}
 	}
+
+	IntervalVector result(IntervalVector::empty(box.size()));
+	for (int i=0; i<n; i++) {
+		if (!boxes[i].is_empty()) result |= boxes[i];
+		delete &boxes[i];
+	}
+
 	box = result;
 	if (box.is_empty()) throw EmptyBoxException();
-} // end namespace ibex
-
 }
+
+} // end namespace ibex
@@ -13,6 +13,9 @@
 
 #include "ibex_Array.h"
 #include "ibex_Ctc.h"
+#include "ibex_IntervalVectorTrail.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -64,6 +67,30 @@ public:
 	 * \brief The list of sub-contractors.
 	 */
 	Array<Ctc> list;
+
+	/**
+	 * \brief Parallel mode (by default: false).
+	 *
+	 * If true, the sub-contractors are called concurrently, each on its own
+	 * copy of the box. They must not share any data (e.g., the same function).
+	 */
+	bool parallel;
+
+protected:
+	/**
+	 * \brief Contract a box in parallel mode.
+	 */
+	void parallel_contract(IntervalVector& box);
+
+private:
+	void init();
+
+	/* the variables that are output of at least one sub-contractor
+	 * (all the variables if one output is unspecified) */
+	std::vector<int> output_vars;
+
+	/* restores the box between two sub-contractors */
+	IntervalVectorTrail trail;
 };
 
 } // end namespace ibex
@@ -15,6 +15,7 @@
 #include "ibex_Affine2MatrixArray.h"
 #include "ibex_EmptyBoxException.h"
 #include "ibex_FwdAlgorithm.h"
+#include "ibex_CompensatedArith.h"
 
 namespace ibex {
 
@@ -52,6 +53,7 @@ public:
 	void symbol_fwd(const ExprSymbol&, ExprLabel& y);
 	void apply_fwd(const ExprApply&, ExprLabel** x, ExprLabel& y);
 	void chi_fwd(const ExprChi&, const ExprLabel& x1, const ExprLabel& x2, const ExprLabel& x3, ExprLabel& y);
+	void sum_fwd(const ExprSum&, const ExprLabel** x, ExprLabel& y);
 	void add_fwd(const ExprAdd&, const ExprLabel& x1, const ExprLabel& x2, ExprLabel& y);
 	void mul_fwd(const ExprMul&, const ExprLabel& x1, const ExprLabel& x2, ExprLabel& y);
 	void sub_fwd(const ExprSub&, const ExprLabel& x1, const ExprLabel& x2, ExprLabel& y);
@@ -146,6 +148,11 @@ inline void Affine2Eval::chi_fwd(const ExprChi&,  const ExprLabel& x1, const Exp
 	y.af2->i()=chi(x1.d->i(),x2.af2->i(),x3.af2->i());
 	y.d->i()  =chi(x1.d->i(),x2.d->i(),x3.d->i());
 }
+inline void Affine2Eval::sum_fwd(const ExprSum& s, const ExprLabel** x, ExprLabel& y)                   {
+	y.af2->i()=x[0]->af2->i();
+	for (int i=1; i<s.nb_args; i++) y.af2->i()+=x[i]->af2->i();
+	y.d->i()=(y.af2->i().itv() & sum_terms(LabelDomains((ExprLabel**) x),s.nb_args));
+}
 inline void Affine2Eval::add_fwd(const ExprAdd&, const ExprLabel& x1, const ExprLabel& x2, ExprLabel& y)     {
 	y.af2->i()=x1.af2->i()+x2.af2->i();
 	y.d->i()=(y.af2->i().itv() & (x1.d->i()+x2.d->i()));
@@ -0,0 +1,240 @@
+/* ============================================================================
+ * I B E X - Evaluation of a function over a batch of boxes
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_BatchEval.h"
+#include "ibex_BatchArith.h"
+#include "ibex_Expr.h"
+#include "ibex_NodeMap.h"
+
+namespace ibex {
+
+namespace {
+
+/* number of boxes evaluated simultaneously (the values of all
+ * the nodes for a block must fit in the cache) */
+const int EVAL_BLOCK = 32*BATCH_BLOCK_SIZE;
+
+}
+
+BatchEval::BatchEval(const Function& f) : f(f), n(0), code(NULL), arg(NULL), cst(NULL) {
+	assert(f.expr().dim.is_scalar());
+	compile();
+}
+
+BatchEval::~BatchEval() {
+	if (code) {
+		delete[] code;
+		delete[] arg;
+		delete[] cst;
+	}
+}
+
+void BatchEval::compile() {
+
+	// index of the first component of each argument in the boxes
+	int* first=new int[f.nb_arg()];
+	for (int a=0, j=0; a<f.nb_arg(); a++) {
+		const Dim& d=f.arg(a).dim;
+		if (!d.is_scalar() && !d.is_vector()) { delete[] first; return; }
+		first[a]=j;
+		j+=d.size();
+	}
+
+	int size=f.nb_nodes();
+
+	NodeMap<int> index;
+	for (int i=0; i<size; i++)
+		index.insert(f.node(i),i);
+
+	code = new operation[size];
+	arg  = new int[size][2];
+	cst  = new Interval[size];
+
+	for (int i=0; i<size; i++) {
+		const ExprNode& e=f.node(i);
+		bool ok=e.dim.is_scalar();
+		arg[i][0]=arg[i][1]=0;
+
+		const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e);
+		const ExprUnaryOp*  u=dynamic_cast<const ExprUnaryOp*>(&e);
+		const ExprIndex*    x=dynamic_cast<const ExprIndex*>(&e);
+
+		if (b) {
+			arg[i][0]=index[b->left];
+			arg[i][1]=index[b->right];
+			if      (dynamic_cast<const ExprAdd*>(b)) code[i]=ADD;
+			else if (dynamic_cast<const ExprSub*>(b)) code[i]=SUB;
+			else if (dynamic_cast<const ExprMul*>(b)) code[i]=MUL;
+			else if (dynamic_cast<const ExprDiv*>(b)) code[i]=DIV;
+			else ok=false;
+			// all the operands must be scalar (e.g., not a dot product)
+			ok = ok && b->left.dim.is_scalar() && b->right.dim.is_scalar();
+		} else if (u) {
+			arg[i][0]=index[u->expr];
+			if      (dynamic_cast<const ExprMinus*>(u)) code[i]=MINUS;
+			else if (dynamic_cast<const ExprSqr*>(u))   code[i]=SQR;
+			else if (dynamic_cast<const ExprSqrt*>(u))  code[i]=SQRT;
+			else if (dynamic_cast<const ExprExp*>(u))   code[i]=EXP;
+			else if (dynamic_cast<const ExprLog*>(u))   code[i]=LOG;
+			else if (dynamic_cast<const ExprCos*>(u))   code[i]=COS;
+			else if (dynamic_cast<const ExprSin*>(u))   code[i]=SIN;
+			else if (dynamic_cast<const ExprAtan*>(u))  code[i]=ATAN;
+			else if (dynamic_cast<const ExprPower*>(u)) { code[i]=POWER; arg[i][1]=((const ExprPower*) u)->expon; }
+			else ok=false;
+		} else if (x) {
+			// component of a vector argument
+			const ExprSymbol* v=dynamic_cast<const ExprSymbol*>(&x->expr);
+			ok = ok && v!=NULL;
+			if (ok) {
+				code[i]=SYM;
+				arg[i][0]=first[v->key]+x->index;
+			}
+		} else if (dynamic_cast<const ExprSymbol*>(&e)) {
+			if (e.dim.is_scalar()) {
+				code[i]=SYM;
+				arg[i][0]=first[((const ExprSymbol&) e).key];
+			} else {
+				code[i]=NOP;
+				ok=true;
+			}
+		} else if (dynamic_cast<const ExprConstant*>(&e)) {
+			code[i]=CST;
+			if (ok) cst[i]=((const ExprConstant&) e).get_value();
+		} else
+			ok=false;
+
+		if (!ok) {
+			// not supported: fall back to Function::eval
+			delete[] code; code=NULL;
+			delete[] arg;  arg=NULL;
+			delete[] cst;  cst=NULL;
+			delete[] first;
+			return;
+		}
+	}
+	delete[] first;
+	n=size;
+}
+
+void BatchEval::eval_node(int i, Interval** val, int m) const {
+	Interval* y=val[i];
+	const Interval* x1=val[arg[i][0]];
+	const Interval* x2=code[i]>=ADD && code[i]<=DIV ? val[arg[i][1]] : NULL;
+
+	switch(code[i]) {
+	case CST:   for (int j=0; j<m; j++) y[j]=cst[i];                break;
+	case ADD:   for (int j=0; j<m; j++) y[j]=x1[j]+x2[j];           break;
+	case SUB:   for (int j=0; j<m; j++) y[j]=x1[j]-x2[j];           break;
+	case MUL:   for (int j=0; j<m; j++) y[j]=x1[j]*x2[j];           break;
+	case DIV:   for (int j=0; j<m; j++) y[j]=x1[j]/x2[j];           break;
+	case MINUS: for (int j=0; j<m; j++) y[j]=-x1[j];                break;
+	case SQR:   for (int j=0; j<m; j++) y[j]=sqr(x1[j]);            break;
+	case SQRT:  for (int j=0; j<m; j++) y[j]=sqrt(x1[j]);           break;
+	case POWER: batch_pow(x1,arg[i][1],y,m);                        break;
+	case EXP:   batch_exp(x1,y,m);                                  break;
+	case LOG:   batch_log(x1,y,m);                                  break;
+	case COS:   batch_cos(x1,y,m);                                  break;
+	case SIN:   batch_sin(x1,y,m);                                  break;
+	case ATAN:  batch_atan(x1,y,m);                                 break;
+	default:    break; // SYM (loaded by the caller), NOP
+	}
+}
+
+void BatchEval::eval_block(const IntervalMatrix& boxes, int k, int m, Interval** val) const {
+	for (int i=n-1; i>=0; i--) {
+		if (code[i]==SYM) {
+			Interval* y=val[i];
+			for (int j=0; j<m; j++) y[j]=boxes[k+j][arg[i][0]];
+		} else
+			eval_node(i,val,m);
+	}
+}
+
+void BatchEval::forward(const Interval* const* input, Interval** val, int m) const {
+	assert(vectorized());
+	for (int i=n-1; i>=0; i--) {
+		if (code[i]==SYM) {
+			Interval* y=val[i];
+			const Interval* x=input[arg[i][0]];
+			for (int j=0; j<m; j++) y[j]=x[j];
+		} else
+			eval_node(i,val,m);
+	}
+}
+
+bool BatchEval::backward(Interval** val, Interval* const* input, int m) const {
+	assert(vectorized());
+
+	// from the root to the leaves (the fathers of a node have smaller numbers)
+	for (int i=0; i<n; i++) {
+		const Interval* y=val[i];
+		Interval* x1=val[arg[i][0]];
+		Interval* x2=code[i]>=ADD && code[i]<=DIV ? val[arg[i][1]] : NULL;
+		bool ok=true;
+
+		switch(code[i]) {
+		case SYM:
+			x1=input[arg[i][0]];
+			for (int j=0; j<m; j++) {
+				x1[j] &= y[j];
+				ok &= !x1[j].is_empty();
+			}
+			break;
+		case ADD:   for (int j=0; j<m; j++) ok &= proj_add(y[j],x1[j],x2[j]);       break;
+		case SUB:   for (int j=0; j<m; j++) ok &= proj_sub(y[j],x1[j],x2[j]);       break;
+		case MUL:   for (int j=0; j<m; j++) ok &= proj_mul(y[j],x1[j],x2[j]);       break;
+		case DIV:   for (int j=0; j<m; j++) ok &= proj_div(y[j],x1[j],x2[j]);       break;
+		case MINUS: for (int j=0; j<m; j++) { x1[j] &= -y[j]; ok &= !x1[j].is_empty(); } break;
+		case SQR:   for (int j=0; j<m; j++) ok &= proj_sqr(y[j],x1[j]);             break;
+		case SQRT:  for (int j=0; j<m; j++) ok &= proj_sqrt(y[j],x1[j]);            break;
+		case POWER: for (int j=0; j<m; j++) ok &= proj_pow(y[j],arg[i][1],x1[j]);   break;
+		case EXP:   for (int j=0; j<m; j++) ok &= proj_exp(y[j],x1[j]);             break;
+		case LOG:   for (int j=0; j<m; j++) ok &= proj_log(y[j],x1[j]);             break;
+		case COS:   for (int j=0; j<m; j++) ok &= proj_cos(y[j],x1[j]);             break;
+		case SIN:   for (int j=0; j<m; j++) ok &= proj_sin(y[j],x1[j]);             break;
+		case ATAN:  for (int j=0; j<m; j++) ok &= proj_atan(y[j],x1[j]);            break;
+		default:    break; // CST, NOP
+		}
+		if (!ok) return false;
+	}
+	return true;
+}
+
+IntervalVector BatchEval::eval(const IntervalMatrix& boxes) const {
+	assert(boxes.nb_cols()==f.nb_var());
+
+	int nb_boxes=boxes.nb_rows();
+	IntervalVector res(nb_boxes);
+
+	if (!vectorized()) {
+		for (int k=0; k<nb_boxes; k++)
+			res[k]=f.eval(boxes[k]);
+		return res;
+	}
+
+	int size=nb_boxes<EVAL_BLOCK ? nb_boxes : EVAL_BLOCK;
+
+	Interval* buf=new Interval[n*size];
+	Interval** val=new Interval*[n];
+	for (int i=0; i<n; i++) val[i]=&buf[i*size];
+
+	for (int k=0; k<nb_boxes; k+=size) {
+		int m=nb_boxes-k<size ? nb_boxes-k : size;
+		eval_block(boxes,k,m,val);
+		for (int j=0; j<m; j++) res[k+j]=val[0][j];
+	}
+
+	delete[] val;
+	delete[] buf;
+
+	return res;
+}
+
+} // namespace ibex
@@ -0,0 +1,152 @@
+/* ============================================================================
+ * I B E X - Evaluation of a function over a batch of boxes
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_BATCH_EVAL_H__
+#define __IBEX_BATCH_EVAL_H__
+
+#include "ibex_Function.h"
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Evaluation of a real-valued function over many boxes at once.
+ *
+ * Instead of running the forward algorithm once per box, each node of the
+ * expression is evaluated for all the boxes before moving to the next node.
+ * Node values are therefore stored as arrays (one interval per box), and
+ * elementary functions (exp, log, cos, sin, atan) are evaluated with the
+ * batch functions of ibex_BatchArith.h.
+ *
+ * Only scalar expressions with scalar or vector arguments (the components of
+ * the vectors being accessed by indices, like x[0]), built from +, -, *, /, sqr,
+ * sqrt, integer powers and the elementary functions above are processed
+ * by blocks. For any other function, #eval falls back to a box-by-box
+ * evaluation with Function::eval.
+ *
+ * The evaluator also provides the forward and backward steps of HC4Revise by
+ * blocks (see #forward and #backward), which are used by #ibex::CtcFwdBwdFamily.
+ *
+ * The function labels are not used (the function can be evaluated by
+ * other algorithms meanwhile).
+ */
+class BatchEval {
+
+public:
+	/**
+	 * \brief Build a batch evaluator for \a f.
+	 *
+	 * \pre \a f must be real-valued. The function must not be destroyed
+	 *      before this object.
+	 */
+	BatchEval(const Function& f);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BatchEval();
+
+	/**
+	 * \brief Evaluate the function over each row of \a boxes.
+	 *
+	 * Return the vector of the images: the ith component is
+	 * the image of the ith row of \a boxes.
+	 *
+	 * \pre boxes.nb_cols()==f.nb_var()
+	 */
+	IntervalVector eval(const IntervalMatrix& boxes) const;
+
+	/**
+	 * \brief Forward evaluation of a block of m boxes.
+	 *
+	 * The boxes are given by columns: input[j][k] is the domain of
+	 * the jth variable (0<=j<f.nb_var()) in the kth box (0<=k<m).
+	 * On return, val[i][k] is the value of the ith node (see Function::node)
+	 * for the kth box, and val[0][k] is the image of the kth box.
+	 *
+	 * \pre #vectorized() is true and val has nb_nodes() arrays of (at least) m intervals.
+	 */
+	void forward(const Interval* const* input, Interval** val, int m) const;
+
+	/**
+	 * \brief Backward projection of a block of m boxes.
+	 *
+	 * The values of the nodes must have been set by #forward and the value of
+	 * the root (val[0]) contracted with the images. The values of the nodes and
+	 * the domains in \a input are contracted.
+	 *
+	 * \return false if one of the boxes is empty (the other ones may not be fully
+	 *         contracted in this case).
+	 */
+	bool backward(Interval** val, Interval* const* input, int m) const;
+
+	/**
+	 * \brief Number of nodes of the compiled expression (0 if not vectorized).
+	 */
+	int nb_nodes() const;
+
+	/**
+	 * \brief True iff the function is evaluated by blocks.
+	 *
+	 * When false, #eval calls Function::eval for each box.
+	 */
+	bool vectorized() const;
+
+	/**
+	 * \brief The function.
+	 */
+	const Function& f;
+
+protected:
+	typedef enum {
+		SYM, CST, ADD, SUB, MUL, DIV, MINUS, SQR, SQRT, POWER,
+		EXP, LOG, COS, SIN, ATAN, NOP
+	} operation;
+
+	/** Number of nodes (0 if not vectorized). */
+	int n;
+
+	/** Operation of each node (same numbering as Function::node(i)). */
+	operation* code;
+
+	/** Children (or variable index / integer exponent) of each node.
+	 * A SYM node is either a scalar argument or a component of a vector argument;
+	 * its variable index is the index of this component in the boxes.
+	 * A NOP node is a vector argument (not evaluated). */
+	int (*arg)[2];
+
+	/** Values of constants (only used by CST nodes). */
+	Interval* cst;
+
+private:
+	void compile();
+
+	/** Evaluate the first m rows of boxes, starting at row k, in val[][0..m-1]. */
+	void eval_block(const IntervalMatrix& boxes, int k, int m, Interval** val) const;
+
+	/** Evaluate the ith node (an operation) for m boxes. */
+	void eval_node(int i, Interval** val, int m) const;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool BatchEval::vectorized() const {
+	return n>0;
+}
+
+inline int BatchEval::nb_nodes() const {
+	return n;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_BATCH_EVAL_H__
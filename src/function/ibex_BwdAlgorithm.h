@@ -41,6 +41,9 @@ protected:
 	/** TO BE DEFINED (by the subclass) */
 	void chi_bwd(const ExprChi&,  ExprLabel& a, ExprLabel& b, ExprLabel& c, const ExprLabel& result);
 
+	/** TO BE DEFINED (by the subclass) */
+	void sum_bwd(const ExprSum&, ExprLabel** argL, const ExprLabel& result);
+
 	/*==================== binary operators =========================*/
 	/** TO BE DEFINED (by the subclass) */
 	void add_bwd(const ExprAdd&, ExprLabel& leftL, ExprLabel& rightL, const ExprLabel& result);
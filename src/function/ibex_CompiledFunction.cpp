@@ -12,6 +12,7 @@
 #include "ibex_CompiledFunction.h"
 #include "ibex_Function.h"
 #include <algorithm>
+#include <map>
 
 using std::cout;
 using std::endl;
@@ -24,7 +25,7 @@ bool compare(const ExprNode* x, const ExprNode* y) { return (x->height>y->height
 
 }
 
-CompiledFunction::CompiledFunction() : 	n(0), code(NULL), nb_args(NULL), args(NULL) {
+CompiledFunction::CompiledFunction() : 	n(0), code(NULL), nb_args(NULL), args(NULL), sub(NULL), _nb_forward(0) {
 
 }
 
@@ -43,6 +44,17 @@ void CompiledFunction::compile(const Function& f) {
 	for (ptr=0; ptr<n; ptr++) {
 		visit(nodes[ptr]);
 	}
+
+	// Ranks of the arguments (for incremental forward evaluation)
+	std::map<const ExprLabel*,int> rank;
+	for (int i=0; i<n; i++) rank[args[i][0]]=i;
+
+	sub=new int*[n];
+	for (int i=0; i<n; i++) {
+		sub[i]=new int[nb_args[i]];
+		for (int k=0; k<nb_args[i]; k++)
+			sub[i][k]=rank[args[i][k+1]];
+	}
 	//cout << f.name << " : n=" << n << " nb_args[" << 0 << "]=" << nb_args[0] << endl;
 }
 
@@ -52,6 +64,8 @@ CompiledFunction::~CompiledFunction() {
 	delete[] code;
 	for (int i=0; i<n; i++) delete[] args[i];
 	delete[] args;
+	for (int i=0; i<n; i++) delete[] sub[i];
+	delete[] sub;
 	delete[] nb_args;
 }
 
@@ -130,6 +144,8 @@ void CompiledFunction::visit(const ExprApply& e) { visit(e,APPLY); }
 
 void CompiledFunction::visit(const ExprChi& e) { visit(e,CHI); }
 
+void CompiledFunction::visit(const ExprSum& e) { visit(e,SUM); }
+
 void CompiledFunction::visit(const ExprAdd& e)   {
 	if (e.dim.is_scalar())      visit(e,ADD);
 	else if (e.dim.is_vector()) visit(e,ADD_V);
@@ -215,6 +231,7 @@ const char* CompiledFunction::op(operation o) const {
 	case SYM:   return "symbl";
 	case APPLY: return "apply";
 	case CHI: return "chi";
+	case SUM: return "sum";
 	case ADD: case ADD_V: case ADD_M:
 		        return "+";
 	case MUL: case MUL_SV: case MUL_SM: case MUL_VV: case MUL_MV: case MUL_MM:
@@ -251,6 +268,19 @@ const char* CompiledFunction::op(operation o) const {
 	}
 }
 
+void CompiledFunction::unaffected(const bool* updated, bool* skip) const {
+	// the arguments of a node have a higher rank
+	for (int i=n-1; i>=0; i--) {
+		if (code[i]==SYM)
+			skip[i]=!updated[((const ExprSymbol&) nodes[i]).key];
+		else {
+			skip[i]=true;
+			for (int k=0; k<nb_args[i]; k++)
+				if (!skip[sub[i][k]]) { skip[i]=false; break; }
+		}
+	}
+}
+
 // for debug only
 void CompiledFunction::print() const {
 	const CompiledFunction& f=*this;
@@ -302,6 +332,14 @@ void CompiledFunction::print() const {
 				cout << (e.arg(i).id) << " ";
 		}
 		break;
+		case CompiledFunction::SUM:
+		{
+			ExprSum& e=(ExprSum&) f.nodes[i];
+			cout << e.id << ": sum " << " " << *f.args[i][0] << " ";
+			for (int i=0; i<e.nb_args; i++)
+				cout << (e.arg(i).id) << " ";
+		}
+		break;
 		case CompiledFunction::ADD:
 		case CompiledFunction::ADD_V:
 		case CompiledFunction::ADD_M:
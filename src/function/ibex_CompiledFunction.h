@@ -53,6 +53,29 @@ public:
 	template<class V>
 	ExprLabel& forward(const V& algo) const;
 
+	/**
+	 * Run the forward phase on the nodes i such that skip[i]==false only
+	 * (the label of the other nodes is left unchanged).
+	 * The nodes are numbered from 0 (the root) to size-1, as in #unaffected(const bool*, bool*).
+	 */
+	template<class V>
+	ExprLabel& forward(const V& algo, const bool* skip) const;
+
+	/**
+	 * Set skip[i] to true iff the subexpression of the ith node does not
+	 * contain the symbol of an argument k such that updated[k]==true.
+	 * The array \a skip must have expr().size elements.
+	 */
+	void unaffected(const bool* updated, bool* skip) const;
+
+	/**
+	 * Number of forward algorithms run so far.
+	 *
+	 * Allows an algorithm to detect that the labels have been
+	 * overwritten since its last run.
+	 */
+	unsigned long nb_forward() const;
+
 	/**
 	 * Run the backward phase.  V must be a subclass of BwdAlgorithm.
 	 * Note that the type V is just passed in order to have static linkage.
@@ -67,7 +90,7 @@ public:
 
 protected:
 	typedef enum {
-		IDX, VEC, SYM, CST, APPLY, CHI,
+		IDX, VEC, SYM, CST, APPLY, CHI, SUM,
 		ADD, MUL, SUB, DIV, MAX, MIN, ATAN2,
 		MINUS, TRANS_V, TRANS_M, SIGN, ABS, POWER,
 		SQR, SQRT, EXP, LOG,
@@ -95,6 +118,7 @@ private:
 	void visit(const ExprVector& e);
 	void visit(const ExprApply& e);
 	void visit(const ExprChi& e);
+	void visit(const ExprSum& e);
 	void visit(const ExprAdd& e);
 	void visit(const ExprMul& e);
 	void visit(const ExprSub& e);
@@ -135,15 +159,25 @@ protected:
 	operation *code;
 	int* nb_args;
 	mutable ExprLabel*** args;
+	int** sub; // ranks of the arguments of each node (nb_args[i] entries, none for a symbol)
 
 	mutable int ptr;
+	mutable unsigned long _nb_forward;
 };
 
 template<class V>
 ExprLabel& CompiledFunction::forward(const V& algo) const {
+	return forward(algo,NULL);
+}
+
+template<class V>
+ExprLabel& CompiledFunction::forward(const V& algo, const bool* skip) const {
 	assert(dynamic_cast<const FwdAlgorithm* >(&algo)!=NULL);
 
+	_nb_forward++;
+
 	for (int i=n-1; i>=0; i--) {
+		if (skip && skip[i]) continue;
 		switch(code[i]) {
 		case IDX:    ((V&) algo).index_fwd((ExprIndex&)    nodes[i], *args[i][1],  *args[i][0]); break;
 		case VEC:    ((V&) algo).vector_fwd((ExprVector&)  nodes[i], (const ExprLabel**) &(args[i][1]),*args[i][0]); break;
@@ -151,6 +185,7 @@ ExprLabel& CompiledFunction::forward(const V& algo) const {
 		case CST:    ((V&) algo).cst_fwd  ((ExprConstant&) nodes[i],               *args[i][0]); break;
 		case APPLY:  ((V&) algo).apply_fwd((ExprApply&)    nodes[i], &(args[i][1]),*args[i][0]); break;
 		case CHI:    ((V&) algo).chi_fwd  ((ExprChi&)      nodes[i], *args[i][1], *args[i][2],  *args[i][3],*args[i][0]); break;
+		case SUM:    ((V&) algo).sum_fwd  ((ExprSum&)      nodes[i], (const ExprLabel**) &(args[i][1]),*args[i][0]); break;
 		case ADD:    ((V&) algo).add_fwd  ((ExprAdd&)      nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
 		case ADD_V:  ((V&) algo).add_V_fwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
 		case ADD_M:  ((V&) algo).add_M_fwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
@@ -194,6 +229,10 @@ ExprLabel& CompiledFunction::forward(const V& algo) const {
 	return *args[0][0];
 }
 
+inline unsigned long CompiledFunction::nb_forward() const {
+	return _nb_forward;
+}
+
 template<class V>
 void CompiledFunction::backward(const V& algo) const {
 
@@ -207,6 +246,7 @@ void CompiledFunction::backward(const V& algo) const {
 		case CST:    ((V&) algo).cst_bwd  ((ExprConstant&) nodes[i],                *args[i][0]); break;
 		case APPLY:  ((V&) algo).apply_bwd  ((ExprApply&)  nodes[i], &(args[i][1]), *args[i][0]); break;
 		case CHI:    ((V&) algo).chi_bwd    ((ExprChi&)    nodes[i], *args[i][1], *args[i][2], *args[i][3], *args[i][0]); break;
+		case SUM:    ((V&) algo).sum_bwd    ((ExprSum&)    nodes[i], &(args[i][1]), *args[i][0]); break;
 		case ADD:    ((V&) algo).add_bwd    ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
 		case ADD_V:  ((V&) algo).add_V_bwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
 		case ADD_M:  ((V&) algo).add_M_bwd  ((ExprAdd&)    nodes[i], *args[i][1], *args[i][2], *args[i][0]); break;
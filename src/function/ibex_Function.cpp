@@ -16,6 +16,7 @@
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
 #include "ibex_Gradient.h"
+#include <vector>
 #include "ibex_FunctionBuild.cpp_"
 
 using namespace std;
@@ -156,6 +157,101 @@ void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
 	}
 }
 
+namespace {
+
+/*
+ * Build the structure of the sparse Jacobian matrix of f in J
+ * (if the structure of J does not match).
+ */
+void init_sparse_jacobian(const Function& f, IntervalSparseMatrix& J) {
+	int m=f.image_dim();
+	int n=f.nb_var();
+
+	int* row_start=new int[m+1];
+	std::vector<int> col;
+	row_start[0]=0;
+	for (int i=0; i<m; i++) {
+		const Function& fi=f[i];
+		if (f.all_args_scalar())
+			for (int k=0; k<fi.nb_used_vars; k++) col.push_back(fi.used_var[k]);
+		else
+			for (int j=0; j<n; j++) col.push_back(j);
+		row_start[i+1]=col.size();
+	}
+
+	// J is typically reused from one call to the other but its structure
+	// may have been changed in-between (e.g., by preconditioning)
+	bool match=(J.nb_rows()==m && J.nb_cols()==n && J.nb_nonzeros()==row_start[m]);
+	for (int i=0; match && i<m; i++) {
+		match=(J.row_begin(i)==row_start[i]);
+		for (int k=row_start[i]; match && k<row_start[i+1]; k++)
+			match=(J.col(k)==col[k]);
+	}
+
+	if (!match)
+		J=IntervalSparseMatrix(m,n,row_start,col.empty()? NULL : &col[0]);
+	delete[] row_start;
+}
+
+}
+
+void Function::jacobian(const IntervalVector& x, IntervalSparseMatrix& J) const {
+	assert(x.size()==nb_var());
+
+	init_sparse_jacobian(*this,J);
+
+	if (!all_args_scalar()) {
+		IntervalMatrix D(image_dim(),nb_var());
+		jacobian(x,D);
+		for (int i=0; i<image_dim(); i++)
+			for (int k=J.row_begin(i); k<J.row_end(i); k++)
+				J.val(k)=D[i][J.col(k)];
+		return;
+	}
+
+	for (int i=0; i<image_dim(); i++) {
+		if (J.row_begin(i)<J.row_end(i))
+			Gradient().sparse_gradient((*this)[i],x,&J.val(J.row_begin(i)));
+	}
+}
+
+void Function::hansen_matrix(const IntervalVector& box, IntervalSparseMatrix& H) const {
+	assert(box.size()==nb_var());
+
+	init_sparse_jacobian(*this,H);
+
+	if (!all_args_scalar()) {
+		IntervalMatrix D(image_dim(),nb_var());
+		hansen_matrix(box,D);
+		for (int i=0; i<image_dim(); i++)
+			for (int k=H.row_begin(i); k<H.row_end(i); k++)
+				H.val(k)=D[i][H.col(k)];
+		return;
+	}
+
+	IntervalVector mid=box.mid();
+	IntervalVector x=mid;
+
+	int max_row=0;
+	for (int i=0; i<image_dim(); i++)
+		if (H.row_end(i)-H.row_begin(i)>max_row) max_row=H.row_end(i)-H.row_begin(i);
+	Interval* g=new Interval[max_row];
+
+	for (int i=0; i<image_dim(); i++) {
+		// the variables of the ith component are x[H.col(k)], k=H.row_begin(i)...
+		// (in increasing order)
+		for (int k=H.row_begin(i); k<H.row_end(i); k++) {
+			x[H.col(k)]=box[H.col(k)];
+			Gradient().sparse_gradient((*this)[i],x,g);
+			H.val(k)=g[k-H.row_begin(i)];
+		}
+		for (int k=H.row_begin(i); k<H.row_end(i); k++)
+			x[H.col(k)]=mid[H.col(k)];
+	}
+
+	delete[] g;
+}
+
 std::ostream& operator<<(std::ostream& os, const Function& f) {
 	if (f.name!=NULL) os << f.name << ":";
 	os << "(";
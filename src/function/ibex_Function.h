@@ -14,6 +14,7 @@
 
 #include "ibex_Expr.h"
 #include "ibex_Fnc.h"
+#include "ibex_IntervalSparseMatrix.h"
 #include "ibex_CompiledFunction.h"
 #include "ibex_Decorator.h"
 #include "ibex_Array.h"
@@ -383,6 +384,31 @@ public:
 	template<class V>
 	ExprLabel& forward(const V& algo) const;
 
+	/**
+	 * \brief Run a forward algorithm on a subset of the nodes.
+	 *
+	 * The nodes i with skip[i]==true are not evaluated: their label is
+	 * left unchanged. The mask is typically computed by #unaffected(const bool*, bool*) const.
+	 */
+	template<class V>
+	ExprLabel& forward(const V& algo, const bool* skip) const;
+
+	/**
+	 * \brief Mark the nodes that do not depend on updated arguments.
+	 *
+	 * Set skip[i] to true iff the ith node of the compiled expression (0 being the root)
+	 * does not depend on an argument k such that updated[k]==true.
+	 * The array \a skip must have expr().size elements.
+	 */
+	void unaffected(const bool* updated, bool* skip) const;
+
+	/**
+	 * \brief Number of forward algorithms run so far.
+	 *
+	 * Allows to detect that the labels have been overwritten.
+	 */
+	unsigned long nb_forward() const;
+
 	/**
 	 * \brief Run a backward algorithm.
 	 *
@@ -522,6 +548,33 @@ public:
 	 */
 	void hansen_matrix(const IntervalVector& x, IntervalMatrix& h) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix of f in sparse form.
+	 *
+	 * Only the entries (i,j) such that the ith component of f depends on the
+	 * jth variable are stored. If the structure of \a J does not match, \a J
+	 * is rebuilt (so \a J can be reused in subsequent calls).
+	 *
+	 * If all the arguments of f are scalar, the complexity is proportional to
+	 * the size of the expressions of the components, and does not depend on the
+	 * total number of variables.
+	 *
+	 * \pre f must be vector-valued
+	 */
+	void jacobian(const IntervalVector& x, IntervalSparseMatrix& J) const;
+
+	/**
+	 * \brief Calculate the Hansen matrix of f in sparse form.
+	 *
+	 * Same structure as the sparse Jacobian matrix. The entry (i,j) requires
+	 * a differentiation of the ith component, so the complexity is proportional
+	 * to the sum, over all the components, of the size of the component times
+	 * its number of variables.
+	 *
+	 * \pre f must be vector-valued
+	 */
+	void hansen_matrix(const IntervalVector& x, IntervalSparseMatrix& h) const;
+
 	/**
 	 * \brief Contract x w.r.t. f(x)=y.
 	 * \throw EmptyBoxException if x is empty.
@@ -838,6 +891,19 @@ inline ExprLabel& Function::forward(const V& algo) const {
 	return cf.forward<V>(algo);
 }
 
+template<class V>
+inline ExprLabel& Function::forward(const V& algo, const bool* skip) const {
+	return cf.forward<V>(algo,skip);
+}
+
+inline void Function::unaffected(const bool* updated, bool* skip) const {
+	cf.unaffected(updated,skip);
+}
+
+inline unsigned long Function::nb_forward() const {
+	return cf.nb_forward();
+}
+
 template<class V>
 inline void Function::backward(const V& algo) const {
 	cf.backward<V>(algo);
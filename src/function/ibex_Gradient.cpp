@@ -60,6 +60,24 @@ void Gradient::gradient(const Function& f, const IntervalVector& box, IntervalVe
 	}
 }
 
+void Gradient::sparse_gradient(const Function& f, const IntervalVector& box, Interval* g) const {
+	assert(f.expr().dim.is_scalar());
+	assert(f.expr().deco.d);
+	assert(f.expr().deco.g);
+	assert(f.all_args_scalar());
+
+	f.eval_domain(box);
+	for (int k=0; k<f.nb_used_vars; k++)
+		((Gradient&) *this).symbol_fwd(f.arg(f.used_var[k]), f.arg(f.used_var[k]).deco);
+
+	f.forward<Gradient>(*this);
+
+	f.expr().deco.g->i()=1.0;
+	f.backward<Gradient>(*this);
+
+	for (int k=0; k<f.nb_used_vars; k++)
+		g[k]=f.arg_deriv[f.used_var[k]].i();
+}
 
 void Gradient::jacobian(const Function& f, const Array<Domain>& d, IntervalMatrix& J) const {
 	assert(f.expr().dim.is_vector());
@@ -34,6 +34,17 @@ public:
 	 */
 	void gradient(const Function& f, const IntervalVector& box, IntervalVector& g) const;
 
+	/**
+	 * \brief Calculate the partial derivatives of f w.r.t. the used variables only.
+	 *
+	 * g[k] is set to the derivative w.r.t. the variable f.used_var[k]. Only the
+	 * used variables are read in \a box: the complexity does not depend on the
+	 * total number of variables.
+	 *
+	 * \pre all the arguments of f must be scalar.
+	 */
+	void sparse_gradient(const Function& f, const IntervalVector& box, Interval* g) const;
+
 	/**
 	 * \brief Calculate the Jacobian on the domains \a d and store the result in \a J.
 	 */
@@ -45,6 +56,7 @@ public:
 	       void symbol_fwd(const ExprSymbol& s, ExprLabel& y)                                 { y.g->clear(); }
 	       void apply_fwd(const ExprApply& a, ExprLabel** argL, ExprLabel& y)                 { y.g->clear(); }
 	inline void chi_fwd(const ExprChi&, const ExprLabel& x1, const ExprLabel& x2, const ExprLabel& x3, ExprLabel& y)  { y.g->i()=0; }
+	inline void sum_fwd(const ExprSum&, const ExprLabel**, ExprLabel& y)                    { y.g->i()=0; }
 	inline void add_fwd(const ExprAdd&, const ExprLabel&, const ExprLabel&, ExprLabel& y)     { y.g->i()=0; }
 	inline void mul_fwd(const ExprMul&, const ExprLabel&, const ExprLabel&, ExprLabel& y)     { y.g->i()=0; }
 	inline void sub_fwd(const ExprSub&, const ExprLabel&, const ExprLabel&, ExprLabel& y)     { y.g->i()=0; }
@@ -93,6 +105,7 @@ public:
 	inline void cst_bwd   (const ExprConstant&,                             const ExprLabel& ) { /* nothing to do */ }
 	       void apply_bwd (const ExprApply&,  ExprLabel** x,                const ExprLabel& y);
 	       void chi_bwd   (const ExprChi&,    ExprLabel& x1, ExprLabel& x2, ExprLabel& x3, const ExprLabel& y);
+	inline void sum_bwd   (const ExprSum& s,  ExprLabel** x,                const ExprLabel& y) { for (int i=0; i<s.nb_args; i++) x[i]->g->i() += y.g->i(); }
 	inline void add_bwd   (const ExprAdd&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y) { x1.g->i() += y.g->i();  x2.g->i() += y.g->i(); }
 	inline void mul_bwd   (const ExprMul&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y) { x1.g->i() += y.g->i() * x2.d->i(); x2.g->i() += y.g->i() * x1.d->i(); }
 	inline void sub_bwd   (const ExprSub&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y) { x1.g->i() += y.g->i();          x2.g->i() += -y.g->i(); }
@@ -60,6 +60,32 @@ bool HC4Revise::proj(const Function& f, const Domain& y, IntervalVector& x) {
 	return false;
 }
 
+bool HC4Revise::proj(const Function& f, const Domain& y, IntervalVector& x, const bool* skip) {
+	if (!skip || fwd_mode!=INTERVAL_MODE) return proj(f,y,x);
+
+	assert(f.all_args_scalar());
+
+	int j;
+	for (int i=0; i<f.nb_used_vars; i++) {
+		j=f.used_var[i];
+		f.arg_domains[j].i()=x[j];
+	}
+
+	f.forward<Eval>(Eval(),skip);
+
+	// the labels of the skipped nodes may have been contracted by the last
+	// backward phase: the root is not necessarily an enclosure of f(x)
+	*f.expr().deco.d &= y;
+	f.backward<HC4Revise>(*this);
+
+	for (int i=0; i<f.nb_used_vars; i++) {
+		j=f.used_var[i];
+		x[j]=f.arg_domains[j].i();
+	}
+
+	return false;
+}
+
 void HC4Revise::proj(const Function& f, const Domain& y, ExprLabel** x) {
 	EVAL(f,x);
 	*f.expr().deco.d &= y;
@@ -13,6 +13,7 @@
 
 #include "ibex_EmptyBoxException.h"
 #include "ibex_Function.h"
+#include "ibex_CompensatedArith.h"
 
 namespace ibex {
 
@@ -43,6 +44,21 @@ public:
 	 */
 	bool proj(const Function& f, const Domain& y, IntervalVector& x);
 
+	/**
+	 * \brief Project f(x)=y onto x, re-evaluating only a subset of the nodes.
+	 *
+	 * The forward phase skips the nodes i such that skip[i]==true (see #ibex::Function::unaffected(const bool*, bool*) const):
+	 * these nodes keep the domain left by the last projection. This is valid (i.e., does not remove solutions)
+	 * if the labels of f have not been modified since the last projection of f(x)=y and if x is included
+	 * in the box obtained at the end of this last projection.
+	 *
+	 * The arguments of f must be scalar. In affine mode, or if skip is NULL, all the nodes are evaluated.
+	 *
+	 * \return true if f(x) is included in y (inactive constraint). This can only be detected when all
+	 * the nodes are evaluated.
+	 */
+	bool proj(const Function& f, const Domain& y, IntervalVector& x, const bool* skip);
+
 	/**
 	 * \brief Ratio for the contraction of a
 	 * matrix-vector / matrix-matrix multiplication.
@@ -56,6 +72,7 @@ public:
 	inline void cst_bwd   (const ExprConstant&, const ExprLabel& )                                  { /* nothing to do */ }
 	inline void apply_bwd (const ExprApply& a, ExprLabel** x, const ExprLabel& y)                   { proj(a.func,*y.d,x); }
 	inline void chi_bwd   (const ExprChi&,ExprLabel& a,ExprLabel& b,ExprLabel& c,const ExprLabel& f){ if (!(proj_chi(f.d->i(),a.d->i(),b.d->i(),c.d->i()))) throw EmptyBoxException();  }
+	inline void sum_bwd   (const ExprSum& s, ExprLabel** x, const ExprLabel& y)                     { if (!(proj_sum_terms(y.d->i(),LabelDomains(x),s.nb_args))) throw EmptyBoxException();  }
 	inline void add_bwd   (const ExprAdd&,     ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(proj_add(y.d->i(),x1.d->i(),x2.d->i()))) throw EmptyBoxException();  }
 	inline void add_V_bwd  (const ExprAdd&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(proj_add(y.d->v(),x1.d->v(),x2.d->v()))) throw EmptyBoxException();  }
 	inline void add_M_bwd  (const ExprAdd&,    ExprLabel& x1, ExprLabel& x2, const ExprLabel& y)    { if (!(proj_add(y.d->m(),x1.d->m(),x2.d->m()))) throw EmptyBoxException();  }
@@ -0,0 +1,162 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CutPool.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CutPool.h"
+#include <math.h>
+
+namespace ibex {
+
+namespace {
+
+// tolerance for the violations (normalized) and the dual values
+const double cut_eps = 1e-9;
+
+bool finite(double x) {
+	return x>NEG_INFINITY && x<POS_INFINITY; // false for NaN
+}
+
+}
+
+const double CutPool::default_max_parallelism = 0.999;
+
+const int CutPool::default_max_age = 2;
+
+CutPool::CutPool(int nb_var, double max_parallelism, int max_age) : nb_var(nb_var),
+		max_parallelism(max_parallelism), max_age(max_age), nb_kept(0), nb_dropped(0) {
+
+}
+
+void CutPool::clear() {
+	cuts.clear();
+	gen_box.clear();
+	optima.clear();
+}
+
+bool CutPool::redundant(const IntervalVector& box, const Cut& c) const {
+	if (!finite(c.rhs)) return c.rhs==POS_INFINITY;
+
+	Interval act(0.0);
+	for (unsigned int k=0; k<c.col.size(); k++) {
+		if (!finite(c.val[k])) return false;
+		act += c.val[k]*box[c.col[k]];
+	}
+	return act.ub()<=c.rhs;
+}
+
+bool CutPool::parallel(const Cut& c, const Cut& d) const {
+	// rows generated for the same constraint have the same structure
+	if (c.col!=d.col || !(c.norm>0) || !(d.norm>0)) return false;
+
+	double dot=0;
+	for (unsigned int k=0; k<c.col.size(); k++)
+		dot += c.val[k]*d.val[k];
+	return dot >= max_parallelism*c.norm*d.norm;
+}
+
+double CutPool::violation(const Cut& c, const Vector& x) const {
+	if (!(c.norm>0)) return 0;
+
+	double act=0;
+	for (unsigned int k=0; k<c.col.size(); k++)
+		act += c.val[k]*x[c.col[k]];
+	return (act-c.rhs)/c.norm;
+}
+
+void CutPool::select(const IntervalVector& box, const LinearRows& rows, LinearRows& selected) {
+
+	// the generation boxes that contain the current box (the others are removed)
+	std::vector<int> new_gen(gen_box.size(),-1);
+	std::vector<IntervalVector> valid_box;
+	for (unsigned int g=0; g<gen_box.size(); g++) {
+		if (box.is_subset(gen_box[g])) {
+			new_gen[g]=valid_box.size();
+			valid_box.push_back(gen_box[g]);
+		}
+	}
+
+	// 1. the pooled rows, aged with the optima of the last LPs
+	std::vector<Cut> cand;
+	for (unsigned int i=0; i<cuts.size(); i++) {
+		Cut& c=cuts[i];
+		if (new_gen[c.gen]==-1) { nb_dropped++; continue; }
+		c.gen=new_gen[c.gen];
+
+		for (unsigned int o=0; o<optima.size() && !c.useful; o++)
+			c.useful = violation(c,optima[o])>cut_eps;
+
+		if (c.useful) c.age=0;
+		else c.age++;
+		c.useful=false;
+
+		if (c.age>max_age) { nb_dropped++; continue; }
+		cand.push_back(c);
+	}
+	optima.clear();
+
+	// 2. the new rows (in the form a*x<=b)
+	if (rows.size()>0) {
+		int g=valid_box.size();
+		valid_box.push_back(box);
+		for (int i=0; i<rows.size(); i++) {
+			Cut c;
+			double s = (rows.sign[i]==GEQ || rows.sign[i]==GT)? -1 : 1;
+			for (int k=rows.row_start[i]; k<rows.row_start[i+1]; k++) {
+				c.col.push_back(rows.col[k]);
+				c.val.push_back(s*rows.val[k]);
+			}
+			c.rhs=s*rows.rhs[i];
+			c.gen=g;
+			c.age=0;
+			c.useful=false;
+			cand.push_back(c);
+		}
+	}
+	gen_box=valid_box;
+
+	// 3. redundancy and parallelism filtering
+	cuts.clear();
+	for (unsigned int i=0; i<cand.size(); i++) {
+		Cut& c=cand[i];
+		if (redundant(box,c)) { nb_dropped++; continue; }
+
+		double n=0;
+		for (unsigned int k=0; k<c.val.size(); k++) n+=c.val[k]*c.val[k];
+		c.norm=::sqrt(n);
+
+		bool dominated=false;
+		for (unsigned int j=0; j<cuts.size() && !dominated; j++) {
+			if (parallel(c,cuts[j])) {
+				// keep the tightest row
+				if (c.rhs/c.norm < cuts[j].rhs/cuts[j].norm) {
+					int age=c.age<cuts[j].age? c.age : cuts[j].age;
+					cuts[j]=c;
+					cuts[j].age=age;
+				}
+				dominated=true;
+			}
+		}
+		if (dominated) { nb_dropped++; continue; }
+		cuts.push_back(c);
+	}
+
+	selected.clear();
+	for (unsigned int j=0; j<cuts.size(); j++)
+		selected.add(cuts[j].col.size(), cuts[j].col.empty()? NULL : &cuts[j].col[0],
+				cuts[j].val.empty()? NULL : &cuts[j].val[0], LEQ, cuts[j].rhs);
+	nb_kept += cuts.size();
+}
+
+void CutPool::update(const Vector& primal, const Vector& dual) {
+	for (unsigned int j=0; j<cuts.size() && nb_var+j<(unsigned int) dual.size(); j++) {
+		if (fabs(dual[nb_var+j])>cut_eps) cuts[j].useful=true;
+	}
+	optima.push_back(primal);
+}
+
+} // end namespace ibex
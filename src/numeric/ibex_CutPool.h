@@ -0,0 +1,132 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CutPool.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CUT_POOL_H__
+#define __IBEX_CUT_POOL_H__
+
+#include "ibex_LinearSolver.h"
+#include "ibex_IntervalVector.h"
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup numeric
+ *
+ * \brief Pool of linear cuts (rows of a linear relaxation).
+ *
+ * The pool selects, among the rows generated by a linear relaxation, the ones
+ * that are actually given to the LP solver and keeps them from one call to
+ * the other (typically, the calls to a polytope hull contractor inside a fixpoint).
+ *
+ * A row generated on a box is a valid relaxation on any subbox, so a pooled row
+ * remains a candidate as long as the current box is included in the box it has
+ * been generated on. The rows are scored as follows:
+ * <ul>
+ * <li> a row that is satisfied by all the points of the box is redundant and dropped;
+ * <li> among nearly parallel rows (cosine greater than #max_parallelism), only the tightest one is kept;
+ * <li> the age of a pooled row is the number of selections since the row was last useful, i.e.,
+ *      active (nonzero dual value) in one of the LPs solved or violated by one of their
+ *      optima (#update(const Vector&, const Vector&)). A row older than #max_age is dropped.
+ * </ul>
+ * Dropping rows is always safe: the relaxation is only weakened.
+ */
+class CutPool {
+public:
+	/**
+	 * \brief Create an empty pool for rows on \a nb_var variables.
+	 */
+	CutPool(int nb_var, double max_parallelism=default_max_parallelism, int max_age=default_max_age);
+
+	/**
+	 * \brief Select the rows of the LP.
+	 *
+	 * \param box      - the current box (the box \a rows have been generated on)
+	 * \param rows     - the new rows
+	 * \param selected - (output) the selected rows, among the new ones and the pooled ones.
+	 *                   All the generated rows are LEQ rows.
+	 *
+	 * The selected rows become the content of the pool.
+	 */
+	void select(const IntervalVector& box, const LinearRows& rows, LinearRows& selected);
+
+	/**
+	 * \brief Score the rows with the solution of an LP.
+	 *
+	 * \param primal - an optimal solution of an LP built with the last selected rows
+	 * \param dual   - the dual values of the rows of this LP (the rows of the
+	 *                 bound constraints first, then the selected rows in the same order).
+	 */
+	void update(const Vector& primal, const Vector& dual);
+
+	/**
+	 * \brief Empty the pool.
+	 */
+	void clear();
+
+	/**
+	 * \brief Number of rows in the pool.
+	 */
+	int size() const;
+
+	/** Default maximal cosine between two kept rows (0.999). */
+	static const double default_max_parallelism;
+
+	/** Default maximal age of a row (2). */
+	static const int default_max_age;
+
+	/** Number of variables. */
+	const int nb_var;
+
+	/** Maximal cosine between two kept rows. */
+	const double max_parallelism;
+
+	/** Maximal age of a row. */
+	const int max_age;
+
+	/** Total number of rows selected. */
+	int nb_kept;
+
+	/** Total number of rows dropped (redundant, dominated, too old or no more valid). */
+	int nb_dropped;
+
+protected:
+	/* A row sum val[k]*x_{col[k]} <= rhs */
+	class Cut {
+	public:
+		std::vector<int> col;
+		std::vector<double> val;
+		double rhs;
+		double norm;  // euclidean norm of val
+		int gen;      // index of the box the row has been generated on
+		int age;
+		bool useful;  // active or violated since the last selection
+	};
+
+	/* True if all the points of the box satisfy c */
+	bool redundant(const IntervalVector& box, const Cut& c) const;
+
+	/* True if c and d are nearly parallel */
+	bool parallel(const Cut& c, const Cut& d) const;
+
+	/* Normalized violation of c by x (<=0 if x satisfies c) */
+	double violation(const Cut& c, const Vector& x) const;
+
+	std::vector<Cut> cuts;                // the pooled rows (in the order of the last selection)
+	std::vector<IntervalVector> gen_box;  // the boxes the rows have been generated on
+	std::vector<Vector> optima;           // the optima recorded since the last selection
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int CutPool::size() const {
+	return cuts.size();
+}
+
+} // end namespace ibex
+#endif // __IBEX_CUT_POOL_H__
@@ -0,0 +1,498 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DualSimplex.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_DualSimplex.h"
+#include "ibex_Interval.h"
+
+#include <math.h>
+#include <time.h>
+#include <cassert>
+#include <algorithm>
+
+namespace ibex {
+
+namespace {
+
+// a bound larger than this value (in absolute value) is considered as infinite
+const double INF_BOUND = 1e20;
+
+// artificial bound used in place of an infinite bound
+const double ART_BOUND = 1e12;
+
+// minimal absolute value of a pivot in the ratio test
+const double PIVOT_TOL = 1e-9;
+
+// minimal absolute value of a pivot in the factorization
+const double SINGULAR_TOL = 1e-12;
+
+// number of pivots between two factorizations of the basis matrix
+const int REFACTOR = 50;
+
+}
+
+DualSimplex::DualSimplex(int n) : nb_iter(0), warm_start(false), nb_factorizations(0), n(n), m(0), is_min(true),
+		c(n,0.0), lb(n,NEG_INFINITY), ub(n,POS_INFINITY), basis_ok(false), nb_pivots(0), _obj_value(0) {
+
+}
+
+void DualSimplex::set_sense(bool minimize) {
+	is_min=minimize;
+}
+
+void DualSimplex::set_obj(int j, double coef) {
+	assert(j>=0 && j<n);
+	c[j]=coef;
+}
+
+void DualSimplex::set_var_bounds(int j, double l, double u) {
+	assert(j>=0 && j<n);
+	lb[j]=l;
+	ub[j]=u;
+}
+
+void DualSimplex::add_row(const double* a, double l, double u) {
+	for (int j=0; j<n; j++) A.push_back(a[j]);
+	rlb.push_back(l);
+	rub.push_back(u);
+
+	if (!basis_ok) {
+		m++;
+		return;
+	}
+
+	// The slack of the new row is basic. With B'=[B 0; a_B^T -1],
+	// the inverse is B'^{-1}=[B^{-1} 0; a_B^T*B^{-1} -1].
+	std::vector<double> binv2((m+1)*(m+1),0.0);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<m; j++)
+			binv2[i*(m+1)+j]=binv[i*m+j];
+
+	for (int r=0; r<m; r++) {
+		int k=head[r];
+		if (k<n && a[k]!=0)
+			for (int j=0; j<m; j++)
+				binv2[m*(m+1)+j]+=a[k]*binv[r*m+j];
+	}
+	binv2[m*(m+1)+m]=-1;
+
+	binv.swap(binv2);
+	head.push_back(n+m);
+	status.push_back(BASIC);
+	m++;
+}
+
+void DualSimplex::clear_rows() {
+	if (basis_ok) {
+		hint_head=head;
+		hint_status=status;
+	}
+	m=0;
+	A.clear();
+	rlb.clear();
+	rub.clear();
+	basis_ok=false;
+}
+
+void DualSimplex::reset_basis() {
+	basis_ok=false;
+	hint_head.clear();
+	hint_status.clear();
+}
+
+double DualSimplex::lo(int k) const {
+	return k<n ? lb[k] : rlb[k-n];
+}
+
+double DualSimplex::up(int k) const {
+	return k<n ? ub[k] : rub[k-n];
+}
+
+double DualSimplex::lo_art(int k) const {
+	double l=lo(k);
+	return l<=-INF_BOUND ? -ART_BOUND : l;
+}
+
+double DualSimplex::up_art(int k) const {
+	double u=up(k);
+	return u>=INF_BOUND ? ART_BOUND : u;
+}
+
+double DualSimplex::col_dot(const double* rho, int k) const {
+	if (k>=n) return -rho[k-n];
+	double s=0;
+	for (int i=0; i<m; i++)
+		s+=rho[i]*A[i*n+k];
+	return s;
+}
+
+void DualSimplex::slack_basis() {
+	head.resize(m);
+	status.resize(n+m);
+	for (int j=0; j<n; j++) status[j]= (lb[j]<=-INF_BOUND && ub[j]<INF_BOUND) ? AT_UB : AT_LB;
+	for (int r=0; r<m; r++) {
+		head[r]=n+r;
+		status[n+r]=BASIC;
+	}
+	binv.assign(m*m,0.0);
+	for (int r=0; r<m; r++) binv[r*m+r]=-1;
+	nb_pivots=0;
+	basis_ok=true;
+}
+
+bool DualSimplex::factorize() {
+	nb_factorizations++;
+
+	// Gauss-Jordan elimination with partial pivoting on [B | I]
+	std::vector<double> B(m*m,0.0);
+	for (int r=0; r<m; r++) {
+		int k=head[r];
+		if (k<n)
+			for (int i=0; i<m; i++) B[i*m+r]=A[i*n+k];
+		else
+			B[(k-n)*m+r]=-1;
+	}
+	binv.assign(m*m,0.0);
+	for (int r=0; r<m; r++) binv[r*m+r]=1;
+
+	for (int j=0; j<m; j++) {
+		int p=j;
+		for (int i=j+1; i<m; i++)
+			if (fabs(B[i*m+j])>fabs(B[p*m+j])) p=i;
+		if (fabs(B[p*m+j])<SINGULAR_TOL) return false;
+		if (p!=j)
+			for (int k=0; k<m; k++) {
+				std::swap(B[p*m+k],B[j*m+k]);
+				std::swap(binv[p*m+k],binv[j*m+k]);
+			}
+		double piv=B[j*m+j];
+		for (int k=0; k<m; k++) {
+			B[j*m+k]/=piv;
+			binv[j*m+k]/=piv;
+		}
+		for (int i=0; i<m; i++) {
+			if (i==j || B[i*m+j]==0) continue;
+			double f=B[i*m+j];
+			for (int k=0; k<m; k++) {
+				B[i*m+k]-=f*B[j*m+k];
+				binv[i*m+k]-=f*binv[j*m+k];
+			}
+		}
+	}
+	nb_pivots=0;
+	return true;
+}
+
+void DualSimplex::compute_duals(bool phase1, double eps) {
+	// y^T = c_B^T B^{-1}
+	y.assign(m,0.0);
+	for (int r=0; r<m; r++) {
+		int k=head[r];
+		double ck;
+		if (phase1) {
+			double l=lo_art(k);
+			double u=up_art(k);
+			if (x[k]<l-eps*(fabs(l)>1? fabs(l):1)) ck=-1;
+			else if (x[k]>u+eps*(fabs(u)>1? fabs(u):1)) ck=1;
+			else continue;
+		} else {
+			if (k>=n || c[k]==0) continue;
+			ck=is_min? c[k] : -c[k];
+		}
+		for (int i=0; i<m; i++)
+			y[i]+=ck*binv[r*m+i];
+	}
+
+	for (int k=0; k<n+m; k++) {
+		if (status[k]==BASIC) { d[k]=0; continue; }
+		double ck=(phase1 || k>=n) ? 0 : (is_min? c[k] : -c[k]);
+		d[k]=ck-(m>0? col_dot(&y[0],k) : 0);
+	}
+}
+
+bool DualSimplex::flip_bounds(double eps) {
+	for (int k=0; k<n+m; k++) {
+		if ((status[k]==AT_UB && d[k]>eps && lo(k)<=-INF_BOUND) ||
+			(status[k]==AT_LB && d[k]<-eps && up(k)>=INF_BOUND))
+			return false;
+	}
+	for (int k=0; k<n+m; k++) {
+		if (status[k]==AT_UB && d[k]>eps) status[k]=AT_LB;
+		else if (status[k]==AT_LB && d[k]<-eps) status[k]=AT_UB;
+	}
+	return true;
+}
+
+void DualSimplex::compute_primal() {
+	// x_B = -B^{-1} N x_N
+	std::vector<double> Nx(m,0.0);
+	for (int k=0; k<n+m; k++) {
+		if (status[k]==BASIC) continue;
+		x[k]= status[k]==AT_LB? lo_art(k) : up_art(k);
+		if (x[k]==0) continue;
+		if (k<n)
+			for (int i=0; i<m; i++) Nx[i]+=A[i*n+k]*x[k];
+		else
+			Nx[k-n]-=x[k];
+	}
+	for (int r=0; r<m; r++) {
+		double s=0;
+		for (int i=0; i<m; i++) s+=binv[r*m+i]*Nx[i];
+		x[head[r]]=-s;
+	}
+}
+
+int DualSimplex::leaving_row(double eps) const {
+	int r=-1;
+	double max_viol=0;
+	for (int i=0; i<m; i++) {
+		int k=head[i];
+		double l=lo_art(k);
+		double u=up_art(k);
+		double viol=0;
+		if (x[k]<l-eps*(fabs(l)>1? fabs(l):1)) viol=l-x[k];
+		else if (x[k]>u+eps*(fabs(u)>1? fabs(u):1)) viol=x[k]-u;
+		if (viol>max_viol) {
+			max_viol=viol;
+			r=i;
+		}
+	}
+	return r;
+}
+
+int DualSimplex::dual_entering(int r, bool below, double eps) {
+	const double* rho=&binv[r*m];
+
+	// Harris ratio test, first pass: the maximal step with relaxed bounds
+	double theta_max=POS_INFINITY;
+	for (int k=0; k<n+m; k++) {
+		alpha[k]=0;
+		if (status[k]==BASIC || lo(k)==up(k)) continue;
+		double a=col_dot(rho,k);
+		alpha[k]=a;
+		if (below) a=-a;
+		double dd;
+		if (status[k]==AT_LB && a>PIVOT_TOL) dd=d[k]>0? d[k] : 0;
+		else if (status[k]==AT_UB && a<-PIVOT_TOL) dd=d[k]<0? -d[k] : 0;
+		else continue;
+		double theta=(dd+eps)/fabs(a);
+		if (theta<theta_max) theta_max=theta;
+	}
+
+	// second pass: the largest pivot among the candidates with a smaller ratio
+	int q=-1;
+	double max_pivot=0;
+	for (int k=0; k<n+m; k++) {
+		if (status[k]==BASIC || lo(k)==up(k)) continue;
+		double a=below? -alpha[k] : alpha[k];
+		double dd;
+		if (status[k]==AT_LB && a>PIVOT_TOL) dd=d[k]>0? d[k] : 0;
+		else if (status[k]==AT_UB && a<-PIVOT_TOL) dd=d[k]<0? -d[k] : 0;
+		else continue;
+		if (dd/fabs(a)<=theta_max && fabs(a)>max_pivot) {
+			max_pivot=fabs(a);
+			q=k;
+		}
+	}
+	return q;
+}
+
+int DualSimplex::primal_entering(double eps) const {
+	// Dantzig's rule
+	int q=-1;
+	double max_d=eps;
+	for (int k=0; k<n+m; k++) {
+		if (status[k]==BASIC || lo(k)==up(k)) continue;
+		double dk= status[k]==AT_LB ? -d[k] : d[k];
+		if (dk>max_d) {
+			max_d=dk;
+			q=k;
+		}
+	}
+	return q;
+}
+
+bool DualSimplex::blocking_bound(int k, double rate, double eps, double& bound, double& gap) const {
+	double l=lo_art(k);
+	double u=up_art(k);
+	double tol_l=eps*(fabs(l)>1? fabs(l):1);
+	double tol_u=eps*(fabs(u)>1? fabs(u):1);
+	if (rate<0) {
+		if (x[k]>u+tol_u) bound=u;          // infeasible (phase 1): blocked when it becomes feasible
+		else if (x[k]<l-tol_l) return false; // infeasible (phase 1): not blocked
+		else bound=l;
+		gap=x[k]-bound;
+	} else {
+		if (x[k]<l-tol_l) bound=l;
+		else if (x[k]>u+tol_u) return false;
+		else bound=u;
+		gap=bound-x[k];
+	}
+	if (gap<0) gap=0;
+	return true;
+}
+
+void DualSimplex::primal_step(int q, double eps) {
+	// w = B^{-1} M_q. When x_q moves by t*dir, x_B moves by -t*dir*w.
+	std::vector<double> w(m);
+	for (int i=0; i<m; i++) w[i]=col_dot(&binv[i*m],q);
+	double dir= status[q]==AT_LB ? 1 : -1;
+	double bound, gap;
+
+	// Harris ratio test, first pass: the maximal step with relaxed bounds
+	double theta_max=up_art(q)-lo_art(q);
+	for (int i=0; i<m; i++) {
+		double rate=-dir*w[i];
+		if (fabs(rate)<=PIVOT_TOL || !blocking_bound(head[i],rate,eps,bound,gap)) continue;
+		double theta=(gap+eps*(fabs(bound)>1? fabs(bound):1))/fabs(rate);
+		if (theta<theta_max) theta_max=theta;
+	}
+
+	// second pass: the largest pivot among the candidates with a smaller ratio
+	int r=-1;
+	bool below=false;
+	double max_pivot=0;
+	for (int i=0; i<m; i++) {
+		double rate=-dir*w[i];
+		if (fabs(rate)<=PIVOT_TOL || !blocking_bound(head[i],rate,eps,bound,gap)) continue;
+		if (gap/fabs(rate)<=theta_max && fabs(rate)>max_pivot) {
+			max_pivot=fabs(rate);
+			r=i;
+			below= bound==lo_art(head[i]);
+		}
+	}
+
+	if (r==-1) {
+		// bound flip of the entering variable
+		status[q]= status[q]==AT_LB ? AT_UB : AT_LB;
+	} else
+		pivot(r,q,below);
+}
+
+void DualSimplex::pivot(int r, int q, bool below) {
+	// w = B^{-1} M_q
+	std::vector<double> w(m);
+	for (int i=0; i<m; i++) w[i]=col_dot(&binv[i*m],q);
+
+	status[head[r]]= below? AT_LB : AT_UB;
+	head[r]=q;
+	status[q]=BASIC;
+
+	double piv=w[r];
+	if (fabs(piv)<SINGULAR_TOL || ++nb_pivots>=REFACTOR) {
+		if (!factorize()) slack_basis();
+		return;
+	}
+
+	double* row_r=&binv[r*m];
+	for (int j=0; j<m; j++) row_r[j]/=piv;
+	for (int i=0; i<m; i++) {
+		if (i==r || w[i]==0) continue;
+		double* row_i=&binv[i*m];
+		for (int j=0; j<m; j++) row_i[j]-=w[i]*row_r[j];
+	}
+}
+
+bool DualSimplex::certificate(const double* rho) {
+	// rho^T [A -I] z = 0 for all z; the bounds of z show that this is impossible.
+	// The coefficients of the basic variables are 0 or +/-1 (up to rounding errors)
+	// and the pivots smaller than PIVOT_TOL have been ignored in the ratio test.
+	Interval sum=Interval::ZERO;
+	for (int k=0; k<n+m; k++) {
+		farkas[k]=col_dot(rho,k);
+		if (status[k]==BASIC) farkas[k]=floor(farkas[k]+0.5);
+		else if (fabs(farkas[k])<=PIVOT_TOL) farkas[k]=0;
+		if (farkas[k]!=0)
+			sum+=farkas[k]*Interval(lo(k),up(k));
+	}
+
+	if (sum.lb()>0) {
+		for (int k=0; k<n+m; k++) farkas[k]=-farkas[k];
+		return true;
+	}
+	return sum.ub()<0;
+}
+
+DualSimplex::Status DualSimplex::solve(int max_iter, double max_time, double eps) {
+	clock_t start=clock();
+
+	warm_start=basis_ok;
+
+	if (!basis_ok) {
+		if ((int) hint_status.size()==n+m) {
+			// same structure as the last problem: start from its basis
+			head=hint_head;
+			status=hint_status;
+			if (factorize()) {
+				basis_ok=true;
+				warm_start=true;
+			}
+			else slack_basis();
+		}
+		else slack_basis();
+	}
+
+	x.resize(n+m);
+	d.resize(n+m);
+	alpha.resize(n+m);
+	farkas.assign(n+m,0.0);
+	nb_iter=0;
+
+	while (true) {
+		compute_primal();
+		int r=leaving_row(eps);
+
+		if (r==-1) {
+			// primal feasible basis: primal simplex
+			compute_duals(false,eps);
+			int q=primal_entering(eps);
+			if (q==-1) {
+				// optimal, unless a variable lies on an artificial bound
+				for (int k=0; k<n+m; k++) {
+					if ((status[k]==AT_LB && lo(k)<=-INF_BOUND) || (status[k]==AT_UB && up(k)>=INF_BOUND))
+						return UNBOUNDED;
+				}
+				_obj_value=0;
+				for (int j=0; j<n; j++) _obj_value+=c[j]*x[j];
+				return OPTIMAL;
+			}
+			if (nb_iter>=max_iter) return MAX_ITER;
+			if (((double) (clock()-start))/CLOCKS_PER_SEC>max_time) return TIME_OUT;
+			primal_step(q,eps);
+		}
+		else {
+			compute_duals(false,eps);
+			if (flip_bounds(eps)) {
+				// dual feasible basis: dual simplex
+				compute_primal();
+				r=leaving_row(eps);
+				if (r==-1) continue;
+				if (nb_iter>=max_iter) return MAX_ITER;
+				if (((double) (clock()-start))/CLOCKS_PER_SEC>max_time) return TIME_OUT;
+
+				bool below=x[head[r]]<lo_art(head[r]);
+				int q=dual_entering(r,below,eps);
+				if (q==-1)
+					return certificate(&binv[r*m]) ? INFEASIBLE : FAILED;
+				pivot(r,q,below);
+			} else {
+				// phase 1
+				compute_duals(true,eps);
+				int q=primal_entering(eps);
+				if (q==-1)
+					return certificate(&y[0]) ? INFEASIBLE : FAILED;
+				if (nb_iter>=max_iter) return MAX_ITER;
+				if (((double) (clock()-start))/CLOCKS_PER_SEC>max_time) return TIME_OUT;
+				primal_step(q,eps);
+			}
+		}
+		nb_iter++;
+	}
+}
+
+} // end namespace ibex
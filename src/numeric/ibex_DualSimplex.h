@@ -0,0 +1,344 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DualSimplex.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_DUAL_SIMPLEX_H__
+#define __IBEX_DUAL_SIMPLEX_H__
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Built-in dense dual simplex.
+ *
+ * Solves
+ * <pre>
+ *       min (or max) c^T x   s.t.   lb <= x <= ub,   rlb_i <= a_i^T x <= rub_i  (i=0..m-1)
+ * </pre>
+ * with a bounded-variable simplex working on the computational form Ax-s=0,
+ * where s is the vector of the row activities (one "slack" per row).
+ * The main algorithm is the dual simplex. When the current basis is primal
+ * feasible but not dual feasible (e.g., after a change of the objective), the primal
+ * simplex is used instead; when it is neither primal nor dual feasible, a primal
+ * phase 1 (minimization of the sum of infeasibilities) is performed.
+ * This is the engine of #ibex::LinearSolver when IBEX is configured with
+ * the built-in LP solver (--with-native-lp).
+ *
+ * The solver is tailored to the small dense problems that are solved many times
+ * in a row with slightly different data (e.g., the 2n linear programs of a polytope
+ * hull): the inverse of the basis matrix is stored as a dense matrix and the basis
+ * is kept from one call to #solve() to the other. After a change of the bounds, the
+ * basis remains dual feasible; after a change of the objective, it remains primal
+ * feasible. In both cases the next resolution starts from the last optimal basis (warm start).
+ *
+ * A bound larger than 1e20 in absolute value is considered as infinite. A nonbasic
+ * variable may be set to an artificial (finite) bound in place of an infinite one;
+ * if the optimal solution lies on an artificial bound, the problem is reported as unbounded.
+ */
+class DualSimplex {
+public:
+	typedef enum { OPTIMAL, INFEASIBLE, UNBOUNDED, MAX_ITER, TIME_OUT, FAILED } Status;
+
+	/**
+	 * \brief Create a problem with n variables, no constraint, a zero objective
+	 * (to be minimized) and infinite bounds.
+	 */
+	DualSimplex(int n);
+
+	/**
+	 * \brief Number of variables.
+	 */
+	int nb_vars() const;
+
+	/**
+	 * \brief Number of rows (constraints).
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Minimize (true) or maximize (false) the objective.
+	 */
+	void set_sense(bool minimize);
+
+	/**
+	 * \brief Set the coefficient of the jth variable in the objective.
+	 */
+	void set_obj(int j, double c);
+
+	/**
+	 * \brief Set the bounds of the jth variable.
+	 */
+	void set_var_bounds(int j, double lb, double ub);
+
+	/**
+	 * \brief Add the row rlb <= a^T x <= rub.
+	 *
+	 * \param a - array of nb_vars() coefficients.
+	 */
+	void add_row(const double* a, double rlb, double rub);
+
+	/**
+	 * \brief Remove all the rows.
+	 *
+	 * The current basis is kept as a hint: if the next resolution is performed with the
+	 * same number of rows (typically, the linear relaxation of the same system on another box),
+	 * it starts from this basis.
+	 */
+	void clear_rows();
+
+	/**
+	 * \brief Forget the current basis and the hint (the next resolution starts from the slack basis).
+	 */
+	void reset_basis();
+
+	/**
+	 * \brief Solve the problem.
+	 *
+	 * \param max_iter - maximal number of pivots
+	 * \param max_time - time limit (CPU seconds)
+	 * \param eps      - feasibility and optimality tolerance
+	 */
+	Status solve(int max_iter, double max_time, double eps);
+
+	/**
+	 * \brief Coefficient of the jth variable in the ith row.
+	 */
+	double coef(int i, int j) const;
+
+	/**
+	 * \brief Lower bound of the jth variable.
+	 */
+	double var_lb(int j) const;
+
+	/**
+	 * \brief Upper bound of the jth variable.
+	 */
+	double var_ub(int j) const;
+
+	/**
+	 * \brief Lower bound of the ith row.
+	 */
+	double row_lb(int i) const;
+
+	/**
+	 * \brief Upper bound of the ith row.
+	 */
+	double row_ub(int i) const;
+
+	/**
+	 * \brief Coefficient of the jth variable in the objective.
+	 */
+	double obj(int j) const;
+
+	/**
+	 * \brief True if the objective is minimized.
+	 */
+	bool minimize() const;
+
+	/**
+	 * \brief Objective value (after OPTIMAL).
+	 */
+	double obj_value() const;
+
+	/**
+	 * \brief Value of the jth variable (after OPTIMAL).
+	 */
+	double primal(int j) const;
+
+	/**
+	 * \brief Reduced cost of the jth variable (after OPTIMAL).
+	 *
+	 * This is the dual value of the bound constraint lb_j <= x_j <= ub_j.
+	 */
+	double var_dual(int j) const;
+
+	/**
+	 * \brief Dual value of the ith row (after OPTIMAL).
+	 *
+	 * The dual values satisfy c = sum_j var_dual(j) e_j + sum_i row_dual(i) a_i.
+	 * In minimization, a positive (resp. negative) dual value corresponds to an active
+	 * lower (resp. upper) bound.
+	 */
+	double row_dual(int i) const;
+
+	/**
+	 * \brief Infeasibility certificate of the jth variable bound (after INFEASIBLE).
+	 *
+	 * The certificate is a vector (y,z) such that sum_j y_j e_j + sum_i z_i a_i = 0 and
+	 * sum_j y_j*[lb_j,ub_j] + sum_i z_i*[rlb_i,rub_i] is an interval with a negative
+	 * upper bound (Farkas lemma).
+	 */
+	double var_farkas(int j) const;
+
+	/**
+	 * \brief Infeasibility certificate of the ith row (after INFEASIBLE).
+	 */
+	double row_farkas(int i) const;
+
+	/**
+	 * \brief Number of pivots of the last resolution.
+	 */
+	int nb_iter;
+
+	/**
+	 * \brief True if the last resolution has started from the basis
+	 * of a previous one (warm start).
+	 */
+	bool warm_start;
+
+	/**
+	 * \brief Number of factorizations of the basis matrix (since the creation).
+	 */
+	int nb_factorizations;
+
+protected:
+	typedef enum { BASIC, AT_LB, AT_UB } VarStatus;
+
+	/* Bounds of the kth variable of the computational form
+	 * (k<n: a variable, k>=n: the slack of the row k-n).
+	 * The artificial versions replace the infinite bounds. */
+	double lo(int k) const;
+	double up(int k) const;
+	double lo_art(int k) const;
+	double up_art(int k) const;
+
+	/* rho^T M_k, where M_k is the kth column of [A -I] */
+	double col_dot(const double* rho, int k) const;
+
+	/* Set the slack basis */
+	void slack_basis();
+
+	/* Recompute binv from scratch. Return false if the basis is singular */
+	bool factorize();
+
+	/* Compute the simplex multipliers y and the reduced costs d of the current basis,
+	 * with the objective (phase1=false) or with the sum of the infeasibilities of the
+	 * basic variables (phase1=true) */
+	void compute_duals(bool phase1, double eps);
+
+	/* Move the dual infeasible nonbasic variables to their opposite bound.
+	 * Return false (and do nothing) if one of these bounds is infinite. */
+	bool flip_bounds(double eps);
+
+	/* Compute the values of all the variables */
+	void compute_primal();
+
+	/* Select the leaving row (-1 if the basis is primal feasible) */
+	int leaving_row(double eps) const;
+
+	/* Dual ratio test: select the entering variable for the leaving row r.
+	 * Return -1 if the dual is unbounded. */
+	int dual_entering(int r, bool below, double eps);
+
+	/* Select the entering variable of the primal simplex (-1 if none) */
+	int primal_entering(double eps) const;
+
+	/* Bound of the basic variable k that blocks its move in the direction of rate,
+	 * and the distance to this bound. Return false if the move is not blocked. */
+	bool blocking_bound(int k, double rate, double eps, double& bound, double& gap) const;
+
+	/* Primal ratio test and update (pivot or bound flip) for the entering variable q */
+	void primal_step(int q, double eps);
+
+	/* Make q basic in place of head[r] */
+	void pivot(int r, int q, bool below);
+
+	/* Set the infeasibility certificate to rho^T [A -I] and check it with the original bounds */
+	bool certificate(const double* rho);
+
+	int n;                        // number of variables
+	int m;                        // number of rows
+	bool is_min;                  // minimization?
+	std::vector<double> c;        // objective
+	std::vector<double> lb, ub;   // bounds of the variables
+	std::vector<double> A;        // rows (m x n, row-major)
+	std::vector<double> rlb, rub; // bounds of the rows
+
+	bool basis_ok;                // true if head/status/binv is a valid basis
+	std::vector<int> head;        // basic variable of each row (m)
+	std::vector<int> status;      // status of each variable (n+m)
+	std::vector<double> binv;     // inverse of the basis matrix (m x m, row-major)
+	int nb_pivots;                // pivots since the last factorization
+	std::vector<int> hint_head;   // basis kept by clear_rows()
+	std::vector<int> hint_status;
+
+	std::vector<double> x;        // values of the variables (n+m)
+	std::vector<double> y;        // simplex multipliers (m)
+	std::vector<double> d;        // reduced costs (n+m)
+	std::vector<double> alpha;    // pivot row (n+m)
+	std::vector<double> farkas;   // infeasibility certificate (n+m)
+	double _obj_value;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int DualSimplex::nb_vars() const {
+	return n;
+}
+
+inline int DualSimplex::nb_rows() const {
+	return m;
+}
+
+inline double DualSimplex::coef(int i, int j) const {
+	return A[i*n+j];
+}
+
+inline double DualSimplex::var_lb(int j) const {
+	return lb[j];
+}
+
+inline double DualSimplex::var_ub(int j) const {
+	return ub[j];
+}
+
+inline double DualSimplex::row_lb(int i) const {
+	return rlb[i];
+}
+
+inline double DualSimplex::row_ub(int i) const {
+	return rub[i];
+}
+
+inline double DualSimplex::obj(int j) const {
+	return c[j];
+}
+
+inline bool DualSimplex::minimize() const {
+	return is_min;
+}
+
+inline double DualSimplex::obj_value() const {
+	return _obj_value;
+}
+
+inline double DualSimplex::primal(int j) const {
+	return x[j];
+}
+
+inline double DualSimplex::var_dual(int j) const {
+	return is_min? d[j] : -d[j];
+}
+
+inline double DualSimplex::row_dual(int i) const {
+	return is_min? d[n+i] : -d[n+i];
+}
+
+inline double DualSimplex::var_farkas(int j) const {
+	return farkas[j];
+}
+
+inline double DualSimplex::row_farkas(int i) const {
+	return farkas[n+i];
+}
+
+} // end namespace ibex
+#endif // __IBEX_DUAL_SIMPLEX_H__
@@ -12,6 +12,8 @@
 #include <float.h>
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
+#include <vector>
+#include <algorithm>
 
 #define TOO_LARGE 1e30
 #define TOO_SMALL 1e-10
@@ -208,6 +210,16 @@ void real_inverse(const Matrix& A, Matrix& invA) {
 	delete[] p;
 }
 
+double infinite_norm(const Matrix& A) {
+	double norm=0;
+	for (int i=0; i<A.nb_rows(); i++) {
+		double s=0;
+		for (int j=0; j<A.nb_cols(); j++) s+=fabs(A[i][j]);
+		if (s>norm) norm=s;
+	}
+	return norm;
+}
+
 void precond(IntervalMatrix& A) {
 	int n=(A.nb_rows());
 	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
@@ -377,5 +389,175 @@ void hansen_bliek(const IntervalMatrix& A, const IntervalVector& B, IntervalVect
 	}
 }
 
+namespace {
+
+/*
+ * Return the indices of the diagonal entries of A (-1 if not stored).
+ */
+int* diagonal(const IntervalSparseMatrix& A) {
+	int* diag=new int[A.nb_rows()];
+	for (int i=0; i<A.nb_rows(); i++)
+		diag[i]=A.find(i,i);
+	return diag;
+}
+
+}
+
+void precond(IntervalSparseMatrix& A, IntervalVector& b, int block_size) {
+	int n=A.nb_rows();
+	assert(n == A.nb_cols());
+	assert(n == b.size());
+	assert(block_size>0);
+
+	int* row_start=new int[n+1];
+	vector<int> col;
+	vector<Interval> val;
+	col.reserve(A.nb_nonzeros());
+	val.reserve(A.nb_nonzeros());
+
+	// pos[j]: position of the column j in the current block of rows (-1 if none)
+	int* pos=new int[n];
+	for (int j=0; j<n; j++) pos[j]=-1;
+
+	row_start[0]=0;
+
+	for (int r0=0; r0<n; r0+=block_size) {
+		int s= r0+block_size<=n ? block_size : n-r0;
+
+		// union of the structures of the rows (sorted)
+		vector<int> cols;
+		for (int i=r0; i<r0+s; i++)
+			for (int k=A.row_begin(i); k<A.row_end(i); k++)
+				if (pos[A.col(k)]==-1) {
+					pos[A.col(k)]=0;
+					cols.push_back(A.col(k));
+				}
+		std::sort(cols.begin(),cols.end());
+		for (unsigned int c=0; c<cols.size(); c++) pos[cols[c]]=c;
+
+		// the diagonal block
+		IntervalMatrix D(s,s,Interval::ZERO);
+		for (int i=0; i<s; i++)
+			for (int j=0; j<s; j++)
+				D[i][j]=A(r0+i,r0+j);
+
+		Matrix C(s,s);
+		bool found=true;
+		try { real_inverse(D.mid(), C); }
+		catch (SingularMatrixException&) {
+			try { real_inverse(D.lb(), C); }
+			catch (SingularMatrixException&) {
+				try { real_inverse(D.ub(), C); }
+				catch (SingularMatrixException&) {
+					found=false;
+				}
+			}
+		}
+
+		if (found) {
+			// dense product C*A on the selected columns
+			IntervalMatrix CA(s,cols.size(),Interval::ZERO);
+			IntervalVector Cb(s,Interval::ZERO);
+			for (int t=0; t<s; t++) {
+				int i=r0+t;
+				for (int r=0; r<s; r++) {
+					if (C[r][t]==0) continue;
+					for (int k=A.row_begin(i); k<A.row_end(i); k++)
+						CA[r][pos[A.col(k)]]+=C[r][t]*A.val(k);
+					Cb[r]+=C[r][t]*b[i];
+				}
+			}
+			for (int r=0; r<s; r++) {
+				for (unsigned int c=0; c<cols.size(); c++) {
+					if (CA[r][c]!=Interval::ZERO) {
+						col.push_back(cols[c]);
+						val.push_back(CA[r][c]);
+					}
+				}
+				row_start[r0+r+1]=col.size();
+				b[r0+r]=Cb[r];
+			}
+		} else {
+			for (int i=r0; i<r0+s; i++) {
+				for (int k=A.row_begin(i); k<A.row_end(i); k++) {
+					col.push_back(A.col(k));
+					val.push_back(A.val(k));
+				}
+				row_start[i+1]=col.size();
+			}
+		}
+
+		for (unsigned int c=0; c<cols.size(); c++) pos[cols[c]]=-1;
+	}
+
+	IntervalSparseMatrix CA(n,n,row_start,col.empty()? NULL : &col[0]);
+	for (int k=0; k<CA.nb_nonzeros(); k++)
+		CA.val(k)=val[k];
+	A=CA;
+
+	delete[] pos;
+	delete[] row_start;
+}
+
+void gauss_seidel(const IntervalSparseMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols()));
+	assert(n == (x.size()) && n == (b.size()));
+
+	int* diag=diagonal(A);
+	double red;
+	Interval old, proj, tmp;
+
+	do {
+		red = 0;
+		for (int i=0; i<n; i++) {
+			old = x[i];
+			proj = b[i];
+
+			for (int k=A.row_begin(i); k<A.row_end(i); k++)
+				if (k!=diag[i]) proj -= A.val(k)*x[A.col(k)];
+			tmp= diag[i]==-1 ? Interval::ZERO : A.val(diag[i]);
+
+			proj_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); delete[] diag; return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+
+	delete[] diag;
+}
+
+bool inflating_gauss_seidel(const IntervalSparseMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols()));
+	assert(n == (x.size()) && n == (b.size()));
+	assert(min_dist>0);
+
+	int* diag=diagonal(A);
+	IntervalVector xold(n);
+	Interval proj;
+	double d=DBL_MAX; // Hausdorff distances between 2 iterations
+	double dold;
+	double mu; // ratio of dist(x_k,x_{k-1)) / dist(x_{k-1},x_{k-2}).
+	do {
+		dold = d;
+		xold = x;
+		for (int i=0; i<n; i++) {
+			proj = b[i];
+			for (int k=A.row_begin(i); k<A.row_end(i); k++)
+				if (k!=diag[i]) proj -= A.val(k)*x[A.col(k)];
+			x[i] = diag[i]==-1 ? Interval::ALL_REALS : proj/A.val(diag[i]);
+		}
+		d=distance(xold,x);
+		mu=d/dold;
+	} while (mu<mu_max && d>min_dist);
+
+	delete[] diag;
+	return (mu<mu_max);
+}
+
 } // end namespace
 
@@ -12,6 +12,7 @@
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_IntervalSparseMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -86,6 +87,15 @@ void interval_LU(const IntervalMatrix& A, IntervalMatrix& LU, int* pr, int* pc);
  */
 void real_inverse(const Matrix& A, Matrix& invA);
 
+/**
+ * \ingroup numeric
+ *
+ * \brief Infinite norm of a real matrix (maximal sum of absolute values of a row).
+ *
+ * \warning No outwarding is performed.
+ */
+double infinite_norm(const Matrix& A);
+
 /**
  * \ingroup numeric
  *
@@ -182,6 +192,48 @@ bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, In
  */
 void hansen_bliek(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x);
 
+/**
+ * \ingroup numeric
+ *
+ * \brief Preconditions a sparse system \f$[A]x=[b]\f$ (block-diagonal preconditioning).
+ *
+ * The rows of [A] are grouped into consecutive blocks of (at most) \a block_size rows.
+ * Each block of rows is multiplied by the inverse of the midpoint (or, if singular,
+ * the lower or upper bound) of the corresponding diagonal block of [A].
+ * A block for which no inverse is found is left unchanged.
+ *
+ * The result is sparse: the structure of a preconditioned row is the union of the
+ * structures of the rows of its block. Time and memory are proportional to
+ * \a block_size times the number of non-zero entries of [A].
+ *
+ * With block_size=n, this is the dense preconditioning of
+ * #precond(IntervalMatrix&, IntervalVector&) (but with a dense result).
+ *
+ * \param A (in/output)- The interval matrix [A] to be replaced by \f$C^{-1}[A]\f$.
+ * \param b (in/output)- The interval vector [b] to be replaced by \f$C^{-1}[b]\f$.
+ */
+void precond(IntervalSparseMatrix& A, IntervalVector& b, int block_size=8);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Gauss-Seidel algorithm on a sparse matrix.
+ *
+ * Same as #gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double)
+ * but each sweep is linear in the number of non-zero entries of [A].
+ */
+void gauss_seidel(const IntervalSparseMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Gauss-Seidel algorithm on a sparse matrix (inflating variant).
+ *
+ * Same as #inflating_gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double, double)
+ * but each sweep is linear in the number of non-zero entries of [A].
+ */
+bool inflating_gauss_seidel(const IntervalSparseMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist=1e-12, double mu_max_divergence=1.0);
+
 
 } // end namespace
 
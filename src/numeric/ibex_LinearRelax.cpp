@@ -9,13 +9,116 @@
 //============================================================================
 
 #include "ibex_LinearRelax.h"
+#include "ibex_LinearRelaxCache.h"
+#include "ibex_Entailment.h"
 
 namespace ibex {
 
-LinearRelax::LinearRelax(const System& sys) : sys(sys) { }
+const double LinearRelax::default_reuse_ratio = 0.9;
+
+LinearRelax::LinearRelax(const System& sys) : sys(sys), nb_ctr_relaxed(0), nb_ctr_reused(0), entailment(NULL) { }
 
 LinearRelax::~LinearRelax() { }
 
+int LinearRelax::linearization_ctr(IntervalVector& box, LinearSolver *mysolver, int ctr, LinearRows& rows) {
+	return -1;
+}
+
+void LinearRelax::set_entailment(const Entailment* e) {
+	entailment=e;
+}
+
+bool LinearRelax::entailed(int ctr) const {
+	return entailment!=NULL && entailment->is_entailed(sys.ctrs[ctr]);
+}
+
+int LinearRelax::linearization_ctrs(IntervalVector& box, LinearSolver *mysolver, const std::vector<int>& ctrs, const std::vector<LinearRows*>& rows) {
+	int cont=0;
+	for (unsigned int k=0; k<ctrs.size(); k++) {
+		int n=linearization_ctr(box,mysolver,ctrs[k],*rows[k]);
+		if (n<0) return -1;
+		cont+=n;
+	}
+	return cont;
+}
+
+bool LinearRelax::reusable(const IntervalVector& box, int ctr, const std::vector<Interval>& dom, double ratio) const {
+	const Function& f=sys.ctrs[ctr].f;
+
+	for (int k=0; k<f.nb_used_vars; k++) {
+		const Interval& x=box[f.used_var[k]];
+		if (!x.is_subset(dom[k])) return false;
+		if (dom[k].diam()==POS_INFINITY) {
+			if (x!=dom[k]) return false;   // no way to measure the reduction
+		} else if (x.diam() < ratio*dom[k].diam())
+			return false;
+	}
+	return true;
+}
+
+int LinearRelax::linearization(IntervalVector& box, LinearSolver *mysolver, LinearRelaxCache& cache, double ratio) {
+	LinearRows rows;
+
+	if (generate_rows(box,mysolver,rows,&cache,ratio)<0)
+		return linearization(box,mysolver); // not supported by the linearization technique
+
+	// all the rows are added to the LP at once
+	if (rows.size()>0 && mysolver->addConstraints(rows)==LinearSolver::OK)
+		return rows.size();
+	else
+		return 0;
+}
+
+int LinearRelax::generate_rows(IntervalVector& box, LinearSolver *mysolver, LinearRows& rows, LinearRelaxCache* cache, double ratio) {
+
+	if (cache==NULL) {
+		std::vector<int> ctrs;
+		for (int ctr=0; ctr<sys.nb_ctr; ctr++)
+			if (!entailed(ctr)) ctrs.push_back(ctr);
+		if (linearization_ctrs(box,mysolver,ctrs,std::vector<LinearRows*>(ctrs.size(),&rows))<0) return -1;
+		return rows.size();
+	}
+
+	std::vector<LinearRelaxCache::Entry>& entries=cache->entries(*this);
+
+	// the constraints to be linearized again
+	std::vector<int> ctrs;
+	std::vector<LinearRows*> ctr_rows;
+	for (int ctr=0; ctr<sys.nb_ctr; ctr++) {
+		LinearRelaxCache::Entry& e=entries[ctr];
+
+		if (entailed(ctr)) continue; // the cached rows (if any) are kept but not used
+
+		if (e.valid && reusable(box,ctr,e.domain,ratio)) {
+			nb_ctr_reused++;
+		} else {
+			e.valid=false;
+			e.rows.clear();
+			ctrs.push_back(ctr);
+			ctr_rows.push_back(&e.rows);
+		}
+	}
+
+	if (!ctrs.empty()) {
+		if (linearization_ctrs(box,mysolver,ctrs,ctr_rows)<0) return -1;
+
+		for (unsigned int k=0; k<ctrs.size(); k++) {
+			LinearRelaxCache::Entry& e=entries[ctrs[k]];
+			const Function& f=sys.ctrs[ctrs[k]].f;
+			e.domain.resize(f.nb_used_vars);
+			for (int i=0; i<f.nb_used_vars; i++)
+				e.domain[i]=box[f.used_var[i]];
+			e.valid=true;
+			nb_ctr_relaxed++;
+		}
+	}
+
+	for (int ctr=0; ctr<sys.nb_ctr; ctr++)
+		if (!entailed(ctr)) rows.append(entries[ctr].rows);
+
+	return rows.size();
+}
+
 bool LinearRelax::isInner(IntervalVector & box, const System& sys, int j) {
 	Interval eval=sys.ctrs[j].f.eval(box);
 
@@ -13,9 +13,13 @@
 
 #include "ibex_System.h"
 #include "ibex_LinearSolver.h"
+#include <vector>
 
 namespace ibex {
 
+class LinearRelaxCache;
+class Entailment;
+
 /**
  * \brief Linear relaxation
  *
@@ -35,6 +39,55 @@ public:
 	 */
 	virtual int linearization(IntervalVector& box, LinearSolver *mysolver) =0;
 
+	/**
+	 * \brief Linearization of a single constraint.
+	 *
+	 * Add to \a rows the linear relaxation of the constraint n°ctr of the system
+	 * (the rows are not added to the LP).
+	 *
+	 * \return the number of rows added or -1 if the linearization technique
+	 *         does not linearize the constraints separately (default implementation).
+	 * \throw EmptyBoxException if the constraint is proven infeasible.
+	 */
+	virtual int linearization_ctr(IntervalVector& box, LinearSolver *mysolver, int ctr, LinearRows& rows);
+
+	/**
+	 * \brief Linearization of several constraints.
+	 *
+	 * Add to \a *rows[k] the linear relaxation of the constraint n°ctrs[k]
+	 * (the pointers may be equal). By default, calls #linearization_ctr(...) for each
+	 * constraint; can be overridden to share computations between the constraints.
+	 *
+	 * \return the total number of rows added or -1 if not implemented.
+	 */
+	virtual int linearization_ctrs(IntervalVector& box, LinearSolver *mysolver, const std::vector<int>& ctrs, const std::vector<LinearRows*>& rows);
+
+	/**
+	 * \brief Incremental linearization.
+	 *
+	 * Same as #linearization(IntervalVector&, LinearSolver*) except that the
+	 * linearization of each constraint is stored in \a cache and only recomputed if the
+	 * domain of one of its variables has changed significantly since the last time, i.e.,
+	 * if it is not included in the domain used for the cached rows or if its diameter is less
+	 * than \a ratio times the diameter of this domain. A linear relaxation of a constraint
+	 * over a domain is also a relaxation over any subdomain, so the cached rows remain valid.
+	 *
+	 * Falls back to the non-incremental linearization if #linearization_ctr(...) is not
+	 * implemented.
+	 */
+	int linearization(IntervalVector& box, LinearSolver *mysolver, LinearRelaxCache& cache, double ratio=default_reuse_ratio);
+
+	/**
+	 * \brief Generation of the rows of the linearized system.
+	 *
+	 * Add to \a rows the linearizations of all the constraints, without adding them to the LP
+	 * (e.g., for filtering them first). If \a cache is not NULL, the linearization is incremental
+	 * (see above).
+	 *
+	 * \return the number of rows or -1 if #linearization_ctr(...) is not implemented.
+	 */
+	int generate_rows(IntervalVector& box, LinearSolver *mysolver, LinearRows& rows, LinearRelaxCache* cache=NULL, double ratio=default_reuse_ratio);
+
 	/**
 	 * Check if the constraint is satisfied in the box : in this case, no linear relaxation is made.
 	 *
@@ -42,10 +95,46 @@ public:
 	 */
 	bool isInner(IntervalVector & box, const System& sys, int j);
 
+	/**
+	 * \brief Set the entailed constraints (NULL pointer means "none").
+	 *
+	 * The constraints entailed in the box (e.g., recorded in the current cell, see
+	 * #ibex::Entailment) are not linearized: the box satisfies their linear relaxation.
+	 */
+	virtual void set_entailment(const Entailment* e);
+
 	/**
 	 * \brief The system linearized
 	 */
 	const System& sys;
+
+	/**
+	 * \brief Default ratio for reusing a cached linearization (0.9).
+	 */
+	static const double default_reuse_ratio;
+
+	/** Number of constraints linearized by the incremental linearization */
+	int nb_ctr_relaxed;
+
+	/** Number of constraints whose cached linearization has been reused */
+	int nb_ctr_reused;
+
+protected:
+	/**
+	 * \brief True if the cached linearization of the constraint n°ctr computed
+	 * with the domains \a dom of its variables can be reused for \a box.
+	 */
+	bool reusable(const IntervalVector& box, int ctr, const std::vector<Interval>& dom, double ratio) const;
+
+	/**
+	 * \brief True if the constraint n°ctr is entailed (see #set_entailment(const Entailment*)).
+	 */
+	bool entailed(int ctr) const;
+
+	/**
+	 * \brief The entailed constraints (NULL if none).
+	 */
+	const Entailment* entailment;
 };
 
 } // end namespace ibex
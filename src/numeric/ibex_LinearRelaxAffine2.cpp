@@ -10,6 +10,7 @@
 
 #include "ibex_LinearRelaxAffine2.h"
 #include "ibex_EmptyBoxException.h"
+#include "ibex_Affine2Vector.h"
 
 namespace ibex {
 
@@ -27,87 +28,133 @@ LinearRelaxAffine2::~LinearRelaxAffine2() {
 /*********generation of the linearized system*********/
 int LinearRelaxAffine2::linearization(IntervalVector & box, LinearSolver *mysolver) {
 
+	int cont = 0;
+	LinearRows rows;
+
+	// Create the linear relaxation of each constraint
+	std::vector<int> ctrs;
+	for (int ctr = 0; ctr < sys.nb_ctr; ctr++)
+		if (!entailed(ctr)) ctrs.push_back(ctr);
+	linearization_ctrs(box, mysolver, ctrs, std::vector<LinearRows*>(ctrs.size(),&rows));
+
+	// all the rows are added to the LP at once
+	if (rows.size()>0 && mysolver->addConstraints(rows) == LinearSolver::OK)
+		cont = rows.size();
+
+	return cont;
+
+}
+
+int LinearRelaxAffine2::linearization_ctrs(IntervalVector & box, LinearSolver *mysolver, const std::vector<int>& ctrs, const std::vector<LinearRows*>& rows) {
+
+	int cont = 0;
+
+	// If all the constraints are real-valued, the affine forms of all the
+	// constraints are obtained by a single evaluation of the system function
+	// (the forms of the variables are created once). This is only
+	// worth if most of the constraints are to be linearized.
+	if (ctrs.size()>1 && 2*ctrs.size()>=(unsigned int) sys.nb_ctr && sys.f.image_dim()==sys.nb_ctr) {
+		Affine2Vector af2(sys.nb_ctr);
+		IntervalVector ev = sys.f.eval_affine2_vector(box, af2);
+
+		// if the image of one of the constraints is empty, they are evaluated separately
+		if (!ev.is_empty()) {
+			for (unsigned int k = 0; k < ctrs.size(); k++)
+				cont += add_rows(box, mysolver, ctrs[k], af2[ctrs[k]], ev[ctrs[k]], *rows[k]);
+			return cont;
+		}
+	}
+
+	for (unsigned int k = 0; k < ctrs.size(); k++)
+		cont += linearization_ctr(box, mysolver, ctrs[k], *rows[k]);
+
+	return cont;
+}
+
+int LinearRelaxAffine2::linearization_ctr(IntervalVector & box, LinearSolver *mysolver, int ctr, LinearRows& rows) {
+
 	Affine2 af2;
-	Vector rowconst(sys.nb_var);
 	Interval ev(0.0);
+
+	af2 = 0.0;
+	ev = sys.ctrs[ctr].f.eval_affine2(box, af2);
+
+	return add_rows(box, mysolver, ctr, af2, ev, rows);
+}
+
+int LinearRelaxAffine2::add_rows(IntervalVector & box, LinearSolver *mysolver, int ctr, const Affine2& af2, const Interval& ev, LinearRows& rows) {
+
+	Vector rowconst(sys.nb_var); // the nonzero coefficients of a row
+	std::vector<int> col(sys.nb_var); // and their variables
+	int nnz;
 	Interval center(0.0);
 	Interval err(0.0);
-	CmpOp op;
-	int cont = 0;
-	LinearSolver::Status stat = LinearSolver::FAIL;
-
+	CmpOp op = sys.ctrs[ctr].op;
+	int cont = rows.size();
+
+	if (af2.size() == sys.nb_var) { // if the affine2 form is valid
+
+		// convert the epsilon variables to the original box
+		// (only the variables used by the constraint have a nonzero coefficient)
+		const Function& f=sys.ctrs[ctr].f;
+		double tmp=0;
+		center =0;
+		err =0;
+		nnz =0;
+		for (int k =0; k <f.nb_used_vars; k++) {
+			int i = f.used_var[k];
+			tmp = box[i].rad();
+			//		if (tmp> mysolver->getEpsilon()) {
+			rowconst[nnz] =af2.val(i+1) / tmp;
+			center += rowconst[nnz]*box[i].mid();
+			err += fabs(rowconst[nnz])*  pow(2,-50); // TODO to check
+			//		} else {
+			//			rowconst[i] = 0;
+			//			err += tmp;
+			//		}
+			col[nnz++] = i;
+		}
 
-	// Create the linear relaxation of each constraint
-	for (int ctr = 0; ctr < sys.nb_ctr; ctr++) {
-
-		af2 = 0.0;
-		ev = sys.ctrs[ctr].f.eval_affine2(box, af2);
-		op = sys.ctrs[ctr].op;
-
-		if (af2.size() == sys.nb_var) { // if the affine2 form is valid
-
-			// convert the epsilon variables to the original box
-			double tmp=0;
-			center =0;
-			err =0;
-			for (int i =0; i <sys.nb_var; i++) {
-				tmp = box[i].rad();
-				//		if (tmp> mysolver->getEpsilon()) {
-				rowconst[i] =af2.val(i+1) / tmp;
-				center += rowconst[i]*box[i].mid();
-				err += fabs(rowconst[i])*  pow(2,-50); // TODO to check
-				//		} else {
-				//			rowconst[i] = 0;
-				//			err += tmp;
-				//		}
+		switch (op) {
+		case LEQ:
+			if (0.0 == ev.lb())
+				throw EmptyBoxException();
+		case LT: {
+			if (0.0 < ev.lb())
+				throw EmptyBoxException();
+			else if (0.0 < ev.ub()) {
+				rows.add(nnz, &col[0], &rowconst[0], LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
 			}
-
-			switch (op) {
-			case LEQ:
-				if (0.0 == ev.lb())
-					throw EmptyBoxException();
-			case LT: {
-				if (0.0 < ev.lb())
-					throw EmptyBoxException();
-				else if (0.0 < ev.ub()) {
-					stat = mysolver->addConstraint(rowconst, LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
-					if (stat == LinearSolver::OK)	cont++;
-				}
-				break;
+			break;
+		}
+		case GEQ:
+			if (ev.ub() == 0.0)
+				throw EmptyBoxException();
+			break;
+		case GT: {
+			if (ev.ub() < 0.0)
+				throw EmptyBoxException();
+			else if (ev.lb() < 0.0) {
+				rows.add(nnz, &col[0], &rowconst[0], GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
 			}
-			case GEQ:
-				if (ev.ub() == 0.0)
-					throw EmptyBoxException();
-				break;
-			case GT: {
-				if (ev.ub() < 0.0)
-					throw EmptyBoxException();
-				else if (ev.lb() < 0.0) {
-					stat = mysolver->addConstraint(rowconst, GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
-					if (stat == LinearSolver::OK)	cont++;
-				}
-				break;
+			break;
+		}
+		case EQ: {
+			if (!ev.contains(0.0)) {
+				throw EmptyBoxException();
 			}
-			case EQ: {
-				if (!ev.contains(0.0)) {
-					throw EmptyBoxException();
-				}
-				else {
-					if (ev.diam()>2*mysolver->getEpsilon()) {
-						stat = mysolver->addConstraint(rowconst, GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
-						if (stat == LinearSolver::OK)	cont++;
-						stat = mysolver->addConstraint(rowconst, LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
-						if (stat == LinearSolver::OK)	cont++;
-					}
+			else {
+				if (ev.diam()>2*mysolver->getEpsilon()) {
+					rows.add(nnz, &col[0], &rowconst[0], GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
+					rows.add(nnz, &col[0], &rowconst[0], LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
 				}
-				break;
-			}
 			}
+			break;
+		}
 		}
-
 	}
-	return cont;
 
+	return rows.size()-cont;
 }
 
 //void CtcART::convert_back(IntervalVector & box, IntervalVector & epsilon) {
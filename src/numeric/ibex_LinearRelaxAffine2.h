@@ -40,6 +40,26 @@ public:
   the 2 bounds of each variable */
 	int linearization( IntervalVector & box, LinearSolver *mysolver);
 
+	/**
+	 * \brief Linearization of the constraint n°ctr (rows not added to the LP).
+	 */
+	int linearization_ctr( IntervalVector & box, LinearSolver *mysolver, int ctr, LinearRows& rows);
+
+	/**
+	 * \brief Linearization of several constraints (rows not added to the LP).
+	 *
+	 * If most of the constraints are linearized, the affine forms are computed by a
+	 * single evaluation of the system function #System::f.
+	 */
+	int linearization_ctrs( IntervalVector & box, LinearSolver *mysolver, const std::vector<int>& ctrs, const std::vector<LinearRows*>& rows);
+
+protected:
+	/**
+	 * \brief Add the rows of the constraint n°ctr, given its affine form
+	 * \a af2 and its evaluation \a ev on the box.
+	 */
+	int add_rows( IntervalVector & box, LinearSolver *mysolver, int ctr, const Affine2& af2, const Interval& ev, LinearRows& rows);
+
 };
 
 } // end namespace ibex
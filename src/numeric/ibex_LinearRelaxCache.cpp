@@ -0,0 +1,36 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LinearRelaxCache.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_LinearRelaxCache.h"
+
+namespace ibex {
+
+LinearRelaxCache::LinearRelaxCache() {
+
+}
+
+LinearRelaxCache::LinearRelaxCache(const LinearRelaxCache& c) : Backtrackable(), data(c.data) {
+
+}
+
+LinearRelaxCache::~LinearRelaxCache() {
+
+}
+
+std::vector<LinearRelaxCache::Entry>& LinearRelaxCache::entries(const LinearRelax& lr) {
+	std::vector<Entry>& e=data[&lr];
+	if ((int) e.size()!=lr.sys.nb_ctr) e.resize(lr.sys.nb_ctr);
+	return e;
+}
+
+std::pair<Backtrackable*,Backtrackable*> LinearRelaxCache::down() {
+	return std::pair<Backtrackable*,Backtrackable*>(new LinearRelaxCache(*this),new LinearRelaxCache(*this));
+}
+
+} // end namespace ibex
@@ -0,0 +1,84 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LinearRelaxCache.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_LINEAR_RELAX_CACHE_H__
+#define __IBEX_LINEAR_RELAX_CACHE_H__
+
+#include "ibex_Backtrackable.h"
+#include "ibex_LinearRelax.h"
+#include <map>
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup numeric
+ *
+ * \brief Linearizations of the constraints stored in a cell.
+ *
+ * Stores, for each linear relaxation, the rows generated for each constraint
+ * and the domains of the variables used to generate them. The structure is
+ * inherited by the children cells, so that a linearization computed in a node
+ * can be reused in the subtree (see #ibex::LinearRelax::linearization(IntervalVector&, LinearSolver*, LinearRelaxCache&, double)).
+ */
+class LinearRelaxCache : public Backtrackable {
+public:
+
+	/**
+	 * \brief Cached linearization of a constraint.
+	 */
+	class Entry {
+	public:
+		Entry();
+
+		/** True if #rows is a linearization of the constraint over #domain. */
+		bool valid;
+
+		/** Domains of the variables used by the constraint (in the order of Function::used_var). */
+		std::vector<Interval> domain;
+
+		/** The rows. */
+		LinearRows rows;
+	};
+
+	/**
+	 * \brief Create an empty cache (root node).
+	 */
+	LinearRelaxCache();
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~LinearRelaxCache();
+
+	/**
+	 * \brief Cached linearizations of the constraints for the relaxation \a lr.
+	 *
+	 * One entry per constraint of lr.sys (created empty the first time).
+	 */
+	std::vector<Entry>& entries(const LinearRelax& lr);
+
+	/**
+	 * \brief Duplicate the structure into the left/right nodes
+	 */
+	std::pair<Backtrackable*,Backtrackable*> down();
+
+protected:
+	LinearRelaxCache(const LinearRelaxCache&);
+
+	std::map<const LinearRelax*, std::vector<Entry> > data;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline LinearRelaxCache::Entry::Entry() : valid(false) {
+
+}
+
+} // end namespace ibex
+#endif // __IBEX_LINEAR_RELAX_CACHE_H__
@@ -74,6 +74,12 @@ LinearRelaxCombo::~LinearRelaxCombo() {
 
 
 
+void LinearRelaxCombo::set_entailment(const Entailment* e) {
+	LinearRelax::set_entailment(e);
+	if (myart!=NULL) myart->set_entailment(e);
+	if (myxnewton!=NULL) myxnewton->set_entailment(e);
+}
+
 /*********generation of the linearized system*********/
 int LinearRelaxCombo::linearization(IntervalVector & box, LinearSolver *mysolver) {
 
@@ -102,7 +108,54 @@ int LinearRelaxCombo::linearization(IntervalVector & box, LinearSolver *mysolver
 	return cont;
 }
 
+int LinearRelaxCombo::linearization_ctr(IntervalVector & box, LinearSolver *mysolver, int ctr, LinearRows& rows) {
 
+	int cont = 0;
+
+	switch (lmode) {
+	case ART:
+	case AFFINE2: {
+		cont = myart->linearization_ctr(box,mysolver,ctr,rows);
+		break;
+	}
+	case XNEWTON:
+	case TAYLOR:
+	case HANSEN: {
+		cont = myxnewton->linearization_ctr(box,mysolver,ctr,rows);
+		break;
+	}
+	case COMPO: {
+		cont  = myxnewton->linearization_ctr(box,mysolver,ctr,rows);
+		cont += myart->linearization_ctr(box,mysolver,ctr,rows);
+		break;
+	}
+	}
+	return cont;
+}
 
+int LinearRelaxCombo::linearization_ctrs(IntervalVector & box, LinearSolver *mysolver, const std::vector<int>& ctrs, const std::vector<LinearRows*>& rows) {
+
+	int cont = 0;
+
+	switch (lmode) {
+	case ART:
+	case AFFINE2: {
+		cont = myart->linearization_ctrs(box,mysolver,ctrs,rows);
+		break;
+	}
+	case XNEWTON:
+	case TAYLOR:
+	case HANSEN: {
+		cont = myxnewton->linearization_ctrs(box,mysolver,ctrs,rows);
+		break;
+	}
+	case COMPO: {
+		cont  = myxnewton->linearization_ctrs(box,mysolver,ctrs,rows);
+		cont += myart->linearization_ctrs(box,mysolver,ctrs,rows);
+		break;
+	}
+	}
+	return cont;
+}
 
 }
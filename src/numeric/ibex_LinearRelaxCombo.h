@@ -56,6 +56,21 @@ public:
   	 */
 	int linearization( IntervalVector & box, LinearSolver *mysolver);
 
+	/**
+	 * \brief Linearization of the constraint n°ctr (rows not added to the LP).
+	 */
+	int linearization_ctr( IntervalVector & box, LinearSolver *mysolver, int ctr, LinearRows& rows);
+
+	/**
+	 * \brief Linearization of several constraints (rows not added to the LP).
+	 */
+	int linearization_ctrs( IntervalVector & box, LinearSolver *mysolver, const std::vector<int>& ctrs, const std::vector<LinearRows*>& rows);
+
+	/**
+	 * \brief Set the entailed constraints of the two linearization techniques.
+	 */
+	void set_entailment(const Entailment* e);
+
 private:
 
 	/**  AFFINE2 | TAYLOR | HANSEN | COMPO : the linear relaxation method */
@@ -72,36 +72,50 @@ LinearRelaxXTaylor::~LinearRelaxXTaylor() {
 int LinearRelaxXTaylor::linearization( IntervalVector & box, LinearSolver *mysolver)  {
 
 	int cont =0;
+	LinearRows rows;
 
 	// Create the linear relaxation of each constraint
 	for(int ctr=0; ctr<sys.nb_ctr; ctr++) {
+		if (entailed(ctr)) continue;
+		cont += linearization_ctr(box, mysolver, ctr, rows);
+	}
 
-		IntervalVector G(sys.nb_var);
+	// all the rows are added to the LP at once
+	if (cont>0 && mysolver->addConstraints(rows)!=LinearSolver::OK)
+		cont = 0;
 
-		if(lmode==TAYLOR) {                 // derivatives are computed once (Taylor)
-			sys.ctrs[ctr].f.gradient(box,G);
-		}
-		else
-			// to set all the constant derivatives that have been already computed
-			// (the other will be overwritten)
-			G=linear_coef.row(ctr);
-
-		int nb_nonlinear_vars;
-		if(cpoints[0]==K4) {
-			for(int j=0; j<4; j++)
-				cont += X_Linearization(box, ctr, K4, G, j, nb_nonlinear_vars,mysolver);
-		} else  //  linearizations k corners per constraint
-			for(int k=0; k<(cpoints.size()); k++) {
-				cont += X_Linearization(box, ctr, cpoints[k],  G, k, nb_nonlinear_vars,mysolver);
-			}
+	return cont;
+}
+
+int LinearRelaxXTaylor::linearization_ctr( IntervalVector & box, LinearSolver *mysolver, int ctr, LinearRows& rows)  {
+
+	int cont =0;
+	IntervalVector G(sys.nb_var);
+
+	if(lmode==TAYLOR) {                 // derivatives are computed once (Taylor)
+		sys.ctrs[ctr].f.gradient(box,G);
 	}
+	else
+		// to set all the constant derivatives that have been already computed
+		// (the other will be overwritten)
+		G=linear_coef.row(ctr);
+
+	int nb_nonlinear_vars;
+	if(cpoints[0]==K4) {
+		for(int j=0; j<4; j++)
+			cont += X_Linearization(box, ctr, K4, G, j, nb_nonlinear_vars,rows);
+	} else  //  linearizations k corners per constraint
+		for(int k=0; k<(cpoints.size()); k++) {
+			cont += X_Linearization(box, ctr, cpoints[k],  G, k, nb_nonlinear_vars,rows);
+		}
+
 	return cont;
 }
 
 
 // TODO A quoi sert "nb_nonlinear_vars" ?
 int LinearRelaxXTaylor::X_Linearization(IntervalVector& box, int ctr, corner_point cpoint,
-		IntervalVector& G, int id_point, int& nb_nonlinear_vars, LinearSolver *mysolver) {
+		IntervalVector& G, int id_point, int& nb_nonlinear_vars, LinearRows& rows) {
 
 	CmpOp op= sys.ctrs[ctr].op;
 
@@ -110,17 +124,17 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box, int ctr, corner_poi
 	int cont=0;
 	if(ctr==goal_ctr) op = LEQ;
 	if(op==EQ) {
-		cont+=X_Linearization(box, ctr, cpoint, LEQ, G, id_point, nb_nonlinear_vars, mysolver);
-		cont+=X_Linearization(box, ctr, cpoint, GEQ, G, id_point, nb_nonlinear_vars, mysolver);
+		cont+=X_Linearization(box, ctr, cpoint, LEQ, G, id_point, nb_nonlinear_vars, rows);
+		cont+=X_Linearization(box, ctr, cpoint, GEQ, G, id_point, nb_nonlinear_vars, rows);
 	} else
-		cont+=X_Linearization(box, ctr, cpoint, op,  G, id_point, nb_nonlinear_vars, mysolver);
+		cont+=X_Linearization(box, ctr, cpoint, op,  G, id_point, nb_nonlinear_vars, rows);
 
 	return cont;
 }
 
 int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 		int ctr, corner_point cpoint, CmpOp op, 
-		IntervalVector& G2, int id_point, int& nb_nonlinear_vars, LinearSolver *mysolver) {
+		IntervalVector& G2, int id_point, int& nb_nonlinear_vars, LinearRows& rows) {
 
 	IntervalVector G = G2;
 	int n = sys.nb_var;
@@ -144,17 +158,20 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 	IntervalVector savebox(box);
 	Interval ev(0.0);
 	Interval tot_ev(0.0);
+	const Function& f = sys.ctrs[ctr].f;
+	// the coefficients of the row (only the variables used by the constraint)
 	Vector row1(n);
+	std::vector<int> col(n);
+	int nnz = 0;
 
 
-	for (int j=0; j< n; j++) {
+	for (int k=0; k< f.nb_used_vars; k++) {
 
-	  if (sys.ctrs[ctr].f.used(j)) {
-		  if (lmode == HANSEN && !linear[ctr][j])
-			  // get the partial derivative of ctr w.r.t. var n°j
-	    	  G[j]=df[ctr*n+j].eval(box);
-	  }
-	  else continue;
+	  int j = f.used_var[k];
+
+	  if (lmode == HANSEN && !linear[ctr][j])
+		  // get the partial derivative of ctr w.r.t. var n°j
+		  G[j]=df[ctr*n+j].eval(box);
 
 	  if (G[j].diam() > max_diam_deriv) {
 	    box = savebox; // [gch] where box has been modified?  at the end of the loop (for Hansen computation) [bne]
@@ -316,7 +333,8 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 	  box[j]=inf_x? savebox[j].lb():savebox[j].ub();
 	  Interval a = ((inf_x && (op == LEQ || op== LT)) ||
 			(!inf_x && (op == GEQ || op== GT)))	? G[j].lb() : G[j].ub();
-	  row1[j] =  a.mid();
+	  row1[nnz] =  a.mid();
+	  col[nnz++] = j;
 	  ev -= a*box[j];
 
 	}
@@ -330,8 +348,8 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 
 	if(id_point==0) nb_nonlinear_vars=nonlinear_var;
 
-	for(int j=0;j<n;j++)
-		tot_ev+=row1[j]*savebox[j]; //natural evaluation of the left side of the linear constraint
+	for(int k=0;k<nnz;k++)
+		tot_ev+=row1[k]*savebox[col[k]]; //natural evaluation of the left side of the linear constraint
 
 
 
@@ -341,14 +359,14 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 		if(tot_ev.lb()>(-ev).ub())
 			throw EmptyBoxException();  // the constraint is not satisfied
 		if((-ev).ub()<tot_ev.ub()) {    // otherwise the constraint is satisfied for any point in the box
-			mysolver->addConstraint( row1, LEQ, (-ev).ub());
+			rows.add(nnz, &col[0], &row1[0], LEQ, (-ev).ub());
 			added=true;
 		}
 	} else {
 		if(tot_ev.ub()<(-ev).lb())
 			throw EmptyBoxException();
 		if ((-ev).lb()>tot_ev.lb()) {
-			mysolver->addConstraint( row1, GEQ, (-ev).lb() );
+			rows.add(nnz, &col[0], &row1[0], GEQ, (-ev).lb() );
 			added=true;
 		}
 	}
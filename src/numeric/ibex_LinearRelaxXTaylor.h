@@ -76,6 +76,11 @@ public:
 	 */
 	int linearization( IntervalVector & box, LinearSolver *mysolver);
 
+	/**
+	 * \brief Linearization of the constraint n°ctr (rows not added to the LP).
+	 */
+	int linearization_ctr( IntervalVector & box, LinearSolver *mysolver, int ctr, LinearRows& rows);
+
 
 private:
 	/**
@@ -109,15 +114,15 @@ private:
 	void init_linear_coeffs();
 
 	/**
-	 * \brief Tries to add a linearization in the model mysoplex.
+	 * \brief Tries to add a linearization in rows (added to the LP by #linearization).
 	 *
 	 * \return 0 only when the linearization is not performed
 	 */
 	int X_Linearization(IntervalVector & box, int ctr, corner_point cpoint,  IntervalVector &G,
-			int id_point, int& non_linear_vars, LinearSolver *mysolver);
+			int id_point, int& non_linear_vars, LinearRows& rows);
 
 	int X_Linearization(IntervalVector& box, int ctr, corner_point cpoint, CmpOp op,
-			IntervalVector &G, int id_point, int& non_linear_vars, LinearSolver *mysolver);
+			IntervalVector &G, int id_point, int& non_linear_vars, LinearRows& rows);
 
 	/**
 	 * \brief Symbolic jacobian
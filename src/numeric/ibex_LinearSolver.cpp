@@ -171,6 +171,14 @@ double LinearSolver::getEpsilon() const {
 	return epsilon;
 }
 
+int LinearSolver::getNbIter() const {
+	return mysoplex->iterations();
+}
+
+bool LinearSolver::isWarmStart() const {
+	return false;
+}
+
 LinearSolver::Status LinearSolver::getCoefConstraint(Matrix &A) {
 	LinearSolver::Status res= FAIL;
 	try {
@@ -459,6 +467,62 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraint(int nnz, const int* col, const double* val, CmpOp sign, double rhs) {
+	LinearSolver::Status res= FAIL;
+	try {
+		soplex::DSVector row1(nnz);
+		for (int k=0; k<nnz; k++) {
+			row1.add(col[k], val[k]);
+		}
+
+		if (sign==LEQ || sign==LT) {
+			mysoplex->addRow(soplex::LPRow(-soplex::infinity, row1, rhs));
+			nb_rows++;
+			res=  OK;
+		}
+		else if (sign==GEQ || sign==GT) {
+			mysoplex->addRow(soplex::LPRow(rhs, row1, soplex::infinity));
+			nb_rows++;
+			res = OK;
+		}
+		else
+			res = FAIL;
+
+	}
+	catch(soplex::SPxException& ) {
+		res = FAIL;
+	}
+
+	return res;
+}
+
+LinearSolver::Status LinearSolver::addConstraints(const LinearRows& rows) {
+	LinearSolver::Status res= FAIL;
+	try {
+		soplex::LPRowSet set(rows.size(), rows.col.size());
+		for (int i=0; i<rows.size(); i++) {
+			soplex::DSVector row1(rows.row_start[i+1]-rows.row_start[i]);
+			for (int k=rows.row_start[i]; k<rows.row_start[i+1]; k++) {
+				row1.add(rows.col[k], rows.val[k]);
+			}
+			if (rows.sign[i]==LEQ || rows.sign[i]==LT)
+				set.add(soplex::LPRow(-soplex::infinity, row1, rows.rhs[i]));
+			else if (rows.sign[i]==GEQ || rows.sign[i]==GT)
+				set.add(soplex::LPRow(rows.rhs[i], row1, soplex::infinity));
+			else
+				return FAIL;
+		}
+		mysoplex->addRows(set);
+		nb_rows+=rows.size();
+		res = OK;
+	}
+	catch(soplex::SPxException& ) {
+		res = FAIL;
+	}
+
+	return res;
+}
+
 
 
 
@@ -757,6 +821,14 @@ double LinearSolver::getEpsilon() const {
 	return epsilon;
 }
 
+int LinearSolver::getNbIter() const {
+	return CPXgetitcnt(envcplex, lpcplex);
+}
+
+bool LinearSolver::isWarmStart() const {
+	return false;
+}
+
 LinearSolver::Status LinearSolver::getCoefConstraint(Matrix &A) {
 	LinearSolver::Status res = FAIL;
 	try {
@@ -1138,6 +1210,59 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraint(int nnz, const int* col, const double* val, CmpOp sign, double rhs) {
+	LinearRows rows;
+	rows.add(nnz,col,val,sign,rhs);
+	return addConstraints(rows);
+}
+
+LinearSolver::Status LinearSolver::addConstraints(const LinearRows& rows) {
+	LinearSolver::Status res = FAIL;
+	int nb=rows.size();
+	if (nb==0) return OK;
+	int nnz=rows.col.size();
+	try {
+		// all the rows are stored as "less or equal" constraints
+		double * pt_rhs= new double[nb];
+		char * cc = new char[nb];
+		int * matbeg = new int[nb];
+		int * matind = new int[nnz>0? nnz : 1];
+		double * matval = new double[nnz>0? nnz : 1];
+		bool ok=true;
+		for (int i=0; i<nb && ok; i++) {
+			double s;
+			if (rows.sign[i] == LEQ || rows.sign[i] == LT) s=1;
+			else if (rows.sign[i] == GEQ || rows.sign[i] == GT) s=-1;
+			else { ok=false; break; }
+			cc[i]='L';
+			pt_rhs[i]=s*rows.rhs[i];
+			matbeg[i]=rows.row_start[i];
+			for (int k=rows.row_start[i]; k<rows.row_start[i+1]; k++) {
+				matind[k]=rows.col[k];
+				matval[k]=s*rows.val[k];
+			}
+		}
+
+		if (ok) {
+			int status = CPXaddrows(envcplex, lpcplex, 0, nb, nnz, pt_rhs, cc, matbeg,
+					matind, matval, NULL, NULL);
+			if (status==0) {
+				nb_rows+=nb;
+				res = OK;
+			}
+		}
+
+		delete[] pt_rhs;
+		delete[] cc;
+		delete[] matbeg;
+		delete[] matind;
+		delete[] matval;
+	} catch (Exception&) {
+		res = FAIL;
+	}
+	return res;
+}
+
 #endif  // END DEF with CPLEX
 
 
@@ -1289,6 +1414,14 @@ double LinearSolver::getEpsilon() const {
 	return epsilon;
 }
 
+int LinearSolver::getNbIter() const {
+	return myclp->numberIterations();
+}
+
+bool LinearSolver::isWarmStart() const {
+	return false;
+}
+
 LinearSolver::Status LinearSolver::getCoefConstraint(Matrix &A) {
 	LinearSolver::Status res= FAIL;
 	try {
@@ -1604,6 +1737,68 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraint(int nnz, const int* col, const double* val, CmpOp sign, double rhs) {
+	LinearSolver::Status res= FAIL;
+	try {
+		if (sign==LEQ || sign==LT) {
+			myclp->addRow(nnz,col,val,NEG_INFINITY,rhs);
+			nb_rows++;
+			res=  OK;
+		}
+		else if (sign==GEQ || sign==GT) {
+			myclp->addRow(nnz,col,val,rhs,POS_INFINITY);
+			nb_rows++;
+			res = OK;
+		}
+		else
+			res = FAIL;
+
+	}
+	catch(Exception& ) {
+		res = FAIL;
+	}
+
+	return res;
+}
+
+LinearSolver::Status LinearSolver::addConstraints(const LinearRows& rows) {
+	LinearSolver::Status res= FAIL;
+	int nb=rows.size();
+	if (nb==0) return OK;
+	int nnz=rows.col.size();
+	double * lower = new double[nb];
+	double * upper = new double[nb];
+	CoinBigIndex * starts = new CoinBigIndex[nb+1];
+	bool ok=true;
+	for (int i=0; i<nb; i++) {
+		if (rows.sign[i]==LEQ || rows.sign[i]==LT) {
+			lower[i]=NEG_INFINITY; upper[i]=rows.rhs[i];
+		}
+		else if (rows.sign[i]==GEQ || rows.sign[i]==GT) {
+			lower[i]=rows.rhs[i]; upper[i]=POS_INFINITY;
+		}
+		else ok=false;
+		starts[i]=rows.row_start[i];
+	}
+	starts[nb]=nnz;
+
+	try {
+		if (ok) {
+			myclp->addRows(nb, lower, upper, starts, nnz>0? &rows.col[0] : NULL, nnz>0? &rows.val[0] : NULL);
+			nb_rows+=nb;
+			res = OK;
+		}
+	}
+	catch(Exception& ) {
+		res = FAIL;
+	}
+
+	delete[] lower;
+	delete[] upper;
+	delete[] starts;
+	return res;
+}
+
 
 
 
@@ -1743,6 +1938,14 @@ double LinearSolver::getEpsilon() const {
 	return epsilon;
 }
 
+int LinearSolver::getNbIter() const {
+	return mycplex->getNiterations();
+}
+
+bool LinearSolver::isWarmStart() const {
+	return false;
+}
+
 LinearSolver::Status LinearSolver::getCoefConstraint(Matrix &A) {
 	LinearSolver::Status res = FAIL;
 	try {
@@ -2112,10 +2315,343 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraint(int nnz, const int* col, const double* val, CmpOp sign, double rhs) {
+	// the rows are stored as dense columns in this modelization
+	Vector row(nb_vars,0.0);
+	for (int k=0; k<nnz; k++) row[col[k]]=val[k];
+	return addConstraint(row, sign, rhs);
+}
+
+LinearSolver::Status LinearSolver::addConstraints(const LinearRows& rows) {
+	for (int i=0; i<rows.size(); i++) {
+		int k=rows.row_start[i];
+		int nnz=rows.row_start[i+1]-k;
+		if (addConstraint(nnz, nnz>0? &rows.col[k] : NULL, nnz>0? &rows.val[k] : NULL, rows.sign[i], rows.rhs[i])!=OK)
+			return FAIL;
+	}
+	return OK;
+}
+
 #endif  // END DEF with ILOCPLEX
 
 
 
+#ifdef _IBEX_WITH_NATIVE_LP_
+
+LinearSolver::LinearSolver(int nb_vars1, int nb_ctr, int max_iter, int max_time_out, double eps) :
+			nb_ctrs(nb_ctr), nb_vars(nb_vars1), nb_rows(0), obj_value(0.0), epsilon(eps),
+			primal_solution(new double[nb_vars1]), dual_solution(NULL),
+			status_prim(0), status_dual(0),
+			mysimplex(new DualSimplex(nb_vars1)), _max_iter(max_iter), _max_time_out(max_time_out),
+			infeasible_dir(NULL) {
+
+	// the constraints of the bounds of the variables are the
+	// bounds of the variables of the simplex (initially infinite)
+	nb_rows = nb_vars;
+}
+
+LinearSolver::~LinearSolver() {
+	delete [] primal_solution;
+	if (dual_solution!=NULL) delete [] dual_solution;
+	if (infeasible_dir!=NULL) delete [] infeasible_dir;
+	delete mysimplex;
+}
+
+LinearSolver::Status_Sol LinearSolver::solve() {
+
+	LinearSolver::Status_Sol res= UNKNOWN;
+
+	status_prim = 0;
+	status_dual = 0;
+	if (infeasible_dir!=NULL) delete [] infeasible_dir;
+	infeasible_dir=NULL;
+
+	DualSimplex::Status stat = mysimplex->solve(_max_iter, _max_time_out, epsilon);
+
+	switch (stat) {
+	case DualSimplex::OPTIMAL: {
+		obj_value = mysimplex->obj_value();
+
+		// the primal solution : used by choose_next_variable
+		for (int i=0; i< nb_vars ; i++) {
+			primal_solution[i]=mysimplex->primal(i);
+		}
+		status_prim = 1;
+
+		// the dual solution ; used by Neumaier Shcherbina test
+		if (dual_solution != NULL) delete [] dual_solution;
+		dual_solution = new double[nb_rows];
+		for (int i=0; i<nb_rows; i++) {
+			double dual= i<nb_vars ? mysimplex->var_dual(i) : mysimplex->row_dual(i-nb_vars);
+			double lhs = i<nb_vars ? mysimplex->var_lb(i)   : mysimplex->row_lb(i-nb_vars);
+			double rhs = i<nb_vars ? mysimplex->var_ub(i)   : mysimplex->row_ub(i-nb_vars);
+			if 	( ((rhs >=  default_max_bound) && (dual<=0)) ||
+				  ((lhs <= -default_max_bound) && (dual>=0))   ) {
+				dual_solution[i]=0;
+			}
+			else {
+				dual_solution[i]=dual;
+			}
+		}
+		status_dual = 1;
+		res = OPTIMAL;
+		break;
+	}
+	case DualSimplex::INFEASIBLE:
+		// the certificate is only checked with floating-point arithmetic
+		infeasible_dir = new double[nb_rows];
+		for (int i=0; i<nb_rows; i++) {
+			infeasible_dir[i]= i<nb_vars ? mysimplex->var_farkas(i) : mysimplex->row_farkas(i-nb_vars);
+		}
+		res = INFEASIBLE_NOTPROVED;
+		break;
+	case DualSimplex::MAX_ITER:
+		res = MAX_ITER;
+		break;
+	case DualSimplex::TIME_OUT:
+		res = TIME_OUT;
+		break;
+	default:
+		res = UNKNOWN;
+	}
+
+	return res;
+}
+
+LinearSolver::Status LinearSolver::writeFile(const char* name) {
+	// CPLEX LP format
+	FILE* fd=fopen(name, "w");
+	if (fd==NULL) return FAIL;
+
+	fprintf(fd, mysimplex->minimize()? "Minimize\n obj:" : "Maximize\n obj:");
+	for (int j=0; j<nb_vars; j++) {
+		if (mysimplex->obj(j)!=0) fprintf(fd, " %+.17g x%d", mysimplex->obj(j), j);
+	}
+	fprintf(fd, "\nSubject To\n");
+	for (int i=0; i<nb_rows-nb_vars; i++) {
+		double lhs=mysimplex->row_lb(i);
+		double rhs=mysimplex->row_ub(i);
+		fprintf(fd, " c%d:", i);
+		for (int j=0; j<nb_vars; j++) {
+			if (mysimplex->coef(i,j)!=0) fprintf(fd, " %+.17g x%d", mysimplex->coef(i,j), j);
+		}
+		// the rows are one-sided (see addConstraint)
+		if (rhs<default_max_bound)
+			fprintf(fd, " <= %.17g\n", rhs);
+		else
+			fprintf(fd, " >= %.17g\n", lhs);
+	}
+	fprintf(fd, "Bounds\n");
+	for (int j=0; j<nb_vars; j++) {
+		double lb=mysimplex->var_lb(j);
+		double ub=mysimplex->var_ub(j);
+		if (lb<=-default_max_bound && ub>=default_max_bound)
+			fprintf(fd, " x%d free\n", j);
+		else if (lb<=-default_max_bound)
+			fprintf(fd, " -inf <= x%d <= %.17g\n", j, ub);
+		else if (ub>=default_max_bound)
+			fprintf(fd, " %.17g <= x%d <= +inf\n", lb, j);
+		else
+			fprintf(fd, " %.17g <= x%d <= %.17g\n", lb, j, ub);
+	}
+	fprintf(fd, "End\n");
+	fclose(fd);
+	return OK;
+}
+
+int LinearSolver::getNbRows() const {
+	return nb_rows;
+}
+
+double LinearSolver::getObjValue() const {
+	return obj_value;
+}
+
+double LinearSolver::getEpsilon() const {
+	return epsilon;
+}
+
+int LinearSolver::getNbIter() const {
+	return mysimplex->nb_iter;
+}
+
+bool LinearSolver::isWarmStart() const {
+	return mysimplex->warm_start;
+}
+
+LinearSolver::Status LinearSolver::getCoefConstraint(Matrix &A) {
+	A = Matrix::zeros(nb_rows,nb_vars);
+	for (int j=0; j<nb_vars; j++) {
+		A[j][j] = 1.0;
+	}
+	for (int i=nb_vars; i<nb_rows; i++) {
+		for (int j=0; j<nb_vars; j++) {
+			A[i][j] = mysimplex->coef(i-nb_vars,j);
+		}
+	}
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::getCoefConstraint_trans(Matrix &A_trans) {
+	A_trans = Matrix::zeros(nb_vars,nb_rows);
+	for (int j=0; j<nb_vars; j++) {
+		A_trans[j][j] = 1.0;
+	}
+	for (int i=nb_vars; i<nb_rows; i++) {
+		for (int j=0; j<nb_vars; j++) {
+			A_trans[j][i] = mysimplex->coef(i-nb_vars,j);
+		}
+	}
+	return OK;
+}
+
+LinearSolver::Status  LinearSolver::getB(IntervalVector& B) {
+	// Get the bounds of the variables
+	for (int i=0;i<nb_vars; i++){
+		B[i]=Interval( mysimplex->var_lb(i), mysimplex->var_ub(i) );
+	}
+
+	// Get the bounds of the constraints
+	for (int i=nb_vars;i<nb_rows; i++){
+		double lhs=mysimplex->row_lb(i-nb_vars);
+		double rhs=mysimplex->row_ub(i-nb_vars);
+		B[i]=Interval( 	(lhs>-default_max_bound)? lhs:-default_max_bound,
+				        (rhs< default_max_bound)? rhs: default_max_bound   );
+	}
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::getPrimalSol(Vector & solution_primal) {
+	if (status_prim != 1) return FAIL;
+	for (int i=0; i< nb_vars ; i++) {
+		solution_primal[i] = primal_solution[i];
+	}
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::getDualSol(Vector & solution_dual) {
+	if (status_dual != 1) return FAIL;
+	for (int i=0; i<nb_rows; i++) {
+		solution_dual[i] = dual_solution[i];
+	}
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::getInfeasibleDir(Vector & sol) {
+	if (infeasible_dir==NULL) return FAIL;
+	for (int i=0; i<nb_rows; i++) {
+		sol[i] = infeasible_dir[i];
+	}
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::cleanConst() {
+	if (dual_solution!=NULL) delete[] dual_solution;
+	dual_solution=NULL;
+	if (infeasible_dir!=NULL) delete[] infeasible_dir;
+	infeasible_dir=NULL;
+	status_prim = 0;
+	status_dual = 0;
+	mysimplex->clear_rows();
+	nb_rows = nb_vars;
+	obj_value = POS_INFINITY;
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::cleanAll() {
+	// note: the constraints on the bounds of the variables are
+	// not removed but reset to (-oo,+oo)
+	cleanConst();
+	for (int j=0; j<nb_vars; j++) {
+		mysimplex->set_var_bounds(j, NEG_INFINITY, POS_INFINITY);
+		mysimplex->set_obj(j, 0.0);
+	}
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::setMaxIter(int max) {
+	_max_iter = max;
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::setMaxTimeOut(int time) {
+	_max_time_out = time;
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::setSense(Sense s) {
+	if (s==LinearSolver::MINIMIZE) {
+		mysimplex->set_sense(true);
+		return OK;
+	}
+	else if (s==LinearSolver::MAXIMIZE) {
+		mysimplex->set_sense(false);
+		return OK;
+	}
+	else
+		return FAIL;
+}
+
+LinearSolver::Status LinearSolver::setVarObj(int var, double coef) {
+	if (var<0 || var>=nb_vars) return FAIL;
+	mysimplex->set_obj(var, coef);
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::initBoundVar(IntervalVector bounds) {
+	for (int j=0; j<nb_vars; j++){
+		mysimplex->set_var_bounds(j, bounds[j].lb(), bounds[j].ub());
+	}
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::setBoundVar(int var, Interval bound) {
+	if (var<0 || var>=nb_vars) return FAIL;
+	mysimplex->set_var_bounds(var, bound.lb(), bound.ub());
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::setEpsilon(double eps) {
+	epsilon = eps;
+	return OK;
+}
+
+LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign, double rhs) {
+	if (sign==LEQ || sign==LT) {
+		mysimplex->add_row(&row[0], NEG_INFINITY, rhs);
+		nb_rows++;
+		return OK;
+	}
+	else if (sign==GEQ || sign==GT) {
+		mysimplex->add_row(&row[0], rhs, POS_INFINITY);
+		nb_rows++;
+		return OK;
+	}
+	else
+		return FAIL;
+}
+
+LinearSolver::Status LinearSolver::addConstraint(int nnz, const int* col, const double* val, CmpOp sign, double rhs) {
+	// the built-in simplex stores dense rows
+	Vector row(nb_vars,0.0);
+	for (int k=0; k<nnz; k++) row[col[k]]=val[k];
+	return addConstraint(row, sign, rhs);
+}
+
+LinearSolver::Status LinearSolver::addConstraints(const LinearRows& rows) {
+	for (int i=0; i<rows.size(); i++) {
+		int k=rows.row_start[i];
+		int nnz=rows.row_start[i+1]-k;
+		if (addConstraint(nnz, nnz>0? &rows.col[k] : NULL, nnz>0? &rows.val[k] : NULL, rows.sign[i], rows.rhs[i])!=OK)
+			return FAIL;
+	}
+	return OK;
+}
+
+#endif  // END DEF with NATIVE_LP
+
+
+
 
 
 
@@ -16,6 +16,7 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <vector>
 #include "ibex_Vector.h"
 #include "ibex_Matrix.h"
 #include "ibex_IntervalVector.h"
@@ -37,6 +38,10 @@
 #ifdef _IBEX_WITH_ILOCPLEX_
 #include <ilcplex/ilocplex.h>
 // TODO not finish yet
+#else
+#ifdef _IBEX_WITH_NATIVE_LP_
+#include "ibex_DualSimplex.h"
+#endif
 #endif
 #endif
 #endif
@@ -44,6 +49,48 @@
 
 namespace ibex {
 
+/**
+ * \brief Linear constraints in sparse form.
+ *
+ * The ith constraint is  sum_k val[k]*x_{col[k]} (sign[i]) rhs[i],
+ * for k in row_start[i]..row_start[i+1]-1.
+ * Rows are collected by a linear relaxation and then added to a
+ * #LinearSolver in one call (see #LinearSolver::addConstraints).
+ */
+class LinearRows {
+public:
+	/**
+	 * \brief Create an empty set of rows.
+	 */
+	LinearRows();
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Add the row sum_k val[k]*x_{col[k]} (sign) rhs, k=0..nnz-1.
+	 */
+	void add(int nnz, const int* col, const double* val, CmpOp sign, double rhs);
+
+	/**
+	 * \brief Add all the rows of \a r.
+	 */
+	void append(const LinearRows& r);
+
+	/**
+	 * \brief Remove all the rows.
+	 */
+	void clear();
+
+	std::vector<int> row_start;
+	std::vector<int> col;
+	std::vector<double> val;
+	std::vector<CmpOp> sign;
+	std::vector<double> rhs;
+};
+
 class LinearSolver {
 
 
@@ -90,6 +137,13 @@ private:
 	int * _col1Index;
 #endif
 
+#ifdef _IBEX_WITH_NATIVE_LP_
+	DualSimplex *mysimplex;
+	int _max_iter;
+	int _max_time_out;
+	double * infeasible_dir; // Farkas certificate (NULL if the last LP is not infeasible)
+#endif
+
 
 public:
 
@@ -144,6 +198,17 @@ public:
 
 	double getEpsilon() const;
 
+	/** Number of simplex iterations of the last call to solve() */
+	int getNbIter() const;
+
+	/**
+	 * True if the last call to solve() has started from the basis of a previous
+	 * resolution (after a change of the objective or the bounds, or after cleanConst()
+	 * if the new constraints have the same structure). Only reported by the built-in
+	 * solver (always false with the external solvers).
+	 */
+	bool isWarmStart() const;
+
 
 // SET
 
@@ -167,6 +232,18 @@ public:
 
 	Status addConstraint(Vector & row, CmpOp sign, double rhs );
 
+	/**
+	 * \brief Add the constraint sum_k val[k]*x_{col[k]} (sign) rhs, k=0..nnz-1.
+	 *
+	 * Only the nonzero coefficients are given.
+	 */
+	Status addConstraint(int nnz, const int* col, const double* val, CmpOp sign, double rhs);
+
+	/**
+	 * \brief Add all the rows at once.
+	 */
+	Status addConstraints(const LinearRows& rows);
+
 
 
 };
@@ -174,6 +251,44 @@ public:
 /** \brief Stream out \a x. */
 std::ostream& operator<<(std::ostream& os, const LinearSolver::Status_Sol x);
 
+/*================================== inline implementations ========================================*/
+
+inline LinearRows::LinearRows() : row_start(1,0) {
+
+}
+
+inline int LinearRows::size() const {
+	return row_start.size()-1;
+}
+
+inline void LinearRows::add(int nnz, const int* c, const double* v, CmpOp s, double r) {
+	for (int k=0; k<nnz; k++) {
+		col.push_back(c[k]);
+		val.push_back(v[k]);
+	}
+	row_start.push_back(col.size());
+	sign.push_back(s);
+	rhs.push_back(r);
+}
+
+inline void LinearRows::append(const LinearRows& r) {
+	int offset=col.size();
+	col.insert(col.end(), r.col.begin(), r.col.end());
+	val.insert(val.end(), r.val.begin(), r.val.end());
+	for (int i=1; i<(int) r.row_start.size(); i++)
+		row_start.push_back(offset+r.row_start[i]);
+	sign.insert(sign.end(), r.sign.begin(), r.sign.end());
+	rhs.insert(rhs.end(), r.rhs.begin(), r.rhs.end());
+}
+
+inline void LinearRows::clear() {
+	row_start.resize(1);
+	col.clear();
+	val.clear();
+	sign.clear();
+	rhs.clear();
+}
+
 
 } // end namespace ibex
 
@@ -35,9 +35,43 @@ namespace {
 }
 
 bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_seidel) {
+	Preconditioner cache(f.image_dim(),0); // no reuse
+	return newton(f,box,cache,prec,ratio_gauss_seidel);
+}
+
+namespace {
+
+/* Maximal number of iterations once the box is certified (the
+ * iteration then goes on as long as the box is contracted). */
+const int MAX_ITER_CERTIFIED=50;
+
+/*
+ * Hansen-Sengupta iteration (Gauss-Seidel on the preconditioned system).
+ *
+ * If hansen==true, the Hansen matrix is used (no certificate). Otherwise,
+ * the Jacobian matrix is used and, if unique!=NULL, the existence and
+ * uniqueness of a solution is checked at each iteration.
+ */
+bool newton_iter(const Fnc& f, IntervalVector& box, Preconditioner& cache, double prec, double ratio_gauss_seidel, bool hansen, bool* unique);
+
+}
+
+bool newton(const Fnc& f, IntervalVector& box, Preconditioner& cache, double prec, double ratio_gauss_seidel) {
+	return newton_iter(f,box,cache,prec,ratio_gauss_seidel,true,NULL);
+}
+
+bool hansen_sengupta(const Fnc& f, IntervalVector& box, Preconditioner& cache, bool& unique, double prec, double ratio_gauss_seidel) {
+	unique=false;
+	return newton_iter(f,box,cache,prec,ratio_gauss_seidel,false,&unique);
+}
+
+namespace {
+
+bool newton_iter(const Fnc& f, IntervalVector& box, Preconditioner& cache, double prec, double ratio_gauss_seidel, bool hansen, bool* unique) {
 	int n=f.nb_var();
 	int m=f.image_dim();
 	assert(box.size()==n);
+	int k_certified=0;
 
 	IntervalMatrix J(m, n);
 	IntervalVector y(n);
@@ -51,8 +85,10 @@ bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_s
 	do {
 //		cout.precision(20);
 //		cout << box << endl << endl << endl;
-		f.hansen_matrix(box,J); //may throw EmptyBoxException?
-//		f.jacobian(box,J); //may throw EmptyBoxException
+		if (hansen)
+			f.hansen_matrix(box,J); //may throw EmptyBoxException?
+		else
+			f.jacobian(box,J); //may throw EmptyBoxException
 		if (J.is_empty()) { return false; }
 //		for (int i=0; i<m; i++)
 //			for (int j=0; j<n; j++)
@@ -74,7 +110,15 @@ bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_s
 		y1=y;
 
 		try {
-			precond(J, Fmid);
+			cache.apply(J, Fmid);
+
+			if (unique && !*unique && !box.is_unbounded()) {
+				IntervalVector y0(y);
+				// one sweep (the relative distance is always <=1)
+				gauss_seidel(J, Fmid, y, 2.0);
+				// the Hansen-Sengupta operator maps the box into its interior
+				if (!y.is_empty() && y.is_strict_subset(y0)) *unique=true;
+			}
 
 			gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
 
@@ -94,11 +138,76 @@ bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_s
 		box=box2;
 
 	}
-	while (gain >= prec);
+	while (gain >= prec || (unique && *unique && gain>0 && ++k_certified<MAX_ITER_CERTIFIED));
+	return reducted;
+}
+
+} // end anonymous namespace
+
+bool krawczyk(const Fnc& f, IntervalVector& box, Preconditioner& cache, bool& unique, double prec) {
+	int n=f.nb_var();
+	assert(f.image_dim()==n);
+	assert(box.size()==n);
+
+	IntervalMatrix J(n, n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(n);
+	IntervalVector K(n);
+	bool reducted=false;
+	int k_certified=0;
+	double gain;
+	unique=false;
+
+	do {
+		f.jacobian(box,J);
+		if (J.is_empty()) { return reducted; }
+
+		mid = box.mid();
+		Fmid=f.eval_vector(mid);
+
+		try {
+			cache.apply(J, Fmid);
+		} catch (LinearException& ) {
+			return reducted;
+		}
+
+		// J <- I-C*J
+		for (int i=0; i<n; i++) {
+			for (int j=0; j<n; j++) J[i][j]=-J[i][j];
+			J[i][i]+=1;
+		}
+
+		IntervalVector d=box-mid;
+
+		// K(box) = mid - C*f(mid) + (I-C*J)(box-mid)
+		// (the rows are independent)
+#pragma omp parallel for
+		for (int i=0; i<n; i++)
+			K[i]=mid[i]-Fmid[i]+J[i]*d;
+
+		if (!unique && !box.is_unbounded() && K.is_strict_subset(box)) unique=true;
+
+		IntervalVector box2=K & box;
+
+		if (box2.is_empty()) { box.set_empty(); throw EmptyBoxException(); }
+
+		gain = box.maxdelta(box2);
+
+		if (gain >= prec) reducted = true;
+
+		box=box2;
+
+	}
+	while (gain >= prec || (unique && gain>0 && ++k_certified<MAX_ITER_CERTIFIED));
 	return reducted;
 }
 
 bool inflating_newton(const Fnc& f, IntervalVector& box, int k_max, double mu_max, double delta, double chi) {
+	Preconditioner cache(f.image_dim(),0); // no reuse
+	return inflating_newton(f,box,cache,k_max,mu_max,delta,chi);
+}
+
+bool inflating_newton(const Fnc& f, IntervalVector& box, Preconditioner& cache, int k_max, double mu_max, double delta, double chi) {
 	int n=f.nb_var();
 	int m=f.image_dim();
 	assert(box.size()==n);
@@ -128,7 +237,7 @@ bool inflating_newton(const Fnc& f, IntervalVector& box, int k_max, double mu_ma
 		y1=y;
 
 		try {
-			precond(J, Fmid);
+			cache.apply(J, Fmid);
 		} catch(LinearException&) {
 			return success; // should be false
 		}
@@ -152,4 +261,98 @@ bool inflating_newton(const Fnc& f, IntervalVector& box, int k_max, double mu_ma
 	return success;
 }
 
+bool sparse_newton(const Function& f, IntervalVector& box, double prec, double ratio_gauss_seidel, int block_size) {
+	int n=f.nb_var();
+	int m=f.image_dim();
+	assert(box.size()==n);
+
+	IntervalSparseMatrix J;
+	IntervalVector y(n);
+	IntervalVector y1(n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(m);
+	bool reducted=false;
+	double gain;
+	y1= box.mid();
+
+	do {
+		f.hansen_matrix(box,J);
+		if (J.is_empty()) { return false; }
+
+		mid = box.mid();
+
+		Fmid=f.eval_vector(mid);
+
+		y = mid-box;
+		if (y==y1) break;
+		y1=y;
+
+		precond(J, Fmid, block_size);
+
+		gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+
+		if (y.is_empty()) { box.set_empty(); throw EmptyBoxException(); }
+
+		IntervalVector box2=mid-y;
+
+		if ((box2 &= box).is_empty()) { box.set_empty(); throw EmptyBoxException(); }
+
+		gain = box.maxdelta(box2);
+
+		if (gain >= prec) reducted = true;
+
+		box=box2;
+
+	}
+	while (gain >= prec);
+	return reducted;
+}
+
+bool sparse_inflating_newton(const Function& f, IntervalVector& box, int k_max, double mu_max, double delta, double chi, int block_size) {
+	int n=f.nb_var();
+	int m=f.image_dim();
+	assert(box.size()==n);
+
+	int k=0;
+	bool success=false;
+
+	IntervalSparseMatrix J;
+	IntervalVector y(n);
+	IntervalVector y1(n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(m);
+
+	y1= box.mid();
+
+	while (k<k_max) {
+
+		f.hansen_matrix(box,J);
+
+		if (J.is_empty()) { return false; }
+
+		mid = box.mid();
+		Fmid=f.eval_vector(mid);
+
+		y = mid-box;
+		if (y==y1) break;
+		y1=y;
+
+		precond(J, Fmid, block_size);
+
+		// see inflating_newton
+		if (!inflating_gauss_seidel(J, Fmid, y, 1e-12, mu_max))
+			return success;
+
+		IntervalVector box2=mid-y;
+
+		if (box2.is_subset(box)) {
+			success=true;
+		}
+
+		box=box2;
+		k++;
+	}
+	return success;
+}
+
 } // end namespace ibex
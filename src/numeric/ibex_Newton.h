@@ -12,6 +12,8 @@
 #define __IBEX_NEWTON_H__
 
 #include "ibex_Fnc.h"
+#include "ibex_Function.h"
+#include "ibex_Preconditioner.h"
 
 namespace ibex {
 
@@ -45,6 +47,51 @@ extern double default_gauss_seidel_ratio;
  */
 bool newton(const Fnc& f, IntervalVector& box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
 
+/** \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (contracting) with reuse of the preconditioning matrix.
+ *
+ * Same as #newton(const Fnc&, IntervalVector&, double, double) except that the
+ * preconditioning matrix is obtained from \a cache, i.e., it is reused (or updated)
+ * from one iteration to the other and from previous calls as long as the
+ * midpoint of the Hansen matrix does not move too much (see #ibex::Preconditioner).
+ */
+bool newton(const Fnc& f, IntervalVector& box, Preconditioner& cache, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
+/** \ingroup numeric
+ *
+ * \brief Hansen-Sengupta operator with existence and uniqueness certificate.
+ *
+ * Same as #newton(const Fnc&, IntervalVector&, Preconditioner&, double, double) except that
+ * the Jacobian matrix is used instead of the Hansen matrix. If, at some iteration, the image of the
+ * (bounded) box by the operator is included in its interior, the box contains a unique solution and
+ * \a unique is set to true. The iteration then goes on as long as the box is contracted (so that
+ * the box is typically reduced to the precision of floating-point numbers).
+ *
+ * \param unique (output) - true if the box is proven to contain a unique solution.
+ */
+bool hansen_sengupta(const Fnc& f, IntervalVector& box, Preconditioner& cache, bool& unique,
+		double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
+/** \ingroup numeric
+ *
+ * \brief Krawczyk operator with existence and uniqueness certificate.
+ *
+ * The box [x] is contracted with
+ *    K([x]) = m - C*f(m) + (I - C*J([x]))([x]-m)
+ * where m is the midpoint of [x], J the Jacobian matrix and C the (approximate) inverse
+ * of mid(J([x])), given by \a cache. The rows of K are calculated independently
+ * (in parallel if the library is compiled with OpenMP).
+ *
+ * If K([x]) is included in the interior of [x] (bounded), [x] contains a unique solution
+ * and \a unique is set to true. The iteration then goes on as long as the box is contracted.
+ *
+ * \param prec (optional) - the iteration stops when the box is not reduced by more than \a prec.
+ * \param unique (output) - true if the box is proven to contain a unique solution.
+ * \return True if one variable has been reduced by more than \a prec.
+ */
+bool krawczyk(const Fnc& f, IntervalVector& box, Preconditioner& cache, bool& unique, double prec=default_newton_prec);
+
 /** \ingroup numeric
  *
  * \brief Multivariate Newton operator (inflating).
@@ -79,5 +126,41 @@ bool inflating_newton(const Fnc& f, IntervalVector& box,
 		int k_max_iteration=15, double mu_max_divergence=1.0,
 		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12);
 
+/** \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (inflating) with reuse of the preconditioning matrix.
+ *
+ * See #newton(const Fnc&, IntervalVector&, Preconditioner&, double, double).
+ */
+bool inflating_newton(const Fnc& f, IntervalVector& box, Preconditioner& cache,
+		int k_max_iteration=15, double mu_max_divergence=1.0,
+		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12);
+
+/** \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (contracting) for large sparse systems.
+ *
+ * Same as #newton(const Fnc&, IntervalVector&, double, double) but the Hansen matrix
+ * is stored in sparse form (only the entries (i,j) such that f_i depends on x_j),
+ * the system is preconditioned by blocks (see #precond(IntervalSparseMatrix&, IntervalVector&, int))
+ * and the linear routine is the sparse Gauss-Seidel algorithm. Memory and time are then
+ * proportional to the number of non-zero entries (times the block size).
+ *
+ * \param block_size (optional) - size of the diagonal blocks of the preconditioning matrix.
+ */
+bool sparse_newton(const Function& f, IntervalVector& box, double prec=default_newton_prec,
+		double gauss_seidel_ratio=default_gauss_seidel_ratio, int block_size=8);
+
+/** \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (inflating) for large sparse systems.
+ *
+ * Same as #inflating_newton(const Fnc&, IntervalVector&, int, double, double, double)
+ * with sparse linear algebra (see #sparse_newton(const Function&, IntervalVector&, double, double, int)).
+ */
+bool sparse_inflating_newton(const Function& f, IntervalVector& box,
+		int k_max_iteration=15, double mu_max_divergence=1.0,
+		double delta_relative_inflat=1.1, double chi_absolute_inflat=1e-12, int block_size=8);
+
 } // end namespace ibex
 #endif // __IBEX_NEWTON_H__
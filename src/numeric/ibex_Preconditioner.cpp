@@ -0,0 +1,162 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Preconditioner.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Preconditioner.h"
+#include "ibex_Linear.h"
+
+#include <math.h>
+
+namespace ibex {
+
+const double Preconditioner::default_tol = 0.1;
+
+namespace {
+
+// maximal number of consecutive rank-one updates (rounding errors accumulate)
+const int MAX_UPDATES = 10;
+
+// threshold for the denominator of the Sherman-Morrison formula
+const double TOO_SMALL = 1e-10;
+
+}
+
+Preconditioner::Preconditioner(int n, double tol) : n(n), tol(tol),
+		nb_inversions(0), nb_updates(0), nb_reuses(0),
+		C(n,n), M0(n,n), normC(0), kind(-1), nb_updates_since_inversion(0) {
+
+}
+
+void Preconditioner::apply(IntervalMatrix& A, IntervalVector& b) {
+	assert(A.nb_rows()==n && A.nb_cols()==n && b.size()==n);
+	precondition(A);
+	A = C*A;
+	b = C*b;
+}
+
+void Preconditioner::apply(IntervalMatrix& A) {
+	assert(A.nb_rows()==n && A.nb_cols()==n);
+	precondition(A);
+	A = C*A;
+}
+
+void Preconditioner::precondition(IntervalMatrix& A) {
+	if (kind==-1 || tol==0) {
+		invert(A);
+		return;
+	}
+
+	Matrix M=extract(A);
+
+	if (update(M)) {
+		nb_updates++;
+		return;
+	}
+
+	if (kind!=-1 && normC*infinite_norm(M-M0)<=tol) {
+		nb_reuses++;
+		return;
+	}
+
+	invert(A);
+}
+
+void Preconditioner::invert(const IntervalMatrix& A) {
+	kind=-1; // in case of exception
+
+	try {
+		M0=A.mid();
+		real_inverse(M0, C);
+		kind=0;
+	}
+	catch (SingularMatrixException&) {
+		try {
+			M0=A.lb();
+			real_inverse(M0, C);
+			kind=1;
+		}
+		catch (SingularMatrixException&) {
+			M0=A.ub();
+			real_inverse(M0, C);
+			kind=2;
+		}
+	}
+
+	normC=infinite_norm(C);
+	nb_inversions++;
+	nb_updates_since_inversion=0;
+}
+
+Matrix Preconditioner::extract(const IntervalMatrix& A) const {
+	switch (kind) {
+	case 0:  return A.mid();
+	case 1:  return A.lb();
+	default: return A.ub();
+	}
+}
+
+bool Preconditioner::update(const Matrix& M) {
+	if (nb_updates_since_inversion>=MAX_UPDATES) return false;
+
+	// look for the row or the column where M and M0 differ
+	int i0=-1, j0=-1;
+	bool same_row=true, same_col=true;
+
+	for (int i=0; i<n && (same_row || same_col); i++)
+		for (int j=0; j<n; j++) {
+			if (M[i][j]==M0[i][j]) continue;
+			if (i0==-1) { i0=i; j0=j; }
+			else {
+				if (i!=i0) same_row=false;
+				if (j!=j0) same_col=false;
+			}
+		}
+
+	if (i0==-1 || (!same_row && !same_col)) return false;
+
+	if (same_col) {
+		// M = M0 + u*e_j^T  =>  M^{-1} = C - (C*u)*(e_j^T*C) / (1+(C*u)_j)
+		Vector u(n);
+		for (int i=0; i<n; i++) u[i]=M[i][j0]-M0[i][j0];
+		Vector Cu=C*u;
+		double den=1+Cu[j0];
+		if (!(::fabs(den)>TOO_SMALL)) return false; // note: also false if den is NaN
+		Vector Cj=C.row(j0);
+		for (int i=0; i<n; i++)
+			for (int j=0; j<n; j++)
+				C[i][j] -= Cu[i]*Cj[j]/den;
+		for (int i=0; i<n; i++) M0[i][j0]=M[i][j0];
+	} else {
+		// M = M0 + e_i*v^T  =>  M^{-1} = C - (C*e_i)*(v^T*C) / (1+(v^T*C)_i)
+		Vector v=M.row(i0)-M0.row(i0);
+		Vector vC(n,0.0);
+		for (int k=0; k<n; k++)
+			for (int j=0; j<n; j++)
+				vC[j] += v[k]*C[k][j];
+		double den=1+vC[i0];
+		if (!(::fabs(den)>TOO_SMALL)) return false;
+		Vector Ci(n);
+		for (int i=0; i<n; i++) Ci[i]=C[i][i0];
+		for (int i=0; i<n; i++)
+			for (int j=0; j<n; j++)
+				C[i][j] -= Ci[i]*vC[j]/den;
+		M0.set_row(i0,M.row(i0));
+	}
+
+	normC=infinite_norm(C);
+	if (!(normC<POS_INFINITY)) {
+		// the update has failed: C is not valid anymore
+		kind=-1;
+		return false;
+	}
+
+	nb_updates_since_inversion++;
+	return true;
+}
+
+} // end namespace ibex
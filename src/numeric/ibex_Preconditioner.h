@@ -0,0 +1,125 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Preconditioner.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_PRECONDITIONER_H__
+#define __IBEX_PRECONDITIONER_H__
+
+#include "ibex_IntervalMatrix.h"
+#include "ibex_LinearException.h"
+
+namespace ibex {
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Preconditioner with reuse of the inverse matrix.
+ *
+ * Same as #precond(IntervalMatrix&, IntervalVector&) except that the inverse C of the
+ * real matrix M extracted from [A] (the midpoint, or the lower/upper bound if the midpoint
+ * is singular) is kept from one call to the other. Let M0 be the last inverted matrix:
+ * <ul>
+ * <li> if M only differs from M0 by one row or one column, C is updated in O(n^2)
+ *      with the Sherman-Morrison formula (rank-one update);
+ * <li> otherwise, if ||C||*||M-M0|| <= tol (infinite norms), C is reused as is;
+ * <li> otherwise, C is recomputed (LU factorization and n triangular solves, O(n^3)).
+ * </ul>
+ * Any real matrix can be used to precondition a system so that reusing C is safe:
+ * the tolerance only bounds the distance between C*mid[A] and the identity matrix
+ * (hence the loss of contraction in Gauss-Seidel).
+ *
+ * Typically, the same object is used in all the iterations of Newton and
+ * from a box to its sub-boxes (in a search).
+ */
+class Preconditioner {
+public:
+	/**
+	 * \brief Build a preconditioner for n x n matrices.
+	 *
+	 * \param tol - tolerance for reusing the inverse. With tol=0, the inverse is
+	 *              recomputed at each call (no reuse and no update).
+	 */
+	Preconditioner(int n, double tol=default_tol);
+
+	/**
+	 * \brief Precondition the system [A]x=[b].
+	 *
+	 * \throw SingularMatrixException if the inverse has to be recomputed and
+	 * no real matrix extracted from [A] could be inverted successfully.
+	 */
+	void apply(IntervalMatrix& A, IntervalVector& b);
+
+	/**
+	 * \brief Precondition the matrix [A].
+	 */
+	void apply(IntervalMatrix& A);
+
+	/**
+	 * \brief Forget the current inverse.
+	 */
+	void reset();
+
+	/**
+	 * \brief The current inverse (the last preconditioning matrix).
+	 *
+	 * \pre apply must have been called at least once since the last reset.
+	 */
+	const Matrix& inverse() const;
+
+	/** Size of the matrices */
+	const int n;
+
+	/** Tolerance for reusing the inverse */
+	const double tol;
+
+	/** Default tolerance: 0.1 */
+	static const double default_tol;
+
+	/** Number of inversions (LU factorizations) */
+	int nb_inversions;
+
+	/** Number of rank-one updates */
+	int nb_updates;
+
+	/** Number of calls where the inverse has been reused as is */
+	int nb_reuses;
+
+protected:
+	/* Set C to the inverse of the mid/lb/ub of A */
+	void invert(const IntervalMatrix& A);
+
+	/* Try a rank-one update of C with the (real) matrix M.
+	 * Return false if M-M0 is not of rank one (one row or one column)
+	 * or if the update is numerically unsafe. */
+	bool update(const Matrix& M);
+
+	/* Extract from A the matrix of the same kind as M0 (mid/lb/ub) */
+	Matrix extract(const IntervalMatrix& A) const;
+
+	void precondition(IntervalMatrix& A);
+
+	Matrix C;        // current inverse
+	Matrix M0;       // the matrix inverted by C
+	double normC;    // ||C||
+	int kind;        // -1 (no inverse), 0 (midpoint), 1 (lower bound), 2 (upper bound)
+	int nb_updates_since_inversion;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const Matrix& Preconditioner::inverse() const {
+	assert(kind!=-1);
+	return C;
+}
+
+inline void Preconditioner::reset() {
+	kind=-1;
+}
+
+} // end namespace ibex
+#endif // __IBEX_PRECONDITIONER_H__
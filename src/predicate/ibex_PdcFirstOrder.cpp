@@ -10,10 +10,15 @@
 
 #include "ibex_PdcFirstOrder.h"
 #include "ibex_Linear.h"
+#include "ibex_Entailment.h"
 
 namespace ibex {
 
-PdcFirstOrder::PdcFirstOrder(const System& sys, const IntervalVector& init_box) : Pdc(sys.nb_var), sys(sys), init_box(init_box), e(NULL) { }
+PdcFirstOrder::PdcFirstOrder(const System& sys, const IntervalVector& init_box) : Pdc(sys.nb_var), sys(sys), init_box(init_box), e(NULL), entailment(NULL) { }
+
+bool PdcFirstOrder::inactive(int j) const {
+	return (e && e->original(j)) || (entailment && entailment->is_entailed(sys.ctrs[j]));
+}
 
 BoolInterval PdcFirstOrder::test(const IntervalVector& box) {
 
@@ -22,7 +27,7 @@ BoolInterval PdcFirstOrder::test(const IntervalVector& box) {
 	// count the number of active constraints
 	// in the original system
 	for (int j=0; j<sys.nb_ctr; j++) {
-		if (e && e->original(j)) M--;
+		if (inactive(j)) M--;
 	}
 
 	if (M>n) return MAYBE; // cannote be full rank
@@ -33,7 +38,7 @@ BoolInterval PdcFirstOrder::test(const IntervalVector& box) {
 	sys.goal->gradient(box,J->row(j2++));
 
 	for (int j=0; j<sys.nb_ctr; j++) {
-		if (e && e->original(j)) {
+		if (inactive(j)) {
 			continue;
 		}
 		sys.f[j].gradient(box,J->row(j2++));
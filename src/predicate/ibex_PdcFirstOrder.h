@@ -17,6 +17,8 @@
 
 namespace ibex {
 
+class Entailment;
+
 /** \ingroup predicate
  * \brief Rejection test based on first-order condition
  *
@@ -43,6 +45,12 @@ public:
 	 */
 	void set_entailed(EntailedCtr* e);
 
+	/**
+	 * \brief Set the constraints of the system entailed in the current cell
+	 * (see #ibex::Entailment). They are also ignored.
+	 */
+	void set_entailment(const Entailment* entailment);
+
 	/**
 	 * \brief Test a box.
 	 */
@@ -61,11 +69,20 @@ public:
 protected:
 
 	EntailedCtr* e;
+
+	const Entailment* entailment;
+
+	/* true if the jth constraint of the system is inactive */
+	bool inactive(int j) const;
 };
 
 inline void PdcFirstOrder::set_entailed(EntailedCtr* e) {
 	this->e = e;
 }
 
+inline void PdcFirstOrder::set_entailment(const Entailment* entailment) {
+	this->entailment = entailment;
+}
+
 } // end namespace ibex
 #endif // __IBEX_PDC_FIRST_ORDER_H__
@@ -67,10 +67,15 @@ public:
 
 }
 
-PdcHansenFeasibility::PdcHansenFeasibility(Fnc& f, bool inflating) : Pdc(f.nb_var()), f(f), _solution(f.nb_var()), inflating(inflating) {
+PdcHansenFeasibility::PdcHansenFeasibility(Fnc& f, bool inflating) : Pdc(f.nb_var()), f(f), _solution(f.nb_var()), inflating(inflating),
+		_A_ref(f.image_dim(),f.nb_var()), _pc(new int[f.nb_var()]), _pc_valid(false), _cache(f.image_dim()) {
 
 }
 
+PdcHansenFeasibility::~PdcHansenFeasibility() {
+	delete[] _pc;
+}
+
 BoolInterval PdcHansenFeasibility::test(const IntervalVector& box) {
 
 	int n=f.nb_var();
@@ -81,34 +86,51 @@ BoolInterval PdcHansenFeasibility::test(const IntervalVector& box) {
 	 * the pivoting of Gauss elimination */
 	// ==============================================================
 	Matrix A=f.jacobian(mid).mid();
-	Matrix LU(m,n);
-	int pr[m];
-	int pc[n]; // the interesting output: the variables permutation
-
-	try {
-		real_LU(A,LU,pr,pc);
-	} catch(SingularMatrixException&) {
-		// means in particular that we could not extract an
-		// invertible m*m submatrix
-		return MAYBE;
+
+	if (!_pc_valid || infinite_norm(A-_A_ref)>Preconditioner::default_tol*infinite_norm(_A_ref)) {
+		Matrix LU(m,n);
+		int* pr=new int[m];
+		int* pc=new int[n]; // the interesting output: the variables permutation
+
+		try {
+			real_LU(A,LU,pr,pc);
+		} catch(SingularMatrixException&) {
+			// means in particular that we could not extract an
+			// invertible m*m submatrix
+			delete[] pr;
+			delete[] pc;
+			_pc_valid=false;
+			return MAYBE;
+		}
+
+		// the preconditioning matrix is only valid for the same
+		// selection of variables
+		for (int i=0; i<m; i++)
+			if (!_pc_valid || pc[i]!=_pc[i]) { _cache.reset(); break; }
+
+		for (int j=0; j<n; j++) _pc[j]=pc[j];
+		_A_ref=A;
+		_pc_valid=true;
+		delete[] pr;
+		delete[] pc;
 	}
 	// ==============================================================
 
 
-	PartialFnc pf(f,pc,m,mid);
+	PartialFnc pf(f,_pc,m,mid);
 
 	IntervalVector box2(pf.chop(box));
 	IntervalVector savebox(box2);
 
 	if (inflating) {
-		if (inflating_newton(pf,box2)) {
+		if (inflating_newton(pf,box2,_cache)) {
 			_solution = pf.extend(box2);
 			return YES;
 		}
 	}
 	else {
 		try {
-			newton(pf,box2);
+			newton(pf,box2,_cache);
 			if (box2.is_strict_subset(savebox)) {
 				_solution = pf.extend(box2);
 				return YES;
@@ -13,6 +13,7 @@
 
 #include "ibex_Pdc.h"
 #include "ibex_Fnc.h"
+#include "ibex_Preconditioner.h"
 
 namespace ibex {
 
@@ -32,6 +33,11 @@ public:
 	 */
 	PdcHansenFeasibility(Fnc& f, bool inflating=false);
 
+	/**
+	 * \brief Delete this.
+	 */
+	~PdcHansenFeasibility();
+
 	/**
 	 * \brief Return the enclosure of the last solution found.
 	 */
@@ -48,6 +54,19 @@ public:
 protected:
 	IntervalVector _solution;
 	bool inflating;
+
+	/* The choice of the variables (the permutation pc) is reused from one
+	 * box to the other while the midpoint Jacobian _A does not move by more
+	 * than Preconditioner::default_tol (relatively) from _A_ref. */
+	Matrix _A_ref;
+	int* _pc;
+	bool _pc_valid;
+	/* The preconditioning matrix of the Newton iteration (w.r.t. the current pc). */
+	Preconditioner _cache;
+
+private:
+	PdcHansenFeasibility(const PdcHansenFeasibility&);            // copy constructor forbidden (_pc is owned)
+	PdcHansenFeasibility& operator=(const PdcHansenFeasibility&); // forbidden
 };
 
 
@@ -93,6 +93,14 @@ public:
 		return (T&) *data[typeid(T).name()];
 	}
 
+	/**
+	 * \brief True if this cell contains backtrackable data of class T.
+	 */
+	template<typename T>
+	bool has() const {
+		return data.used(typeid(T).name());
+	}
+
 	/**
 	 * \brief Add backtrackable data into this cell.
 	 *
@@ -13,6 +13,7 @@
 #include "ibex_CtcHC4.h"
 #include "ibex_CtcAcid.h"
 #include "ibex_CtcCompo.h"
+#include "ibex_CtcAdaptiveCompo.h"
 #include "ibex_CtcFixPoint.h"
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearRelaxCombo.h"
@@ -46,10 +47,18 @@ ExtendedSystem* tmp_ext_sys=NULL;
 
 // the defaultoptimizer constructor  1 point for sample_size
 // the equality constraints are relaxed with goal_prec
-DefaultOptimizer::DefaultOptimizer(System& _sys, double prec, double goal_prec) :
+CtcCompo* DefaultOptimizer::compo(Array<Ctc>* list, bool adaptive) {
+	if (!adaptive) return new CtcCompo(*list);
+
+	CtcAdaptiveCompo* c=new CtcAdaptiveCompo(*list);
+	c->adaptive[0]=false; // HC4
+	return c;
+}
+
+DefaultOptimizer::DefaultOptimizer(System& _sys, double prec, double goal_prec, bool adaptive) :
 		Optimizer(_sys,
 			  *new SmearSumRelative(get_ext_sys(_sys,default_eq_eps),prec),
-			  *new CtcCompo (* (contractor_list(_sys,get_ext_sys(_sys,default_eq_eps),prec))), // warning: we don't know which argument is evaluated first (tmp_ext_sys may be NULL)
+			  *compo(contractor_list(_sys,get_ext_sys(_sys,default_eq_eps),prec),adaptive), // warning: we don't know which argument is evaluated first (tmp_ext_sys may be NULL)
 				  prec,
 				  goal_prec,
 				  goal_prec,
@@ -93,6 +102,12 @@ Array<Ctc>*  DefaultOptimizer::contractor_list (System& sys, System& ext_sys,dou
 }
 
 
+void DefaultOptimizer::report() const {
+	Optimizer::report();
+	CtcAdaptiveCompo* c=dynamic_cast<CtcAdaptiveCompo*>(__ctc);
+	if (c) c->report();
+}
+
 // deletion of all dynamically created objects
 DefaultOptimizer::~DefaultOptimizer() {
 	delete &((dynamic_cast<CtcAcid*> (&__ctc->list[1]))->ctc);
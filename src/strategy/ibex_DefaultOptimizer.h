@@ -28,8 +28,18 @@ public:
 	 * \param sys       - The system to optimize
 	 * \param prec      - Stopping criterion for box splitting (absolute precision)
 	 * \param goal_prec - Stopping criterion for the objective (relative precision)
+	 * \param adaptive  - If true, the contractors are scheduled by a \link CtcAdaptiveCompo \endlink
+	 *                    (the first one, HC4, being called at every node). The statistics are
+	 *                    printed by #report(). By default: false.
 	 */
-    DefaultOptimizer(System& sys, double prec, double goal_prec);
+    DefaultOptimizer(System& sys, double prec, double goal_prec, bool adaptive=false);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&).
+	 *
+	 * Also print the statistics of the adaptive scheduling (if any).
+	 */
+	virtual void report() const;
 
 	/**
 	 * \brief Delete *this.
@@ -38,6 +48,7 @@ public:
 
 private:
 	Array<Ctc>*  contractor_list (System& sys, System& ext_sys,double prec);
+	CtcCompo* compo(Array<Ctc>* list, bool adaptive);
 //	std::vector<CtcXNewton::corner_point>* default_corners ();
 
 
@@ -13,8 +13,11 @@
 #include "ibex_CtcHC4.h"
 #include "ibex_CtcAcid.h"
 #include "ibex_CtcNewton.h"
+#include "ibex_CtcKrawczyk.h"
+#include "ibex_CtcHansenSengupta.h"
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_CtcCompo.h"
+#include "ibex_CtcAdaptiveCompo.h"
 #include "ibex_CtcFixPoint.h"
 #include "ibex_CellStack.h"
 #include "ibex_LinearRelaxCombo.h"
@@ -40,7 +43,7 @@ bool square_eq_sys(const System& sys) {
 }*/
 
 // the contractor list  hc4, acid(hc4), newton (if the system is square), xnewton
-Array<Ctc>*  DefaultSolver::contractor_list (System& sys, double prec) {
+Array<Ctc>*  DefaultSolver::contractor_list (System& sys, double prec, newton_ctc nc) {
 	Array<Ctc>* ctc_list;
 	ctc_list= new Array<Ctc>(4);
 	// first contractor : non incremental hc4
@@ -50,7 +53,16 @@ Array<Ctc>*  DefaultSolver::contractor_list (System& sys, double prec) {
 	int index=2;
 	// if the system is a square system of equations, the third contractor is Newton
 	if (square_eq_sys(sys)) {
-		ctc_list->set_ref(index,*new CtcNewton(sys.f,5e8,prec,1.e-4));
+		switch (nc) {
+		case KRAWCZYK:
+			ctc_list->set_ref(index,*new CtcKrawczyk(sys.f,5e8,prec));
+			break;
+		case HANSEN_SENGUPTA:
+			ctc_list->set_ref(index,*new CtcHansenSengupta(sys.f,5e8,prec,1.e-4));
+			break;
+		default:
+			ctc_list->set_ref(index,*new CtcNewton(sys.f,5e8,prec,1.e-4));
+		}
 		index++;
 	}
 	// the last contractor is XNewton
@@ -67,7 +79,15 @@ Array<Ctc>*  DefaultSolver::contractor_list (System& sys, double prec) {
 }
 
 
-DefaultSolver::DefaultSolver(System& sys, double prec) : Solver(*new CtcCompo (* (contractor_list(sys,prec))),
+CtcCompo* DefaultSolver::compo(Array<Ctc>* list, bool adaptive) {
+	if (!adaptive) return new CtcCompo(*list);
+
+	CtcAdaptiveCompo* c=new CtcAdaptiveCompo(*list);
+	c->adaptive[0]=false; // HC4
+	return c;
+}
+
+DefaultSolver::DefaultSolver(System& sys, double prec, newton_ctc nc, bool adaptive) : Solver(*compo(contractor_list(sys,prec,nc),adaptive),
 		*new SmearSumRelative(sys,prec),
 		*new CellStack(), prec),
 		sys(sys), __ctc(dynamic_cast<CtcCompo*>(&ctc)), __bsc(&bsc),__buffer(&buffer) {
@@ -75,6 +95,11 @@ DefaultSolver::DefaultSolver(System& sys, double prec) : Solver(*new CtcCompo (*
 	srand(1);
 }
 
+void DefaultSolver::report() const {
+	CtcAdaptiveCompo* c=dynamic_cast<CtcAdaptiveCompo*>(__ctc);
+	if (c) c->report();
+}
+
 // delete all objects dynamically created in the constructor  TO UPDATE if the constructor is changed
 
 DefaultSolver::~DefaultSolver() {
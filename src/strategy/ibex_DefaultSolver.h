@@ -24,13 +24,29 @@ namespace ibex {
  */
 class DefaultSolver : public Solver {
 public:
+	enum newton_ctc {NEWTON, KRAWCZYK, HANSEN_SENGUPTA};
+
 	/**
 	 * \brief Create a default solver.
 	 *
 	 * \param sys  - The system to solve
 	 * \param prec - Stopping criterion for box splitting (absolute precision)
+	 * \param nc   - The contractor applied if the system is square (default is NEWTON)
+	 *    - NEWTON: interval Newton with the Hansen matrix (see \link CtcNewton \endlink)
+	 *    - KRAWCZYK: Krawczyk operator (see \link CtcKrawczyk \endlink)
+	 *    - HANSEN_SENGUPTA: Hansen-Sengupta operator with the Jacobian matrix (see \link CtcHansenSengupta \endlink)
+	 *    With the two last options, the boxes proven to contain a unique solution are
+	 *    contracted until the floating-point precision and not bisected anymore.
+	 * \param adaptive - If true, the contractors are scheduled by a \link CtcAdaptiveCompo \endlink
+	 *    (the first one, HC4, being called at every node). The statistics can be printed
+	 *    at the end with #report(). By default: false.
+	 */
+    DefaultSolver(System& sys, double prec, newton_ctc nc=NEWTON, bool adaptive=false);
+
+	/**
+	 * \brief Print the statistics of the adaptive scheduling (if any).
 	 */
-    DefaultSolver(System& sys, double prec);
+	void report() const;
 
 	/**
 	 * \brief Delete *this.
@@ -43,7 +59,8 @@ private:
 	CtcCompo* __ctc;
 	Bsc* __bsc;
 	CellBuffer* __buffer;
-	Array<Ctc>*  contractor_list (System& sys, double prec);
+	Array<Ctc>*  contractor_list (System& sys, double prec, newton_ctc nc);
+	CtcCompo* compo(Array<Ctc>* list, bool adaptive);
 //	std::vector<CtcXNewton::corner_point>* default_corners ();
 };
 
@@ -0,0 +1,26 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Entailment.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Entailment.h"
+
+namespace ibex {
+
+Entailment::Entailment() : nb_trials(0) {
+
+}
+
+Entailment::Entailment(const Entailment& e) : Backtrackable(), entailed(e.entailed), nb_trials(0) {
+
+}
+
+std::pair<Backtrackable*,Backtrackable*> Entailment::down() {
+	return std::pair<Backtrackable*,Backtrackable*>(new Entailment(*this),new Entailment(*this));
+}
+
+} // end namespace ibex
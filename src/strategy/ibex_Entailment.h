@@ -0,0 +1,120 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Entailment.h
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_ENTAILMENT_H__
+#define __IBEX_ENTAILMENT_H__
+
+#include "ibex_Backtrackable.h"
+#include "ibex_NumConstraint.h"
+
+#include <set>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Constraints entailed in a cell.
+ *
+ * A constraint is entailed in a box if it is satisfied by all the points of the box.
+ * Since it is then also entailed in any sub-box, the entailed constraints of a cell
+ * are inherited by its children cells, and the operators (contractors, relaxations,
+ * etc.) can skip them in the whole subtree.
+ *
+ * The constraints are identified by their function and their comparison operator,
+ * so that the entailment proven by an operator is known by all the operators built
+ * with the same system.
+ *
+ * An entailment must only be recorded if it is proven on the box of the cell (or on a
+ * superset). During a tentative contraction of a sub-box (e.g., a slice in a
+ * shaving), the operator must call #start_trial(): the entailments can be read
+ * but are not recorded until #end_trial().
+ */
+class Entailment : public Backtrackable {
+public:
+	/**
+	 * \brief Create an empty structure (root cell).
+	 */
+	Entailment();
+
+	/**
+	 * \brief True if the constraint is entailed.
+	 */
+	bool is_entailed(const NumConstraint& ctr) const;
+
+	/**
+	 * \brief Record that the constraint is entailed.
+	 *
+	 * Does nothing during a trial (see #start_trial()).
+	 */
+	void set_entailed(const NumConstraint& ctr);
+
+	/**
+	 * \brief Number of entailed constraints.
+	 */
+	int nb_entailed() const;
+
+	/**
+	 * \brief Start a tentative contraction (trials can be nested).
+	 */
+	void start_trial();
+
+	/**
+	 * \brief End a tentative contraction.
+	 */
+	void end_trial();
+
+	/**
+	 * \brief True during a tentative contraction.
+	 */
+	bool in_trial() const;
+
+	/**
+	 * \brief Duplicate the structure into the left/right nodes
+	 */
+	std::pair<Backtrackable*,Backtrackable*> down();
+
+protected:
+	Entailment(const Entailment&);
+
+	typedef std::pair<const Function*,CmpOp> Key;
+
+	std::set<Key> entailed;
+
+	int nb_trials;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline bool Entailment::is_entailed(const NumConstraint& ctr) const {
+	return !entailed.empty() && entailed.find(Key(&ctr.f,ctr.op))!=entailed.end();
+}
+
+inline void Entailment::set_entailed(const NumConstraint& ctr) {
+	if (nb_trials==0) entailed.insert(Key(&ctr.f,ctr.op));
+}
+
+inline int Entailment::nb_entailed() const {
+	return entailed.size();
+}
+
+inline void Entailment::start_trial() {
+	nb_trials++;
+}
+
+inline void Entailment::end_trial() {
+	assert(nb_trials>0);
+	nb_trials--;
+}
+
+inline bool Entailment::in_trial() const {
+	return nb_trials>0;
+}
+
+} // end namespace ibex
+#endif // __IBEX_ENTAILMENT_H__
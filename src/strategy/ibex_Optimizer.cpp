@@ -14,6 +14,7 @@
 #include "ibex_Timer.h"
 #include "ibex_OptimProbing.cpp_"
 #include "ibex_OptimSimplex.cpp_"
+#include "ibex_OptimLocalSearch.cpp_"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_Ctc3BCid.h"
 #include "ibex_CtcHC4.h"
@@ -35,6 +36,7 @@ const double Optimizer::default_goal_rel_prec = 1e-07;
 const double Optimizer::default_goal_abs_prec = 1e-07;
 const int    Optimizer::default_sample_size = 10;
 const double Optimizer::default_equ_eps = 1e-08;
+const int    Optimizer::default_local_search_iter = 20;
 const double Optimizer::default_loup_tolerance = 0.1;
 
 void Optimizer::write_ext_box(const IntervalVector& box, IntervalVector& ext_box) {
@@ -62,11 +64,12 @@ Optimizer::Optimizer(System& user_sys, Bsc& bsc, Ctc& ctc, double prec,
 				ext_sys(user_sys,equ_eps),
 				bsc(bsc), ctc(ctc), buffer(n),
 				prec(prec), goal_rel_prec(goal_rel_prec), goal_abs_prec(goal_abs_prec),
-				sample_size(sample_size), mono_analysis_flag(true), in_HC4_flag(true), trace(false),
+				sample_size(sample_size), mono_analysis_flag(true), in_HC4_flag(true),
+				local_search_flag(false), local_search_iter(default_local_search_iter), trace(false),
 				timeout(1e08), loup(POS_INFINITY), uplo(NEG_INFINITY), pseudo_loup(POS_INFINITY),
-				loup_point(n), loup_box(n),
-				df(*user_sys.goal,Function::DIFF), rigor(rigor),
-				uplo_of_epsboxes(POS_INFINITY), nb_cells(0), loup_changed(false) {
+				loup_point(n), loup_box(n), nb_cells(0), nb_local(0), nb_local_iter(0),
+				df(*user_sys.goal,Function::DIFF), loup_changed(false), rigor(rigor),
+				lp_point(n), lp_point_found(false), uplo_of_epsboxes(POS_INFINITY), current_cell(NULL) {
 
 	// ==== build the system of equalities only ====
 	try {
@@ -170,6 +173,7 @@ bool Optimizer::update_real_loup() {
 
 // 2 methods for searching a better feasible point and a better loup
 void Optimizer::update_loup(const IntervalVector& box) {
+	lp_point_found=false; // set by update_loup_simplex
 	if (rigor && equs!=NULL) { // a loup point will not be safe (pseudo loup is not the real loup)
 		double old_pseudo_loup=pseudo_loup;
 		if (update_loup_probing(box) && pseudo_loup < old_pseudo_loup + default_loup_tolerance*fabs(loup-pseudo_loup)) {
@@ -179,6 +183,10 @@ void Optimizer::update_loup(const IntervalVector& box) {
 		}
 		if (update_loup_simplex(box) && pseudo_loup < old_pseudo_loup + default_loup_tolerance*fabs(loup-pseudo_loup)) {
 			loup_changed |= update_real_loup();
+			old_pseudo_loup=pseudo_loup;
+		}
+		if (local_search_flag && update_loup_local_search(box) && pseudo_loup < old_pseudo_loup + default_loup_tolerance*fabs(loup-pseudo_loup)) {
+			loup_changed |= update_real_loup();
 		}
 	} else {
 		loup_changed |= update_loup_probing(box); // update pseudo_loup
@@ -186,6 +194,10 @@ void Optimizer::update_loup(const IntervalVector& box) {
 		loup=pseudo_loup;
 		loup_changed |= update_loup_simplex(box);  // update pseudo_loup
 		loup = pseudo_loup;
+		if (local_search_flag) {
+			loup_changed |= update_loup_local_search(box);  // update pseudo_loup
+			loup = pseudo_loup;
+		}
 	}
 }
 
@@ -268,11 +280,10 @@ void Optimizer::contract_and_bound(Cell& c, const IntervalVector& init_box) {
 	//		cout << "   x before=" << c.box << endl;
 	//		cout << "   y before=" << y << endl;
 
-	contract(c.box, init_box);
+	contract(c, init_box);
 
 	//		cout << "   x after=" << c.box << endl;
 	//		cout << "   y after=" << y << endl;
-	// TODO: no more cell in argument here (just a box). Does it matter?
 	/*====================================================================*/
 
 
@@ -334,8 +345,22 @@ void Optimizer::firstorder_contract(  IntervalVector& box, const  IntervalVector
 
 }
 
+void Optimizer::contract ( Cell& c, const IntervalVector& init_box) {
+	current_cell=&c;
+	try {
+		contract(c.box, init_box);
+	} catch (EmptyBoxException& e) {
+		current_cell=NULL;
+		throw e;
+	}
+	current_cell=NULL;
+}
+
 void Optimizer::contract ( IntervalVector& box, const IntervalVector& init_box) {
-	ctc.contract(box);
+	if (current_cell!=NULL && &box==&current_cell->box)
+		ctc.contract(*current_cell);
+	else
+		ctc.contract(box);
 }
 
 void Optimizer::optimize(const IntervalVector& init_box) {
@@ -349,6 +374,9 @@ void Optimizer::optimize(const IntervalVector& init_box) {
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
+	// add data required by the contractor
+	ctc.add_backtrackable(*root);
+
 	// add data required by optimizer + Fritz John contractor
 	root->add<EntailedCtr>();
 	//root->add<Multipliers>();
@@ -444,7 +472,7 @@ void Optimizer::update_uplo_of_epsboxes(double ymin) {
 
 
 
-void Optimizer::report() {
+void Optimizer::report() const {
 
 	if (timeout >0 &&  time >=timeout ) {
 		cout << "time limit " << timeout << "s. reached " << endl;
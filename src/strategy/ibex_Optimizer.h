@@ -92,7 +92,7 @@ public:
 	 *     <li>total number of cells created during the exploration
 	 * </ul>
 	 */
-	void report();
+	virtual void report() const;
 
 	/**
 	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&).
@@ -182,6 +182,15 @@ public:
 	 * The value can be fixed by the user. By default: true. */
 	bool in_HC4_flag;
 
+	/** Flag for applying a local search when looking for a "loup"
+	 * (see #update_loup_local_search(const IntervalVector&)).
+	 * The value can be fixed by the user. By default: false. */
+	bool local_search_flag;
+
+	/** Maximal number of iterations of each local search.
+	 * The value can be fixed by the user. By default: #default_local_search_iter. */
+	int local_search_iter;
+
 	/** Trace activation flag.
 	 * The value can be fixed by the user. By default: 0  nothing is printed
 	 1 for printing each better found feasible point
@@ -214,6 +223,9 @@ public:
 	/** Default sample size */
 	static const int default_sample_size;
 
+	/** Default maximal number of iterations of a local search: 20 */
+	static const int default_local_search_iter;
+
 	/** Default epsilon applied to equations */
 	static const double default_equ_eps;
 
@@ -245,6 +257,12 @@ public:
 	/** Number of cells put into the heap (which passed through the contractors)  */
 	int nb_cells;
 
+	/** Number of local searches that have decreased the loup */
+	int nb_local;
+
+	/** Total number of iterations of the local searches */
+	int nb_local_iter;
+
 protected:
 	/**
 	 * \brief Return an upper bound of f(x).
@@ -283,6 +301,15 @@ protected:
 	 */
 	void contract_and_bound(Cell& c, const IntervalVector& init_box);
 
+	/**
+	 * \brief Contraction procedure for processing a cell.
+	 *
+	 * By default, call #contract(IntervalVector&, const IntervalVector&)
+	 * on the box of the cell, the cell being transmitted to the contractor
+	 * ctc (see #ibex::Ctc::contract(Cell&)).
+	 */
+	 virtual void contract(Cell& c, const IntervalVector& init_box );
+
 	/**
 	 * \brief Contraction procedure for processing a box.
 	 *
@@ -443,6 +470,55 @@ protected:
 	 */
 	bool update_loup_simplex(const IntervalVector& box);
 
+	/**
+	 * \brief Update loup using a local search.
+	 *
+	 * Run #local_search(const IntervalVector&, const Vector&) from the optimum of the
+	 * linear program solved by #update_loup_simplex(const IntervalVector&) (if any)
+	 * and from the midpoint of the box.
+	 * return true if the loup has been modified.
+	 */
+	bool update_loup_local_search(const IntervalVector& box);
+
+	/**
+	 * \brief Local search of a loup in a box.
+	 *
+	 * Starting from the point \a start (projected onto the box), performs at most
+	 * #local_search_iter iterations of:
+	 * <ul><li> a projected Newton method on the objective if there is no constraint,
+	 *     <li> a sequential linear programming (with a trust region) on the normalized
+	 *          system otherwise.
+	 * </ul>
+	 * The feasibility is restored first, then the objective is decreased. Each feasible
+	 * iterate is submitted to #check_candidate(const Vector&, bool).
+	 *
+	 * return true if the loup has been modified.
+	 */
+	bool local_search(const IntervalVector& box, const Vector& start);
+
+	/**
+	 * \brief Projected Newton step on the objective, in the box and the trust region.
+	 *
+	 * return false if no descent direction is found.
+	 */
+	bool newton_step(const IntervalVector& box, const Vector& x, double radius, Vector& d);
+
+	/**
+	 * \brief Step of the sequential linear programming, in the box and the trust region.
+	 *
+	 * \param g - the values of the constraints in \a x.
+	 * return false if the linear program has no solution.
+	 */
+	bool slp_step(const IntervalVector& box, const Vector& x, const Vector& g, double radius, Vector& d);
+
+	/**
+	 * \brief Maximal violation of the constraints in x (0 if x is inner).
+	 *
+	 * The values of the constraints are stored in \a g.
+	 * Return +oo if x is outside the definition domain of one constraint.
+	 */
+	double violation(const Vector& x, Vector& g);
+
 
 	/**
 	 * \brief Display the loup (for debug)
@@ -492,6 +568,12 @@ private:
 	/** Inner contractor (for the negation of g) */
 	CtcUnion* is_inside;
 
+	/** Optimum of the last linear program solved in ibex_OptimSimplex.cpp_ */
+	Vector lp_point;
+
+	/** True if #lp_point has been set for the current box */
+	bool lp_point_found;
+
 	/** Lower bound of the small boxes taken by the precision */
 	double uplo_of_epsboxes;
 
@@ -500,6 +582,9 @@ private:
 	/** Currently entailed constraints */
 	EntailedCtr* entailed;
 
+	/** Cell being contracted (see #contract(Cell&, const IntervalVector&)) */
+	Cell* current_cell;
+
 	/** Miscellaneous   for statistics */
 	int nb_simplex;
 	int nb_rand;
@@ -48,7 +48,7 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 			if (trace)  cout << "    ctc " << i;
 			tmpbox=cell.box;
 
-			ctc[i].contract(cell.box);
+			ctc[i].contract(cell);
 
 			if (tmpbox.rel_distance(cell.box)>0) {
 				fix_count=0;
@@ -93,9 +93,9 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 	Cell* root=new Cell(init_box);
 
 	// add data required by the contractors
-//	for (int i=0; i<ctc.size(); i++) {
-//		ctc[i].init_root(*root);
-//	}
+	for (int i=0; i<ctc.size(); i++) {
+		ctc[i].add_backtrackable(*root);
+	}
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
@@ -31,7 +31,7 @@ void Solver::start(const IntervalVector& init_box) {
 	Cell* root=new Cell(init_box);
 
 	// add data required by the contractor
-	//ctc.init_root(*root);
+	ctc.add_backtrackable(*root);
 
 	// add data required by this solver
 	root->add<BisectedVar>();
@@ -62,7 +62,7 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 
 			if (v!=-1) impact.set(v);
 
-			ctc.contract(c->box,impact);
+			ctc.contract(*c,impact);
 
 			if (v!=-1) impact.unset(v);
 
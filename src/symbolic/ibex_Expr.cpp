@@ -135,6 +135,28 @@ const ExprChi& ExprChi::new_(const ExprNode& a, const ExprNode& b, const ExprNod
 	return *new ExprChi(args2);
 }
 
+const ExprSum& ExprSum::new_(const ExprNode** args, int n) {
+	if (n==0) throw DimException("\"sum\" expects at least one argument");
+	for (int i=0; i<n; i++)
+		if (!(args[i]->type() == Dim::SCALAR)) throw DimException("\"sum\" expects scalar arguments");
+	return *new ExprSum(args,n);
+}
+
+const ExprSum& ExprSum::new_(const Array<const ExprNode>& args) {
+	int n=args.size();
+	const ExprNode** nodes=new const ExprNode*[n];
+	for (int i=0; i<n; i++)
+		nodes[i]=&args[i];
+	try {
+		const ExprSum& res=new_(nodes,n);
+		delete[] nodes;
+		return res;
+	} catch(DimException& e) {
+		delete[] nodes;
+		throw e;
+	}
+}
+
 
 ExprApply::ExprApply(const Function& f, const ExprNode** args) :
 		ExprNAryOp(args,f.nb_arg(),f.expr().dim),
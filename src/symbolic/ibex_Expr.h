@@ -404,6 +404,36 @@ private:
 	ExprChi(const ExprChi&); // copy constructor forbidden
 };
 
+/**
+ * \ingroup symbolic
+ * \brief Sum of n scalar expressions
+ *
+ * The n-ary counterpart of ExprAdd: the sum x_1+...+x_n is represented by
+ * a single node (instead of a chain of n-1 additions). Its evaluation
+ * uses compensated accumulation (see ibex_CompensatedArith.h) and its
+ * projection runs in O(n).
+ */
+class ExprSum : public ExprNAryOp {
+public:
+
+	/** Create an equality constraint sum(x_1,...,x_n)=expr. */
+	const ExprCtr& operator=(const ExprNode& expr) const { return ((ExprNode&) *this)=expr; }
+
+	/** Create an equality constraint sum(x_1,...,x_n)=value. */
+	const ExprCtr& operator=(const Interval& value) const  { return ((ExprNode&) *this)=value; }
+
+	/** Accept an #ibex::ExprVisitor visitor. */
+	virtual void acceptVisitor(ExprVisitor& v) const { v.visit(*this); };
+
+	static const ExprSum& new_(const ExprNode** args, int n);
+	static const ExprSum& new_(const Array<const ExprNode>& args);
+
+private:
+	ExprSum(const ExprNode** args, int n) : ExprNAryOp(args,n,Dim()) {	}
+
+	ExprSum(const ExprSum&); // copy constructor forbidden
+};
+
 
 namespace parser {
 class ExprEntity;
@@ -1486,6 +1516,10 @@ inline const ExprAtan2& atan2(const ExprNode& exp1, const ExprNode& exp2) {
 inline const ExprChi& chi(const ExprNode& exp1, const ExprNode& exp2, const ExprNode& exp3) {
 	return ExprChi::new_(exp1, exp2, exp3); }
 
+/** Sum of scalar expressions */
+inline const ExprSum& sum(const Array<const ExprNode>& args) {
+	return ExprSum::new_(args); }
+
 /** Addition of an expression to a constant */
 inline const ExprAdd& operator+(const ExprNode& left, const Interval& value) {
 	return left+ExprConstant::new_scalar(value); }
@@ -249,6 +249,19 @@ void ExprCopy::visit(const ExprChi& e) {  // TODO to check  Jordan: Gilles C. he
 	delete [] args2;
 }
 
+void ExprCopy::visit(const ExprSum& e) {
+	for (int i=0; i<e.nb_args; i++)
+		visit(e.arg(i));
+
+	const ExprNode** args2 = new const ExprNode* [e.nb_args];
+	for (int i=0; i<e.nb_args; i++) {
+		args2[i]=&ARG(i);
+		mark(e.arg(i));
+	}
+	clone.insert(e, &ExprSum::new_(args2,e.nb_args));
+	delete [] args2;
+}
+
 
 
 typedef Domain (*dom_func2)(const Domain&, const Domain&);
@@ -356,6 +356,11 @@ void ExprDiff::visit(const ExprChi& e) {
 	not_implemented("diff with chi");
 }
 
+void ExprDiff::visit(const ExprSum& e) {
+	for (int i=0; i<e.nb_args; i++)
+		add_grad_expr(e.arg(i), *grad[e]);
+}
+
 void ExprDiff::visit(const ExprAdd& e)   { add_grad_expr(e.left,  *grad[e]);
                                            add_grad_expr(e.right, *grad[e]); }
 void ExprDiff::visit(const ExprMul& e)   { if (!e.dim.is_scalar()) not_implemented("diff with matrix/vector multiplication"); // TODO
@@ -46,6 +46,7 @@ protected:
 	void visit(const ExprVector& e);
 	void visit(const ExprApply& e);
 	void visit(const ExprChi& e);
+	void visit(const ExprSum& e);
 	void visit(const ExprAdd& e);
 	void visit(const ExprMul& e);
 	void visit(const ExprSub& e);
@@ -61,6 +61,23 @@ public:
 
 std::ostream& operator<<(std::ostream& os, const ExprLabel&);
 
+/** \ingroup symbolic
+ *
+ * \brief Scalar domains of an array of labels.
+ *
+ * Allows to use the labels of the arguments of a n-ary node as the
+ * terms of sum_terms/proj_sum_terms (see ibex_CompensatedArith.h).
+ */
+class LabelDomains {
+public:
+	LabelDomains(ExprLabel** x) : x(x) { }
+
+	/** The domain of the ith label. */
+	Interval& operator()(int i) const { return x[i]->d->i(); }
+
+	ExprLabel** x;
+};
+
 } // end namespace ibex
 
 #endif // __IBEX_EXPRLABEL_H__
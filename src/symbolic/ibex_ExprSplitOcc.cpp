@@ -317,6 +317,16 @@ void ExprSplitOcc::visit(const ExprChi& e) {
 	clone.insert(e, &ExprChi::new_(new_args));
 }
 
+void ExprSplitOcc::visit(const ExprSum& e) {
+	const ExprNode** new_args=new const ExprNode*[e.nb_args];
+	for (int i=0; i<e.nb_args; i++) {
+		visit(e.arg(i));
+		new_args[i]=clone[e.arg(i)];
+	}
+	clone.insert(e, &ExprSum::new_(new_args,e.nb_args));
+	delete[] new_args;
+}
+
 void ExprSplitOcc::binary_copy(const ExprBinaryOp& e, const ExprNode& (*f)(const ExprNode&, const ExprNode&)) {
 	visit(e.left);
 	const ExprNode& l=*clone[e.left];
@@ -31,6 +31,7 @@ class ExprConstant;
 class ExprVector;
 class ExprApply;
 class ExprChi;
+class ExprSum;
 
 class ExprAdd;
 class ExprMul;
@@ -132,6 +133,12 @@ class ExprVisitor {
 	   visit((const ExprNAryOp&) ee);
    }
 
+   /** Visit a n-ary sum.
+   * By default: call visit(const ExprNAryOp& e). */
+   virtual void visit(const ExprSum& e) {
+	   visit((const ExprNAryOp&) e);
+   }
+
   /*==================== binary operators =========================*/
   /** Visit an addition (Implementation is not mandatory).
    * By default: call visit(const ExprBinaryOp& e). */
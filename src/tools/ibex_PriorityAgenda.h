@@ -0,0 +1,176 @@
+/* ============================================================================
+ * I B E X - Propagation Agenda with priorities
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_PRIORITY_AGENDA_H__
+#define __IBEX_PRIORITY_AGENDA_H__
+
+#include "ibex_Agenda.h"
+#include <cassert>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Propagation agenda ordered by priorities.
+ *
+ * Contrary to #ibex::Agenda (a FIFO list), the element popped is the one
+ * with the highest priority. The agenda is an indexed binary heap: each element
+ * (an integer in [0,size-1]) appears at most once and its position in the heap
+ * is stored, so that its priority can be increased in O(log(size))
+ * (the "decrease-key" operation of a min-heap).
+ */
+class PriorityAgenda {
+
+ public:
+  /**
+   * \brief Create an empty agenda for the elements 0..size-1.
+   */
+  PriorityAgenda(int size);
+
+  /**
+   * \brief Delete *this.
+   */
+  ~PriorityAgenda();
+
+  /**
+   * \brief Push p with a given priority.
+   *
+   * If p is already in the agenda, its priority is set to the
+   * maximum of the current one and \a priority.
+   */
+  void push(int p, double priority);
+
+  /**
+   * \brief Pop the element with the highest priority.
+   *
+   * \throw EmptyAgendaException if the agenda is empty.
+   */
+  void pop(int& p);
+
+  /**
+   * \brief Remove all the elements.
+   */
+  void flush();
+
+  /**
+   * \brief True if the agenda is empty.
+   */
+  bool empty() const;
+
+  /**
+   * \brief True if p is in the agenda.
+   */
+  bool contains(int p) const;
+
+  /**
+   * \brief Priority of p (must be in the agenda).
+   */
+  double priority(int p) const;
+
+ protected:
+  /* Move up (resp. down) the element at the ith position of the heap */
+  void sift_up(int i);
+  void sift_down(int i);
+
+  /* Exchange the elements at the ith and jth positions of the heap */
+  void swap(int i, int j);
+
+  int size;     // number of possible elements
+  int nb;       // number of elements in the heap
+  int* heap;    // heap[i]: element at the ith position
+  int* pos;     // pos[p]: position of p in the heap (-1 if absent)
+  double* prio; // prio[p]: priority of p
+};
+
+/*================================== inline implementations ========================================*/
+
+inline PriorityAgenda::PriorityAgenda(int size) : size(size), nb(0) {
+	heap = new int[size];
+	pos  = new int[size];
+	prio = new double[size];
+	for (int p=0; p<size; p++) pos[p]=-1;
+}
+
+inline PriorityAgenda::~PriorityAgenda() {
+	delete[] heap;
+	delete[] pos;
+	delete[] prio;
+}
+
+inline void PriorityAgenda::swap(int i, int j) {
+	int tmp=heap[i];
+	heap[i]=heap[j];
+	heap[j]=tmp;
+	pos[heap[i]]=i;
+	pos[heap[j]]=j;
+}
+
+inline void PriorityAgenda::sift_up(int i) {
+	while (i>0) {
+		int parent=(i-1)/2;
+		if (prio[heap[parent]]>=prio[heap[i]]) break;
+		swap(i,parent);
+		i=parent;
+	}
+}
+
+inline void PriorityAgenda::sift_down(int i) {
+	while (2*i+1<nb) {
+		int child=2*i+1;
+		if (child+1<nb && prio[heap[child+1]]>prio[heap[child]]) child++;
+		if (prio[heap[i]]>=prio[heap[child]]) break;
+		swap(i,child);
+		i=child;
+	}
+}
+
+inline void PriorityAgenda::push(int p, double priority) {
+	assert(p>=0 && p<size);
+
+	if (pos[p]==-1) {
+		heap[nb]=p;
+		pos[p]=nb;
+		prio[p]=priority;
+		sift_up(nb++);
+	} else if (priority>prio[p]) {
+		prio[p]=priority;
+		sift_up(pos[p]);
+	}
+}
+
+inline void PriorityAgenda::pop(int& p) {
+	if (nb==0) throw EmptyAgendaException();
+
+	p=heap[0];
+	swap(0,--nb);
+	pos[p]=-1;
+	sift_down(0);
+}
+
+inline void PriorityAgenda::flush() {
+	for (int i=0; i<nb; i++) pos[heap[i]]=-1;
+	nb=0;
+}
+
+inline bool PriorityAgenda::empty() const {
+	return nb==0;
+}
+
+inline bool PriorityAgenda::contains(int p) const {
+	return pos[p]!=-1;
+}
+
+inline double PriorityAgenda::priority(int p) const {
+	assert(contains(p));
+	return prio[p];
+}
+
+} // namespace ibex
+#endif // __IBEX_PRIORITY_AGENDA_H__
@@ -0,0 +1,277 @@
+/* ============================================================================
+ * I B E X - Batch Arithmetic Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestBatchArith.h"
+#include "ibex_BatchEval.h"
+#include "ibex_Function.h"
+#include "ibex_Tube.h"
+#include <math.h>
+
+using namespace std;
+
+namespace {
+
+const int N=2000;
+
+// deterministic pseudo-random generator in [0,1]
+unsigned long seed=1;
+double rnd() {
+	seed = (seed*1103515245UL+12345UL) % 2147483648UL;
+	return seed/2147483648.0;
+}
+
+long double exp_ld(long double x)  { return ::expl(x); }
+long double log_ld(long double x)  { return ::logl(x); }
+long double cos_ld(long double x)  { return ::cosl(x); }
+long double sin_ld(long double x)  { return ::sinl(x); }
+long double atan_ld(long double x) { return ::atanl(x); }
+long double pow_ld(long double x)  { return ::powl(x,0.37L); }
+long double pow3_ld(long double x) { return x*x*x; }
+
+ibex::Interval pow_real(const ibex::Interval& x) { return ibex::pow(x,0.37); }
+ibex::Interval pow_int(const ibex::Interval& x)  { return ibex::pow(x,3); }
+
+}
+
+namespace ibex {
+
+void TestBatchArith::random_intervals(Interval* x, int n, double scale, bool positive) {
+	for (int i=0; i<n; i++) {
+		double s=scale>0 ? scale : ::pow(10.0,-6+12*rnd());
+		double a=positive ? s*rnd() : s*(2*rnd()-1);
+		// degenerated, thin and large intervals
+		double w= (i%3==0) ? 0 : rnd()*(i%3==1? 1e-6 : 1)*(::fabs(a)+1);
+		x[i]=Interval(a,a+w);
+	}
+}
+
+void TestBatchArith::check_batch(const Interval* x, const Interval* y, int n,
+		Interval (*f)(const Interval&), long double (*g)(long double)) {
+	for (int i=0; i<n; i++) {
+		// containment
+		double pt[3] = { x[i].lb(), x[i].mid(), x[i].ub() };
+		for (int k=0; k<3; k++) {
+			long double r=g(pt[k]);
+			TEST_ASSERT((long double) y[i].lb()<=r && r<=(long double) y[i].ub());
+		}
+		// tightness w.r.t. the scalar function
+		Interval ys=f(x[i]);
+		double err=1e-13*(1+::fabs(ys.lb())+::fabs(ys.ub()));
+		TEST_ASSERT(y[i].lb()>=ys.lb()-err && y[i].ub()<=ys.ub()+err);
+	}
+}
+
+void TestBatchArith::exp01() {
+	Interval x[N], y[N];
+	random_intervals(x,N,700,false);
+	batch_exp(x,y,N);
+	check_batch(x,y,N,exp,exp_ld);
+}
+
+void TestBatchArith::log01() {
+	Interval x[N], y[N];
+	random_intervals(x,N,0,true);
+	batch_log(x,y,N);
+	check_batch(x,y,N,log,log_ld);
+}
+
+void TestBatchArith::cos01() {
+	Interval x[N], y[N];
+	random_intervals(x,N,0,false);
+	batch_cos(x,y,N);
+	check_batch(x,y,N,cos,cos_ld);
+}
+
+void TestBatchArith::sin01() {
+	Interval x[N], y[N];
+	random_intervals(x,N,0,false);
+	batch_sin(x,y,N);
+	check_batch(x,y,N,sin,sin_ld);
+}
+
+void TestBatchArith::atan01() {
+	Interval x[N], y[N];
+	random_intervals(x,N,0,false);
+	batch_atan(x,y,N);
+	check_batch(x,y,N,atan,atan_ld);
+}
+
+void TestBatchArith::pow01() {
+	Interval x[N], y[N];
+	random_intervals(x,N,0,true);
+	batch_pow(x,0.37,y,N);
+	check_batch(x,y,N,pow_real,pow_ld);
+}
+
+void TestBatchArith::pow02() {
+	Interval x[N], y[N];
+	random_intervals(x,N,100,false);
+	batch_pow(x,3,y,N);
+	check_batch(x,y,N,pow_int,pow3_ld);
+}
+
+void TestBatchArith::special01() {
+	const int n=7;
+	Interval x[n] = { Interval::EMPTY_SET, Interval::ALL_REALS, Interval(-2,-1),
+			Interval(-1,2), Interval(0,10), Interval(800,900), Interval(1e10,1e10+1) };
+	Interval y[n];
+
+	batch_exp(x,y,n);
+	for (int i=0; i<n; i++) TEST_ASSERT(almost_eq(y[i],exp(x[i]),1e-10*(1+y[i].mag())));
+	TEST_ASSERT(y[1]==Interval::POS_REALS);
+
+	batch_log(x,y,n);
+	for (int i=0; i<n; i++) TEST_ASSERT(almost_eq(y[i],log(x[i]),1e-10));
+	TEST_ASSERT(y[2].is_empty());
+	TEST_ASSERT(y[3].lb()==NEG_INFINITY);
+
+	batch_sin(x,y,n);
+	TEST_ASSERT(y[0].is_empty());
+	TEST_ASSERT(y[1]==Interval(-1,1));
+	TEST_ASSERT(y[4]==Interval(-1,1));
+	for (int i=0; i<n; i++) TEST_ASSERT(almost_eq(y[i],sin(x[i]),1e-10));
+
+	batch_cos(x,y,n);
+	for (int i=0; i<n; i++) TEST_ASSERT(almost_eq(y[i],cos(x[i]),1e-10));
+
+	batch_atan(x,y,n);
+	for (int i=0; i<n; i++) TEST_ASSERT(almost_eq(y[i],atan(x[i]),1e-10));
+}
+
+void TestBatchArith::vector01() {
+	double _x[][2] = {{0,1},{-1,2},{3,4}};
+	IntervalVector x(3,_x);
+
+	IntervalVector y=batch_exp(x);
+	for (int i=0; i<3; i++) TEST_ASSERT(almost_eq(y[i],exp(x[i]),1e-10));
+
+	y=batch_atan(x);
+	for (int i=0; i<3; i++) TEST_ASSERT(almost_eq(y[i],atan(x[i]),1e-10));
+
+	x.set_empty();
+	TEST_ASSERT(batch_sin(x).is_empty());
+}
+
+void TestBatchArith::batch_eval01() {
+	Variable x,y;
+	Function f(x,y,exp(x)*sin(y)+log(x+1)/(1+sqr(y))-pow(y,3)+atan(cos(x-y)));
+	BatchEval be(f);
+	TEST_ASSERT(be.vectorized());
+
+	const int n=1000;
+	IntervalMatrix boxes(n,2);
+	for (int i=0; i<n; i++) {
+		double a=10*rnd(), b=20*rnd()-10;
+		boxes[i][0]=Interval(a,a+(i%2)*rnd());
+		boxes[i][1]=Interval(b,b+(i%2)*rnd());
+	}
+	IntervalVector res=be.eval(boxes);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(almost_eq(res[i],f.eval(boxes[i]),1e-8*(1+res[i].mag())));
+}
+
+void TestBatchArith::batch_eval02() {
+	// tan is not processed by blocks
+	Variable x;
+	Function f(x,tan(x)+exp(x));
+	BatchEval be(f);
+	TEST_ASSERT(!be.vectorized());
+
+	IntervalMatrix boxes(2,1);
+	boxes[0][0]=Interval(0,1);
+	boxes[1][0]=Interval(-1,0);
+	IntervalVector res=be.eval(boxes);
+	TEST_ASSERT(res[0]==f.eval(boxes[0]));
+	TEST_ASSERT(res[1]==f.eval(boxes[1]));
+}
+
+void TestBatchArith::batch_eval03() {
+	// vector arguments
+	Variable a(2),b(2);
+	Function f(a,b,sqrt(sqr(a[0]-b[0])+sqr(a[1]-b[1])));
+	BatchEval be(f);
+	TEST_ASSERT(be.vectorized());
+
+	const int n=100;
+	IntervalMatrix boxes(n,4);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<4; j++) {
+			double c=10*rnd();
+			boxes[i][j]=Interval(c,c+rnd());
+		}
+	IntervalVector res=be.eval(boxes);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(almost_eq(res[i],f.eval(boxes[i]),1e-10*(1+res[i].mag())));
+}
+
+void TestBatchArith::batch_proj01() {
+	Variable x,y;
+	Function f(x,y,exp(x)*y+sqr(x-y));
+	BatchEval be(f);
+	TEST_ASSERT(be.vectorized());
+
+	const int n=100;
+	Interval* dom[2] = { new Interval[n], new Interval[n] };
+	Interval** val=new Interval*[be.nb_nodes()];
+	for (int i=0; i<be.nb_nodes(); i++) val[i]=new Interval[n];
+
+	IntervalMatrix boxes(n,2);
+	for (int i=0; i<n; i++) {
+		dom[0][i]=boxes[i][0]=Interval(-1,1)+rnd();
+		dom[1][i]=boxes[i][1]=Interval(-2,2)+rnd();
+	}
+
+	be.forward(dom,val,n);
+	for (int i=0; i<n; i++) val[0][i] &= Interval(0,1);
+	TEST_ASSERT(be.backward(val,dom,n));
+
+	// same result as HC4Revise
+	for (int i=0; i<n; i++) {
+		IntervalVector box=boxes[i];
+		f.backward(Interval(0,1),box);
+		TEST_ASSERT(almost_eq(dom[0][i],box[0],1e-10));
+		TEST_ASSERT(almost_eq(dom[1][i],box[1],1e-10));
+	}
+
+	// no solution
+	be.forward(dom,val,n);
+	for (int i=0; i<n; i++) val[0][i] &= Interval(100,200);
+	TEST_ASSERT(!be.backward(val,dom,n));
+
+	for (int i=0; i<be.nb_nodes(); i++) delete[] val[i];
+	delete[] val;
+	delete[] dom[0];
+	delete[] dom[1];
+}
+
+void TestBatchArith::tube01() {
+	Variable t;
+	Function f(t,cos(t)+exp(-t));
+
+	double step=0.1;
+	Tube x(0,10,step,Interval(-100,100));
+	x[0]=Interval(1,1.1);
+	x.ctcFwd(f);
+
+	// same as the slice-by-slice Euler scheme
+	Interval xi(1,1.1);
+	for (int i=0; i<x.size()-1; i++) {
+		IntervalVector ti(1,Interval(i*step,(i+1)*step));
+		xi=(xi+f.eval(ti)*step) & Interval(-100,100);
+		TEST_ASSERT(almost_eq(x[i+1],xi,1e-9));
+	}
+
+	Tube y=cos(Tube(0,10,step,Interval(-100,100)));
+	TEST_ASSERT(y.size()==x.size());
+	for (int i=0; i<y.size(); i++)
+		TEST_ASSERT(y[i]==Interval(-1,1));
+}
+
+} // namespace ibex
@@ -0,0 +1,68 @@
+/* ============================================================================
+ * I B E X - Batch Arithmetic Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_BATCH_ARITH_H__
+#define __TEST_BATCH_ARITH_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+#include "ibex_BatchArith.h"
+
+namespace ibex {
+
+class TestBatchArith : public TestIbex {
+
+public:
+	TestBatchArith() {
+		TEST_ADD(TestBatchArith::exp01);
+		TEST_ADD(TestBatchArith::log01);
+		TEST_ADD(TestBatchArith::cos01);
+		TEST_ADD(TestBatchArith::sin01);
+		TEST_ADD(TestBatchArith::atan01);
+		TEST_ADD(TestBatchArith::pow01);
+		TEST_ADD(TestBatchArith::pow02);
+		TEST_ADD(TestBatchArith::special01);
+		TEST_ADD(TestBatchArith::vector01);
+		TEST_ADD(TestBatchArith::batch_eval01);
+		TEST_ADD(TestBatchArith::batch_eval02);
+		TEST_ADD(TestBatchArith::batch_eval03);
+		TEST_ADD(TestBatchArith::batch_proj01);
+		TEST_ADD(TestBatchArith::tube01);
+	}
+
+	void exp01();
+	void log01();
+	void cos01();
+	void sin01();
+	void atan01();
+	void pow01();
+	void pow02();
+	void special01();
+	void vector01();
+	void batch_eval01();
+	void batch_eval02();
+	void batch_eval03();
+	void batch_proj01();
+	void tube01();
+
+private:
+	/* random intervals with magnitude in [10^-6,10^6] (or [0,scale] if scale>0) */
+	void random_intervals(Interval* x, int n, double scale, bool positive);
+
+	/* check the batch result y against the scalar result of the
+	 * underlying library and a long double evaluation at some points of x. */
+	void check_batch(const Interval* x, const Interval* y, int n,
+			Interval (*f)(const Interval&), long double (*g)(long double));
+};
+
+} // namespace ibex
+
+#endif // __TEST_BATCH_ARITH_H__
@@ -0,0 +1,302 @@
+/* ============================================================================
+ * I B E X - Compensated Arithmetic Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCompensatedArith.h"
+#include "ibex_Function.h"
+#include "ibex_Expr.h"
+#include "ibex_IntervalMatrix.h"
+#include "ibex_EmptyBoxException.h"
+
+using namespace std;
+
+namespace {
+
+/*
+ * Dot products of points with inexact products. The exact value
+ * lies strictly between the two consecutive floats e[k][0] and e[k][1].
+ */
+const int nb_dot_cases=4;
+const int dot_n[nb_dot_cases] = { 3, 4, 5, 6 };
+const double dot_x[nb_dot_cases][6] = {
+	{ 0.1, 0.2, 0.3 },
+	{ -5.241, 0.885, -2.601, 2.078 },
+	{ -4.813, -5.313, 9.913, -0.595, 6.729 },
+	{ 0.464, 4.825, 3.428, -8.719, 5.165, 1.822 }
+};
+const double dot_y[nb_dot_cases][6] = {
+	{ 0.7, -0.3, 0.9 },
+	{ 2.514, -8.689, -9.737, 6.749 },
+	{ -0.473, 2.781, -6.988, 2.697, 7.361 },
+	{ -3.975, -9.38, 7.311, -0.545, 4.376, 7.576 }
+};
+const double dot_e[nb_dot_cases][2] = {
+	{ 0.27999999999999997, 0.28000000000000003 },
+	{ 18.484719999999999, 18.484720000000003 },
+	{ -33.843494000000014, -33.843494000000007 },
+	{ 19.116574999999994, 19.116574999999997 }
+};
+
+// deterministic pseudo-random integer in [-m,m]
+unsigned long seed=1;
+int rnd(int m) {
+	seed = (seed*1103515245UL+12345UL) % 2147483648UL;
+	return (int) (seed % (2*m+1)) - m;
+}
+
+}
+
+namespace ibex {
+
+void TestCompensatedArith::sum01() {
+	// 1 + 1000 times 2^-60
+	const int n=1001;
+	Interval x[n];
+	x[0]=1;
+	for (int i=1; i<n; i++) x[i]=::ldexp(1.0,-60);
+
+	Interval naive(0);
+	for (int i=0; i<n; i++) naive+=x[i];
+
+	// the exact value is 1+e where e=1000*2^-60
+	double e=1000*::ldexp(1.0,-60);
+	Interval s=sum(x,n);
+	TEST_ASSERT(s.lb()-1<=e && s.ub()-1>=e);
+	TEST_ASSERT(s.diam()<=naive.diam());
+	TEST_ASSERT(s.diam()<=4*::ldexp(1.0,-52));
+}
+
+void TestCompensatedArith::sum02() {
+	// cancellation: the exact sum is 1
+	const int n=5;
+	Interval x[n] = { 1e16, 1, -1e16, 3e-20, -3e-20 };
+	Interval s=sum(x,n);
+	TEST_ASSERT(s.contains(1));
+	TEST_ASSERT(s.diam()<1e-13);
+
+	Interval naive(0);
+	for (int i=0; i<n; i++) naive+=x[i];
+	TEST_ASSERT(naive.diam()>1);
+}
+
+void TestCompensatedArith::sum03() {
+	Interval x[4] = { Interval(0,1), Interval(NEG_INFINITY,0), Interval(2,3), Interval(1,POS_INFINITY) };
+	check(sum(x,4),Interval::ALL_REALS);
+
+	x[3]=Interval(1,2);
+	check(sum(x,4),Interval(NEG_INFINITY,6));
+
+	x[1]=Interval::EMPTY_SET;
+	TEST_ASSERT(sum(x,4).is_empty());
+
+	TEST_ASSERT(sum(x,0)==Interval::ZERO);
+}
+
+void TestCompensatedArith::sum04() {
+	// the exact sum lies strictly between two consecutive floats
+	Interval x[4] = { 0.1, 0.2, 0.3, 1e-17 };
+	Interval s=sum(x,4);
+	TEST_ASSERT(s.lb()<=0.59999999999999998);
+	TEST_ASSERT(s.ub()>=0.60000000000000009);
+}
+
+void TestCompensatedArith::dot01() {
+	// the exact value is 1
+	Interval x[3] = { 1e10, 1, -1e10 };
+	Interval y[3] = { 1e10, 1,  1e10 };
+	Interval d=dot(x,y,3);
+	TEST_ASSERT(d.contains(1));
+	TEST_ASSERT(d.diam()<1e-13);
+
+	double v[3] = { 1e10, 1, -1e10 };
+	d=dot(v,y,3);
+	TEST_ASSERT(d.contains(1));
+	TEST_ASSERT(d.diam()<1e-13);
+}
+
+void TestCompensatedArith::dot02() {
+	// small integer bounds: the naive evaluation is exact
+	// (all sign configurations are tested)
+	const int n=50;
+	Interval x[n], y[n];
+	for (int k=0; k<100; k++) {
+		for (int i=0; i<n; i++) {
+			int a=rnd(1000), b=rnd(1000), c=rnd(1000), d=rnd(1000);
+			x[i]=Interval(a<b?a:b, a<b?b:a);
+			y[i]=Interval(c<d?c:d, c<d?d:c);
+		}
+		Interval naive(0);
+		for (int i=0; i<n; i++) naive+=x[i]*y[i];
+		check(dot(x,y,n),naive);
+	}
+}
+
+void TestCompensatedArith::dot03() {
+	IntervalVector x(3,Interval(1,2));
+	IntervalVector y(3,Interval(-1,1));
+	check(x*y,Interval(-6,6));
+
+	Vector v(3);
+	v[0]=1e10; v[1]=1; v[2]=-1e10;
+	IntervalVector w(3);
+	w[0]=1e10; w[1]=1; w[2]=1e10;
+	TEST_ASSERT((v*w).contains(1));
+	TEST_ASSERT((v*w).diam()<1e-13);
+	TEST_ASSERT((w*v).contains(1));
+
+	y.set_empty();
+	TEST_ASSERT((x*y).is_empty());
+}
+
+void TestCompensatedArith::dot04() {
+	for (int k=0; k<nb_dot_cases; k++) {
+		int n=dot_n[k];
+		Interval x[6], y[6];
+		for (int i=0; i<n; i++) {
+			x[i]=dot_x[k][i];
+			y[i]=dot_y[k][i];
+		}
+		Interval d=dot(x,y,n);
+		TEST_ASSERT(d.lb()<=dot_e[k][0] && d.ub()>=dot_e[k][1]);
+
+		d=dot(dot_x[k],y,n);
+		TEST_ASSERT(d.lb()<=dot_e[k][0] && d.ub()>=dot_e[k][1]);
+	}
+}
+
+void TestCompensatedArith::proj_sum01() {
+	const int n=4;
+	Interval x[n];
+
+	for (int i=0; i<n; i++) x[i]=Interval(0,1);
+	TEST_ASSERT(proj_sum(Interval(0,1),x,n));
+	for (int i=0; i<n; i++) check(x[i],Interval(0,1));
+
+	TEST_ASSERT(proj_sum(Interval(3.5,4),x,n));
+	for (int i=0; i<n; i++) check(x[i],Interval(0.5,1));
+
+	TEST_ASSERT(!proj_sum(Interval(5,6),x,n));
+	for (int i=0; i<n; i++) TEST_ASSERT(x[i].is_empty());
+}
+
+void TestCompensatedArith::proj_sum02() {
+	Interval x[3] = { Interval::ALL_REALS, Interval(0,1), Interval(0,1) };
+	TEST_ASSERT(proj_sum(Interval::ZERO,x,3));
+	check(x[0],Interval(-2,0));
+	check(x[1],Interval(0,1));
+	check(x[2],Interval(0,1));
+
+	// two infinite bounds: no contraction
+	Interval z[3] = { Interval::ALL_REALS, Interval::ALL_REALS, Interval(0,1) };
+	TEST_ASSERT(proj_sum(Interval::ZERO,z,3));
+	check(z[0],Interval::ALL_REALS);
+	check(z[1],Interval::ALL_REALS);
+	check(z[2],Interval(0,1));
+}
+
+void TestCompensatedArith::proj_dot01() {
+	IntervalVector x(3,Interval(1,2));
+	IntervalVector y(3,Interval::ONE);
+	TEST_ASSERT(proj_mul(Interval(6,6),x,y));
+	check(x,IntervalVector(3,Interval(2,2)));
+	check(y,IntervalVector(3,Interval::ONE));
+
+	IntervalVector x2(3,Interval(1,2));
+	IntervalVector y2(3,Interval(-1,1));
+	TEST_ASSERT(proj_mul(Interval(-6,6),x2,y2));
+	check(x2,IntervalVector(3,Interval(1,2)));
+
+	TEST_ASSERT(!proj_mul(Interval(7,8),x2,y2));
+	TEST_ASSERT(x2.is_empty());
+	TEST_ASSERT(y2.is_empty());
+}
+
+// proj_dot must not lose a solution in the upward rounding
+// mode (assumed by Gaol and Bias)
+void TestCompensatedArith::proj_dot02() {
+	const int n=20;
+	double p[n], q[n];
+	Interval x[n], y[n];
+	int mode=fegetround();
+	fpu_round_up();
+
+	int nb_lost=0;
+	for (int k=0; k<200; k++) {
+		for (int i=0; i<n; i++) {
+			p[i]=rnd(1000)/7.0;
+			q[i]=rnd(1000)/3.0;
+			x[i]=p[i];
+			// some terms are not degenerated
+			y[i]= i%4==0 ? Interval(q[i]-1,q[i]+1) : Interval(q[i]);
+		}
+		if (k%10==0) y[1]=Interval::ALL_REALS;
+
+		// enclosure of the exact value of p[0]*q[0]+...+p[n-1]*q[n-1]
+		Interval qi[n];
+		for (int i=0; i<n; i++) qi[i]=q[i];
+		Interval z=dot(p,qi,n);
+
+		if (!proj_dot(z,x,y,n)) nb_lost++;
+		else
+			for (int i=0; i<n; i++)
+				if (!x[i].contains(p[i]) || !y[i].contains(q[i])) nb_lost++;
+	}
+	fesetround(mode);
+	TEST_ASSERT(nb_lost==0);
+}
+
+// the solution is not lost when z is a sharp enclosure of the exact value
+void TestCompensatedArith::proj_dot03() {
+	for (int k=0; k<nb_dot_cases; k++) {
+		int n=dot_n[k];
+		Interval x[6], y[6];
+		for (int i=0; i<n; i++) {
+			x[i]=dot_x[k][i];
+			y[i]= i==0 ? Interval(dot_y[k][i]-1,dot_y[k][i]+1) : Interval(dot_y[k][i]);
+		}
+		TEST_ASSERT(proj_dot(Interval(dot_e[k][0],dot_e[k][1]),x,y,n));
+		for (int i=0; i<n; i++) {
+			TEST_ASSERT(x[i].contains(dot_x[k][i]));
+			TEST_ASSERT(y[i].contains(dot_y[k][i]));
+		}
+	}
+}
+
+void TestCompensatedArith::expr_sum01() {
+	Variable x,y,z;
+	Function f(x,y,z,sum(Array<const ExprNode>(x,sqr(y),-z)));
+
+	double _box[][2] = {{1,2},{-1,3},{0,1}};
+	IntervalVector box(3,_box);
+	check(f.eval(box),Interval(0,11));
+
+	// gradient
+	double _g[][2] = {{1,1},{-2,6},{-1,-1}};
+	check(f.gradient(box),IntervalVector(3,_g));
+
+	// symbolic differentiation
+	const Function& df=f.diff();
+	IntervalVector dbox(3);
+	for (int i=0; i<3; i++) dbox[i]=df[i].eval(box);
+	check(dbox,IntervalVector(3,_g));
+}
+
+void TestCompensatedArith::expr_sum02() {
+	Variable x,y,z;
+	Function f(x,y,z,sum(Array<const ExprNode>(x,y,z)));
+
+	IntervalVector box(3,Interval(0,1));
+	f.backward(Interval(2.5,3),box);
+	check(box,IntervalVector(3,Interval(0.5,1)));
+
+	box=IntervalVector(3,Interval(0,1));
+	TEST_THROWS(f.backward(Interval(4,5),box),EmptyBoxException);
+}
+
+} // namespace ibex
@@ -0,0 +1,61 @@
+/* ============================================================================
+ * I B E X - Compensated Arithmetic Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_COMPENSATED_ARITH_H__
+#define __TEST_COMPENSATED_ARITH_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+#include "ibex_CompensatedArith.h"
+
+namespace ibex {
+
+class TestCompensatedArith : public TestIbex {
+
+public:
+	TestCompensatedArith() {
+		TEST_ADD(TestCompensatedArith::sum01);
+		TEST_ADD(TestCompensatedArith::sum02);
+		TEST_ADD(TestCompensatedArith::sum03);
+		TEST_ADD(TestCompensatedArith::sum04);
+		TEST_ADD(TestCompensatedArith::dot01);
+		TEST_ADD(TestCompensatedArith::dot02);
+		TEST_ADD(TestCompensatedArith::dot03);
+		TEST_ADD(TestCompensatedArith::dot04);
+		TEST_ADD(TestCompensatedArith::proj_sum01);
+		TEST_ADD(TestCompensatedArith::proj_sum02);
+		TEST_ADD(TestCompensatedArith::proj_dot01);
+		TEST_ADD(TestCompensatedArith::proj_dot02);
+		TEST_ADD(TestCompensatedArith::proj_dot03);
+		TEST_ADD(TestCompensatedArith::expr_sum01);
+		TEST_ADD(TestCompensatedArith::expr_sum02);
+	}
+
+	void sum01();
+	void sum02();
+	void sum03();
+	void sum04();
+	void dot01();
+	void dot02();
+	void dot03();
+	void dot04();
+	void proj_sum01();
+	void proj_sum02();
+	void proj_dot01();
+	void proj_dot02();
+	void proj_dot03();
+	void expr_sum01();
+	void expr_sum02();
+};
+
+} // namespace ibex
+
+#endif // __TEST_COMPENSATED_ARITH_H__
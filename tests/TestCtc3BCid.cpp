@@ -0,0 +1,164 @@
+/* ============================================================================
+ * I B E X - 3BCID Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtc3BCid.h"
+#include "ibex_Ctc3BCid.h"
+#include "ibex_CtcAcid.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// x^2+y^2=1, y=x^2: the solutions are (+/-0.786..., 0.618...)
+System* circle_parabola() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(y=sqr(x));
+	return new System(fac);
+}
+
+// Contract the box with a sequential and a parallel (four workers) 3BCID.
+void compare(int s3b, int scid, const IntervalVector& box, IntervalVector& seq, IntervalVector& par) {
+	System* sys=circle_parabola();
+	CtcHC4 hc4(sys->ctrs,0.1);
+	Ctc3BCid c(hc4,s3b,scid);
+	seq=box;
+	c.contract(seq);
+
+	System* copies[4];
+	CtcHC4* workers[4];
+	for (int i=0; i<4; i++) {
+		copies[i]=new System(*sys);  // the workers do not share any function
+		workers[i]=new CtcHC4(copies[i]->ctrs,0.1);
+	}
+
+	Ctc3BCid cp(hc4,s3b,scid);
+	cp.set_workers(Array<Ctc>(*workers[0],*workers[1],*workers[2],*workers[3]));
+	par=box;
+	cp.contract(par);
+
+	for (int i=0; i<4; i++) {
+		delete workers[i];
+		delete copies[i];
+	}
+	delete sys;
+}
+
+bool contains_solutions(const IntervalVector& box) {
+	double x=::sqrt((::sqrt(5.0)-1)/2);
+	double y=(::sqrt(5.0)-1)/2;
+	return box[0].contains(x) && box[0].contains(-x) && box[1].contains(y);
+}
+
+}
+
+void TestCtc3BCid::parallel_slices01() {
+	IntervalVector box(2,Interval(-2,2));
+	IntervalVector seq(2), par(2);
+
+	compare(10,2,box,seq,par);  // linear shaving (10 slices)
+
+	TEST_ASSERT(contains_solutions(par));
+	TEST_ASSERT(par.is_subset(seq));
+	TEST_ASSERT(par.is_strict_subset(box));
+}
+
+void TestCtc3BCid::parallel_dicho01() {
+	IntervalVector box(2,Interval(-2,2));
+	IntervalVector seq(2), par(2);
+
+	compare(40,1,box,seq,par);  // dichotomic shaving (40 slices)
+
+	TEST_ASSERT(contains_solutions(par));
+	TEST_ASSERT(par.is_strict_subset(box));
+	TEST_ASSERT(almost_eq(par,seq,1e-03));
+}
+
+void TestCtc3BCid::parallel_acid01() {
+	System* sys=circle_parabola();
+	System sys2(*sys);
+	System sys3(*sys);
+
+	CtcHC4 hc4(sys->ctrs,0.1);
+	CtcHC4 w1(sys2.ctrs,0.1);
+	CtcHC4 w2(sys3.ctrs,0.1);
+
+	CtcAcid acid(*sys,hc4);
+	acid.set_workers(Array<Ctc>(w1,w2));
+
+	IntervalVector box(2,Interval(-2,2));
+	acid.contract(box);
+
+	TEST_ASSERT(contains_solutions(box));
+	TEST_ASSERT(box.is_strict_subset(IntervalVector(2,Interval(-2,2))));
+
+	delete sys;
+}
+
+// the slices contracted in parallel are counted
+void TestCtc3BCid::parallel_stats01() {
+	System* sys=circle_parabola();
+	CtcHC4 hc4(sys->ctrs,0.1);
+	System sys1(*sys), sys2(*sys);
+	CtcHC4 w1(sys1.ctrs,0.1), w2(sys2.ctrs,0.1);
+
+	Ctc3BCid c(hc4,10,0);
+	c.set_workers(Array<Ctc>(w1,w2));
+
+	IntervalVector box(2,Interval(-2,2));
+	c.contract(box);
+
+	TEST_ASSERT(contains_solutions(box));
+	TEST_ASSERT(c.nb_slices>=10);
+	TEST_ASSERT(c.nb_refuted>0);
+	TEST_ASSERT(c.nb_refuted<c.nb_slices);
+
+	delete sys;
+}
+
+// The sub-contractor only modifies y and z (its output variables):
+// the refuted slices must not alter x (the first variable).
+void TestCtc3BCid::restore_test(int s3b) {
+	Variable x,y,z;
+	Function f(x,y,z,sqr(y)+sqr(z)-1);
+	CtcFwdBwd c(f);
+	TEST_ASSERT(!(*c.output)[0]);
+
+	Ctc3BCid c3b(c,s3b,1);
+	IntervalVector box(3);
+	box[0]=Interval(5,6);
+	box[1]=Interval(0.5,0.6);
+	box[2]=Interval(-10,10);   // z is shaved first
+	c3b.contract(box);
+
+	TEST_ASSERT(box[0]==Interval(5,6));
+	TEST_ASSERT(box[2].is_strict_subset(Interval(-1,1)));
+	TEST_ASSERT(box[2].contains(::sqrt(1-0.36)) && box[2].contains(-::sqrt(1-0.36)));
+	TEST_ASSERT(c3b.nb_slices>0);
+	TEST_ASSERT(c3b.nb_refuted>0);
+}
+
+void TestCtc3BCid::restore01() {
+	restore_test(10);  // linear shaving
+}
+
+void TestCtc3BCid::restore02() {
+	restore_test(40);  // dichotomic shaving
+}
+
+} // end namespace ibex
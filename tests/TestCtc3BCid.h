@@ -0,0 +1,44 @@
+/* ============================================================================
+ * I B E X - 3BCID Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_3BCID_H__
+#define __TEST_CTC_3BCID_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtc3BCid : public TestIbex {
+
+public:
+	TestCtc3BCid() {
+		TEST_ADD(TestCtc3BCid::parallel_slices01);
+		TEST_ADD(TestCtc3BCid::parallel_dicho01);
+		TEST_ADD(TestCtc3BCid::parallel_acid01);
+		TEST_ADD(TestCtc3BCid::parallel_stats01);
+		TEST_ADD(TestCtc3BCid::restore01);
+		TEST_ADD(TestCtc3BCid::restore02);
+	}
+
+	void parallel_slices01();
+	void parallel_dicho01();
+	void parallel_acid01();
+	void parallel_stats01();
+	void restore01();
+	void restore02();
+
+protected:
+	void restore_test(int s3b);
+};
+
+} // end namespace
+
+#endif // __TEST_CTC_3BCID_H__
@@ -0,0 +1,117 @@
+/* ============================================================================
+ * I B E X - Adaptive composition Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcAdaptiveCompo.h"
+#include "ibex_CtcAdaptiveCompo.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcIdentity.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_Solver.h"
+#include "ibex_DefaultSolver.h"
+#include "ibex_CellStack.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+// a useless contractor is throttled, a useful one is not
+void TestCtcAdaptiveCompo::throttle01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)-1);
+	CtcFwdBwd c(f);
+	CtcIdentity id(2);
+
+	CtcAdaptiveCompo compo(c,id);
+	compo.tuning_calls=10;
+	compo.tuning_period=20;
+	compo.max_period=8;
+
+	for (int k=0; k<40; k++) {
+		IntervalVector box(2,Interval(-2,2));
+		compo.contract(box);
+		TEST_ASSERT(almost_eq(box,IntervalVector(2,Interval(-1,1)),1e-10));
+	}
+
+	TEST_ASSERT(compo.nb_tunings==2);
+	TEST_ASSERT(compo.period[0]==1);
+	TEST_ASSERT(compo.period[1]==8);
+	TEST_ASSERT(compo.nb_calls[0]==40);
+	TEST_ASSERT(compo.nb_skips[0]==0);
+	// 20 calls during the tuning phases + calls 16 and 32 (multiples of 8 in the running phases)
+	TEST_ASSERT(compo.nb_calls[1]==22);
+	TEST_ASSERT(compo.nb_skips[1]==18);
+	TEST_ASSERT(compo.nb_useful[1]==0);
+	TEST_ASSERT(compo.nb_useful[0]==20);
+}
+
+// a contractor with a minimal depth is skipped near the root of the search tree
+void TestCtcAdaptiveCompo::depth01() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(x-y=0);
+	System sys(fac);
+
+	CtcHC4 hc4(sys.ctrs);
+	CtcIdentity id(2);
+	CtcAdaptiveCompo compo(hc4,id);
+	compo.adaptive[1]=false;
+	compo.min_depth[1]=3;
+
+	RoundRobin bsc(1e-3);
+	CellStack buff;
+	Solver s(compo,bsc,buff,1e-3);
+	vector<IntervalVector> sols=s.solve(IntervalVector(2,Interval(-2,2)));
+
+	CtcHC4 hc4_2(sys.ctrs);
+	RoundRobin bsc2(1e-3);
+	CellStack buff2;
+	Solver s2(hc4_2,bsc2,buff2,1e-3);
+	vector<IntervalVector> sols2=s2.solve(IntervalVector(2,Interval(-2,2)));
+
+	TEST_ASSERT(sols.size()==sols2.size());
+	TEST_ASSERT(compo.nb_skips[1]>0);
+	TEST_ASSERT(compo.nb_skips[1]<compo.nb_compo_calls);
+	TEST_ASSERT(compo.nb_calls[0]==compo.nb_compo_calls);
+}
+
+// the default solver with adaptive scheduling finds the same solutions
+void TestCtcAdaptiveCompo::default_solver01() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(sqr(x)-y=0);
+	System sys(fac);
+
+	IntervalVector box(2,Interval(-2,2));
+
+	DefaultSolver s1(sys,1e-7);
+	vector<IntervalVector> sols1=s1.solve(box);
+
+	DefaultSolver s2(sys,1e-7,DefaultSolver::NEWTON,true);
+	vector<IntervalVector> sols2=s2.solve(box);
+
+	TEST_ASSERT(sols1.size()==2);
+	TEST_ASSERT(sols2.size()==sols1.size());
+	for (unsigned int i=0; i<sols2.size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; j<sols1.size(); j++)
+			if (!(sols2[i] & sols1[j]).is_empty()) found=true;
+		TEST_ASSERT(found);
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,35 @@
+/* ============================================================================
+ * I B E X - Adaptive composition Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_ADAPTIVE_COMPO_H__
+#define __TEST_CTC_ADAPTIVE_COMPO_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcAdaptiveCompo : public TestIbex {
+
+public:
+	TestCtcAdaptiveCompo() {
+		TEST_ADD(TestCtcAdaptiveCompo::throttle01);
+		TEST_ADD(TestCtcAdaptiveCompo::depth01);
+		TEST_ADD(TestCtcAdaptiveCompo::default_solver01);
+	}
+
+	void throttle01();
+	void depth01();
+	void default_solver01();
+};
+
+} // end namespace
+
+#endif // __TEST_CTC_ADAPTIVE_COMPO_H__
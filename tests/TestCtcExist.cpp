@@ -0,0 +1,169 @@
+/* ============================================================================
+ * I B E X - CtcExist/CtcForAll/CtcUnion Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcExist.h"
+#include "ibex_CtcExist.h"
+#include "ibex_CtcForAll.h"
+#include "ibex_CtcUnion.h"
+#include "ibex_CtcFwdBwd.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// the disk x^2+y^2<=1 (each call builds a new function)
+Function* disk() {
+	Variable x,y;
+	return new Function(x,y,sqr(x)+sqr(y)-1);
+}
+
+// Contract x with a sequential and a parallel (four workers) quantifier.
+template<class C>
+void compare(double prec, const IntervalVector& y, IntervalVector& seq, IntervalVector& par) {
+	Function* f=disk();
+	C c(*f,LEQ,prec,y);
+	try {
+		c.contract(seq);
+	} catch (EmptyBoxException&) { }
+
+	Function* fw[4];
+	CtcFwdBwd* workers[4];
+	for (int i=0; i<4; i++) {
+		fw[i]=disk(); // the workers do not share any function
+		workers[i]=new CtcFwdBwd(*fw[i],LEQ);
+	}
+
+	C cp(*f,LEQ,prec,y);
+	cp.set_workers(Array<Ctc>(*workers[0],*workers[1],*workers[2],*workers[3]));
+	try {
+		cp.contract(par);
+	} catch (EmptyBoxException&) { }
+
+	for (int i=0; i<4; i++) {
+		delete workers[i];
+		delete fw[i];
+	}
+	delete f;
+}
+
+}
+
+void TestCtcExist::exist01() {
+	IntervalVector y(1,Interval(-0.5,0.5));
+	IntervalVector seq(1,Interval(-2,2)), par(1,Interval(-2,2));
+
+	compare<CtcExist>(0.01,y,seq,par);
+
+	TEST_ASSERT(seq.is_superset(IntervalVector(1,Interval(-1,1))));
+	TEST_ASSERT(seq.is_subset(IntervalVector(1,Interval(-1.01,1.01))));
+	TEST_ASSERT(par.is_superset(IntervalVector(1,Interval(-1,1))));
+	TEST_ASSERT(par.is_subset(IntervalVector(1,Interval(-1.01,1.01))));
+}
+
+// no solution
+void TestCtcExist::exist02() {
+	IntervalVector y(1,Interval(1.5,2));
+	IntervalVector seq(1,Interval(-2,2)), par(1,Interval(-2,2));
+
+	compare<CtcExist>(0.01,y,seq,par);
+
+	TEST_ASSERT(seq.is_empty());
+	TEST_ASSERT(par.is_empty());
+}
+
+// early cut-off: the box is covered by the midpoint of the parameters
+void TestCtcExist::exist03() {
+	IntervalVector y(1,Interval(-0.5,0.5));
+	IntervalVector seq(1,Interval(-0.5,0.5)), par(1,Interval(-0.5,0.5));
+
+	compare<CtcExist>(1e-10,y,seq,par);
+
+	TEST_ASSERT(seq==IntervalVector(1,Interval(-0.5,0.5)));
+	TEST_ASSERT(par==IntervalVector(1,Interval(-0.5,0.5)));
+}
+
+void TestCtcExist::forall01() {
+	IntervalVector y(1,Interval(-0.5,0.5));
+	IntervalVector seq(1,Interval(-2,2)), par(1,Interval(-2,2));
+
+	compare<CtcForAll>(0.01,y,seq,par);
+
+	double r=::sqrt(0.75);
+	TEST_ASSERT(seq.is_superset(IntervalVector(1,Interval(-r,r))));
+	TEST_ASSERT(seq.is_subset(IntervalVector(1,Interval(-0.9,0.9))));
+	TEST_ASSERT(par.is_superset(IntervalVector(1,Interval(-r,r))));
+	TEST_ASSERT(par.is_subset(IntervalVector(1,Interval(-0.9,0.9))));
+}
+
+// no solution
+void TestCtcExist::forall02() {
+	IntervalVector y(1,Interval(0.5,1.5));
+	IntervalVector seq(1,Interval(-2,2)), par(1,Interval(-2,2));
+
+	compare<CtcForAll>(0.01,y,seq,par);
+
+	TEST_ASSERT(seq.is_empty());
+	TEST_ASSERT(par.is_empty());
+}
+
+void TestCtcExist::union01() {
+	Variable x1,y1,x2,y2,x3,y3;
+	Function f1(x1,y1,sqr(x1-2)+sqr(y1)-1);
+	Function f2(x2,y2,sqr(x2+2)+sqr(y2)-1);
+	Function f3(x3,y3,sqr(x3)+sqr(y3-3)-1);
+	CtcFwdBwd c1(f1,LEQ), c2(f2,LEQ), c3(f3,LEQ);
+
+	CtcUnion u(c1,c2,c3);
+	IntervalVector seq(2,Interval(-5,1.5));
+	u.contract(seq);
+
+	u.parallel=true;
+	IntervalVector par(2,Interval(-5,1.5));
+	u.contract(par);
+
+	TEST_ASSERT(seq==par);
+	TEST_ASSERT(almost_eq(par[0],Interval(-3,1.5),1e-10));
+	TEST_ASSERT(almost_eq(par[1],Interval(-1,1),1e-10));
+
+	IntervalVector box(2,Interval(5,6));
+	TEST_THROWS(u.contract(box),EmptyBoxException);
+}
+
+// the sub-contractors do not modify z
+void TestCtcExist::union02() {
+	Variable x,y,z;
+	Function f1(x,y,z,sqr(x-2)+sqr(y)-1);
+	Function f2(x,y,z,sqr(x+2)+sqr(y)-1);
+	CtcFwdBwd c1(f1,LEQ), c2(f2,LEQ);
+
+	CtcUnion u(c1,c2);
+	double _box[][2] = { {-5,1.5}, {-5,1.5}, {7,8} };
+	IntervalVector box(3,_box);
+	u.contract(box);
+
+	TEST_ASSERT(almost_eq(box[0],Interval(-3,1.5),1e-10));
+	TEST_ASSERT(almost_eq(box[1],Interval(-1,1),1e-10));
+	TEST_ASSERT(box[2]==Interval(7,8));
+
+	// only c2 refutes the box
+	double _box2[][2] = { {1.5,5}, {-5,5}, {7,8} };
+	IntervalVector box2(3,_box2);
+	u.contract(box2);
+	TEST_ASSERT(almost_eq(box2[0],Interval(1.5,3),1e-10));
+	TEST_ASSERT(box2[2]==Interval(7,8));
+
+	double _box3[][2] = { {-0.5,0.5}, {-5,5}, {7,8} };
+	IntervalVector box3(3,_box3);
+	TEST_THROWS(u.contract(box3),EmptyBoxException);
+}
+
+} // end namespace ibex
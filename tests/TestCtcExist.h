@@ -0,0 +1,43 @@
+/* ============================================================================
+ * I B E X - CtcExist/CtcForAll/CtcUnion Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_EXIST_H__
+#define __TEST_CTC_EXIST_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcExist : public TestIbex {
+
+public:
+	TestCtcExist() {
+		TEST_ADD(TestCtcExist::exist01);
+		TEST_ADD(TestCtcExist::exist02);
+		TEST_ADD(TestCtcExist::exist03);
+		TEST_ADD(TestCtcExist::forall01);
+		TEST_ADD(TestCtcExist::forall02);
+		TEST_ADD(TestCtcExist::union01);
+		TEST_ADD(TestCtcExist::union02);
+	}
+
+	void exist01();
+	void exist02();
+	void exist03();
+	void forall01();
+	void forall02();
+	void union01();
+	void union02();
+};
+
+} // end namespace
+
+#endif // __TEST_CTC_EXIST_H__
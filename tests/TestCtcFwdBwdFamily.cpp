@@ -0,0 +1,145 @@
+/* ============================================================================
+ * I B E X - CtcFwdBwdFamily Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcFwdBwdFamily.h"
+#include "ibex_CtcFwdBwdFamily.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFixPoint.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const int NB_POS=20;     // number of positions
+const int NB_BEACONS=4;  // number of beacons
+
+double beacons[NB_BEACONS][2] = { {0,0}, {10,0}, {10,10}, {0,10} };
+
+// distance between the t-th position and the b-th beacon
+Interval distance(int t, int b) {
+	double x=1+0.4*t, y=2+0.3*t;
+	double d=::sqrt((x-beacons[b][0])*(x-beacons[b][0])+(y-beacons[b][1])*(y-beacons[b][1]));
+	return d+Interval(-0.01,0.01);
+}
+
+// family of the distance constraints
+void build_family(CtcFwdBwdFamily& family) {
+	int var[4];
+	IntervalVector value(4);
+	for (int t=0; t<NB_POS; t++)
+		for (int b=0; b<NB_BEACONS; b++) {
+			var[0]=2*t; var[1]=2*t+1; var[2]=var[3]=-1;
+			value[2]=beacons[b][0]; value[3]=beacons[b][1];
+			family.add(var,value,distance(t,b));
+		}
+}
+
+}
+
+// same fixpoint as the composition of CtcFwdBwd
+void TestCtcFwdBwdFamily::slam01() {
+	Variable a(2), b(2);
+	Function dist(a,b,sqrt(sqr(a[0]-b[0])+sqr(a[1]-b[1])));
+
+	CtcFwdBwdFamily family(dist,2*NB_POS);
+	build_family(family);
+	TEST_ASSERT(family.nb_instances()==NB_POS*NB_BEACONS);
+
+	Variable x(NB_POS,2);
+	Array<Ctc> ctc(NB_POS*NB_BEACONS);
+	Array<NumConstraint> ctrs(NB_POS*NB_BEACONS);
+	for (int t=0; t<NB_POS; t++)
+		for (int b=0; b<NB_BEACONS; b++) {
+			Function* f=new Function(x,sqrt(sqr(x[t][0]-beacons[b][0])+sqr(x[t][1]-beacons[b][1]))-distance(t,b));
+			ctrs.set_ref(t*NB_BEACONS+b,*new NumConstraint(*f,EQ,true));
+			ctc.set_ref(t*NB_BEACONS+b,*new CtcFwdBwd(ctrs[t*NB_BEACONS+b]));
+		}
+	CtcCompo compo(ctc);
+
+	CtcFixPoint fix1(family,0);
+	CtcFixPoint fix2(compo,0);
+
+	IntervalVector box1(2*NB_POS,Interval(0,10));
+	IntervalVector box2(2*NB_POS,Interval(0,10));
+	fix1.contract(box1);
+	fix2.contract(box2);
+
+	TEST_ASSERT(almost_eq(box1,box2,1e-8));
+	for (int t=0; t<NB_POS; t++) {
+		TEST_ASSERT(box1[2*t].contains(1+0.4*t));
+		TEST_ASSERT(box1[2*t+1].contains(2+0.3*t));
+		TEST_ASSERT(box1[2*t].is_strict_subset(Interval(0,10)));
+	}
+
+	for (int i=0; i<NB_POS*NB_BEACONS; i++) {
+		delete &ctc[i];
+		delete &ctrs[i];
+	}
+}
+
+void TestCtcFwdBwdFamily::empty01() {
+	Variable a(2), b(2);
+	Function dist(a,b,sqrt(sqr(a[0]-b[0])+sqr(a[1]-b[1])));
+
+	CtcFwdBwdFamily family(dist,2*NB_POS);
+	build_family(family);
+
+	IntervalVector box(2*NB_POS,Interval(0,10));
+	box[2*(NB_POS-1)]=Interval(0,0.5); // the last position is far away
+	TEST_THROWS(family.contract(box),EmptyBoxException);
+	TEST_ASSERT(box.is_empty());
+}
+
+// only the instances with an impacted variable are contracted
+void TestCtcFwdBwdFamily::impact01() {
+	Variable a(2), b(2);
+	Function dist(a,b,sqrt(sqr(a[0]-b[0])+sqr(a[1]-b[1])));
+
+	CtcFwdBwdFamily family(dist,2*NB_POS);
+	build_family(family);
+
+	BoolMask impact(2*NB_POS);
+	impact.unset_all();
+	impact.set(0);
+
+	IntervalVector box(2*NB_POS,Interval(0,10));
+	family.contract(box,impact);
+
+	TEST_ASSERT(box[0].is_strict_subset(Interval(0,10)));
+	TEST_ASSERT(box[1].is_strict_subset(Interval(0,10)));
+	for (int i=2; i<2*NB_POS; i++)
+		TEST_ASSERT(box[i]==Interval(0,10));
+}
+
+// abs is not processed by blocks: the instances are contracted one by one
+void TestCtcFwdBwdFamily::not_vectorized01() {
+	Variable u,v;
+	Function f(u,v,abs(u)+abs(v));
+
+	CtcFwdBwdFamily family(f,3);
+	int var1[2]={0,1};
+	int var2[2]={1,-1};
+	IntervalVector value(2);
+	value[1]=Interval(1);
+	family.add(var1,Interval(0,1));           // |x|+|y|<=1
+	family.add(var2,value,Interval(0,1.5));   // |y|+1<=1.5
+
+	IntervalVector box(3,Interval(-10,10));
+	family.contract(box);
+
+	TEST_ASSERT(almost_eq(box[0],Interval(-1,1),1e-10));
+	TEST_ASSERT(almost_eq(box[1],Interval(-0.5,0.5),1e-10));
+	TEST_ASSERT(box[2]==Interval(-10,10));
+}
+
+} // end namespace ibex
@@ -0,0 +1,37 @@
+/* ============================================================================
+ * I B E X - CtcFwdBwdFamily Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_FWDBWD_FAMILY_H__
+#define __TEST_CTC_FWDBWD_FAMILY_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcFwdBwdFamily : public TestIbex {
+
+public:
+	TestCtcFwdBwdFamily() {
+		TEST_ADD(TestCtcFwdBwdFamily::slam01);
+		TEST_ADD(TestCtcFwdBwdFamily::empty01);
+		TEST_ADD(TestCtcFwdBwdFamily::impact01);
+		TEST_ADD(TestCtcFwdBwdFamily::not_vectorized01);
+	}
+
+	void slam01();
+	void empty01();
+	void impact01();
+	void not_vectorized01();
+};
+
+} // end namespace
+
+#endif // __TEST_CTC_FWDBWD_FAMILY_H__
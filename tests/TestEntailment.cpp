@@ -0,0 +1,138 @@
+/* ============================================================================
+ * I B E X - Entailment Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestEntailment.h"
+#include "ibex_Entailment.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_Ctc3BCid.h"
+#include "ibex_Cell.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// x+y<=10 is entailed in [-2,2]x[-2,2], x^2+y^2=1 is not.
+System* build_sys() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x+y<=10);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	return new System(fac);
+}
+
+}
+
+void TestEntailment::hc4_01() {
+	System* sys=build_sys();
+	CtcHC4 hc4(sys->ctrs);
+
+	Cell root(IntervalVector(2,Interval(-2,2)));
+	hc4.add_backtrackable(root);
+	TEST_ASSERT(root.has<Entailment>());
+
+	hc4.contract(root);
+	Entailment& e=root.get<Entailment>();
+	TEST_ASSERT(e.nb_entailed()==1);
+	TEST_ASSERT(e.is_entailed(sys->ctrs[0]));
+	TEST_ASSERT(!e.is_entailed(sys->ctrs[1]));
+	TEST_ASSERT(almost_eq(root.box,IntervalVector(2,Interval(-1,1)),1e-10));
+
+	// a contractor built on the same system knows the entailment
+	CtcFwdBwd c(sys->ctrs[0]);
+	IntervalVector box(root.box);
+	c.contract(root);
+	TEST_ASSERT(root.box==box);
+
+	delete sys;
+}
+
+void TestEntailment::bisect01() {
+	System* sys=build_sys();
+	CtcHC4 hc4(sys->ctrs);
+
+	Cell root(IntervalVector(2,Interval(-2,2)));
+	hc4.add_backtrackable(root);
+	hc4.contract(root);
+
+	pair<IntervalVector,IntervalVector> p=root.box.bisect(0);
+	pair<Cell*,Cell*> children=root.bisect(p.first,p.second);
+
+	TEST_ASSERT(children.first->get<Entailment>().is_entailed(sys->ctrs[0]));
+	TEST_ASSERT(children.second->get<Entailment>().is_entailed(sys->ctrs[0]));
+
+	// the entailments of a child are not shared with its sibling
+	children.first->get<Entailment>().set_entailed(sys->ctrs[1]);
+	TEST_ASSERT(children.first->get<Entailment>().nb_entailed()==2);
+	TEST_ASSERT(children.second->get<Entailment>().nb_entailed()==1);
+	TEST_ASSERT(root.get<Entailment>().nb_entailed()==1);
+
+	delete children.first;
+	delete children.second;
+	delete sys;
+}
+
+void TestEntailment::trial01() {
+	System* sys=build_sys();
+	CtcHC4 hc4(sys->ctrs);
+
+	Cell root(IntervalVector(2,Interval(-2,2)));
+	hc4.add_backtrackable(root);
+
+	Entailment& e=root.get<Entailment>();
+	e.start_trial();
+	TEST_ASSERT(e.in_trial());
+	hc4.contract(root);
+	TEST_ASSERT(e.nb_entailed()==0);
+	e.end_trial();
+	TEST_ASSERT(!e.in_trial());
+
+	// a contraction of a copy of the cell box is not recorded either
+	IntervalVector box(root.box);
+	hc4.contract(box);
+	TEST_ASSERT(e.nb_entailed()==0);
+
+	hc4.contract(root);
+	TEST_ASSERT(e.nb_entailed()==1);
+
+	delete sys;
+}
+
+// the entailment of a constraint in a slice is not recorded
+void TestEntailment::cid01() {
+	Variable x;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_ctr(x<=0.5);
+	System sys(fac);
+
+	CtcFwdBwd c(sys.ctrs[0]);
+	Ctc3BCid cid(c,10,1);
+
+	Cell root(IntervalVector(1,Interval(0,1)));
+	cid.add_backtrackable(root);
+	TEST_ASSERT(root.has<Entailment>());
+
+	cid.contract(root);
+	TEST_ASSERT(almost_eq(root.box[0],Interval(0,0.5),1e-10));
+	TEST_ASSERT(!root.get<Entailment>().in_trial());
+	TEST_ASSERT(root.get<Entailment>().nb_entailed()==0);
+
+	// now, the constraint is entailed in the cell box
+	c.contract(root);
+	TEST_ASSERT(root.get<Entailment>().nb_entailed()==1);
+}
+
+} // end namespace ibex
@@ -0,0 +1,37 @@
+/* ============================================================================
+ * I B E X - Entailment Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_ENTAILMENT_H__
+#define __TEST_ENTAILMENT_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestEntailment : public TestIbex {
+
+public:
+	TestEntailment() {
+		TEST_ADD(TestEntailment::hc4_01);
+		TEST_ADD(TestEntailment::bisect01);
+		TEST_ADD(TestEntailment::trial01);
+		TEST_ADD(TestEntailment::cid01);
+	}
+
+	void hc4_01();
+	void bisect01();
+	void trial01();
+	void cid01();
+};
+
+} // end namespace
+
+#endif // __TEST_ENTAILMENT_H__
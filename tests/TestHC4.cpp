@@ -13,6 +13,7 @@
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcHC4.h"
 #include "ibex_Array.h"
+#include "ibex_PriorityAgenda.h"
 
 namespace ibex {
 
@@ -53,4 +54,118 @@ void TestHC4::ponts30() {
 	}
 }
 
+void TestHC4::agenda01() {
+	PriorityAgenda a(5);
+	a.push(0,0.1);
+	a.push(1,0.5);
+	a.push(2,0.3);
+	a.push(3,0.2);
+	a.push(0,0.4);  // increased
+	a.push(1,0.05); // unchanged
+	TEST_ASSERT(a.contains(0));
+	TEST_ASSERT(!a.contains(4));
+	TEST_ASSERT(a.priority(0)==0.4);
+	TEST_ASSERT(a.priority(1)==0.5);
+
+	int order[4] = { 1, 0, 2, 3 };
+	int p;
+	for (int i=0; i<4; i++) {
+		a.pop(p);
+		TEST_ASSERT(p==order[i]);
+		TEST_ASSERT(!a.contains(p));
+	}
+	TEST_ASSERT(a.empty());
+
+	a.push(4,1.0);
+	a.push(2,2.0);
+	a.flush();
+	TEST_ASSERT(a.empty());
+	TEST_ASSERT(!a.contains(4));
+	TEST_THROWS(a.pop(p),EmptyAgendaException);
+}
+
+// the PRIORITY agenda reaches the same fixpoint with less calls to HC4Revise
+void TestHC4::ponts30_priority() {
+	Ponts30 p30;
+
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++)
+		ctr[i]=new NumConstraint((*p30.f)[i],EQ);
+	Array<NumConstraint> a(ctr,30);
+
+	CtcHC4 fifo(a,0.01);
+	IntervalVector box1=p30.init_box;
+	fifo.contract(box1);
+
+	CtcHC4 prio(a,0.01,false,CtcPropag::PRIORITY);
+	IntervalVector box2=p30.init_box;
+	prio.contract(box2);
+
+	TEST_ASSERT(almost_eq(box1,box2,1e-10));
+	TEST_ASSERT(prio.revise_count()<fifo.revise_count());
+
+	int n=0;
+	for (int i=0; i<30; i++) n+=prio.nb_revise[i];
+	TEST_ASSERT(n==prio.revise_count());
+
+	for (int i=0; i<30; i++)
+		delete ctr[i];
+}
+
+// the incremental forward evaluation does not change the fixpoint
+void TestHC4::ponts30_incremental() {
+	Ponts30 p30;
+
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++)
+		ctr[i]=new NumConstraint((*p30.f)[i],EQ);
+	Array<NumConstraint> a(ctr,30);
+
+	CtcHC4 full(a,0.01);
+	for (int i=0; i<30; i++)
+		((CtcFwdBwd&) full.list[i]).incremental=false;
+	IntervalVector box1=p30.init_box;
+	full.contract(box1);
+
+	CtcHC4 incr(a,0.01);
+	IntervalVector box2=p30.init_box;
+	incr.contract(box2);
+
+	TEST_ASSERT(box1==box2);
+	TEST_ASSERT(incr.revise_count()==full.revise_count());
+
+	for (int i=0; i<30; i++)
+		delete ctr[i];
+}
+
+// try_contract gives the same result as contract, without exception
+void TestHC4::try_contract01() {
+	Ponts30 p30;
+
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++)
+		ctr[i]=new NumConstraint((*p30.f)[i],EQ);
+	Array<NumConstraint> a(ctr,30);
+
+	CtcHC4 hc4(a,0.01);
+	IntervalVector box1=p30.init_box;
+	hc4.contract(box1);
+
+	IntervalVector box2=p30.init_box;
+	TEST_ASSERT(hc4.try_contract(box2));
+	TEST_ASSERT(box1==box2);
+
+	for (int i=0; i<30; i++)
+		delete ctr[i];
+
+	Variable x,y;
+	NumConstraint c(x,y,sqr(x)+sqr(y)=1);
+	CtcHC4 hc4_2(Array<NumConstraint>(c),0.01);
+	IntervalVector box(2,Interval(2,3));
+	TEST_ASSERT(!hc4_2.try_contract(box,BoolMask(2,1)));
+	TEST_ASSERT(box.is_empty());
+	box=IntervalVector(2,Interval(2,3));
+	TEST_THROWS(hc4_2.contract(box),EmptyBoxException);
+}
+
 } // end namespace ibex
@@ -20,9 +20,17 @@ class TestHC4 : public TestIbex {
 public:
 	TestHC4() {
 		TEST_ADD(TestHC4::ponts30);
+		TEST_ADD(TestHC4::agenda01);
+		TEST_ADD(TestHC4::ponts30_priority);
+		TEST_ADD(TestHC4::ponts30_incremental);
+		TEST_ADD(TestHC4::try_contract01);
 	}
 
 	void ponts30();
+	void agenda01();
+	void ponts30_priority();
+	void ponts30_incremental();
+	void try_contract01();
 };
 
 } // end namespace ibex
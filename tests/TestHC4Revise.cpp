@@ -14,6 +14,7 @@
 #include "ibex_Expr.h"
 #include "ibex_NumConstraint.h"
 #include "ibex_HC4Revise.h"
+#include "ibex_CtcFwdBwd.h"
 
 using namespace std;
 
@@ -130,5 +131,71 @@ void TestHC4Revise::dist02() {
 	check(box, boxR);
 }
 
+// only the subexpressions that depend on y are re-evaluated
+void TestHC4Revise::incremental01() {
+	Variable x,y;
+	Function f(x,y,sin(x)+sqr(y));
+
+	bool updated[2] = { false, true };
+	bool skip[5];
+	f.unaffected(updated,skip);
+	int nb_skip=0;
+	for (int i=0; i<f.expr().size; i++)
+		if (skip[i]) nb_skip++;
+	TEST_ASSERT(nb_skip==2); // x and sin(x)
+	TEST_ASSERT(!skip[0]);
+
+	double _box[][2] = { {0,1}, {-1,2} };
+	IntervalVector box(2,_box);
+	Domain zero(Dim::scalar());
+	zero.i()=Interval::ZERO;
+	HC4Revise hc4r;
+	hc4r.proj(f,zero,box);
+
+	IntervalVector box2(box);
+	box2[1]=Interval(-0.5,0);
+	IntervalVector box3(box2);
+	hc4r.proj(f,zero,box2,skip);
+	HC4Revise().proj(f,zero,box3);
+	TEST_ASSERT(box2.is_subset(box3));
+	TEST_ASSERT(almost_eq(box2,box3,1e-10));
+}
+
+// incremental and non-incremental forward-backward contractors
+void TestHC4Revise::incremental02() {
+	Variable x,y,z;
+	Function f(x,y,z,x*exp(y)+sqr(z)-2);
+
+	CtcFwdBwd c1(f);
+	CtcFwdBwd c2(f);
+	c2.incremental=false;
+
+	double _box[][2] = { {0,10}, {-1,1}, {-1,1} };
+	IntervalVector box1(3,_box);
+	IntervalVector box2(3,_box);
+
+	c1.contract(box1);
+	c2.contract(box2);
+	TEST_ASSERT(box1==box2);
+
+	// shrink z only
+	box1[2]=box2[2]=Interval(0.5,1);
+	BoolMask impact(3);
+	impact.unset_all();
+	impact.set(2);
+	c1.contract(box1,impact);
+	c2.contract(box2);
+	TEST_ASSERT(box1.is_subset(box2));
+	TEST_ASSERT(almost_eq(box1,box2,1e-10));
+
+	// not a subbox of the last one: all the nodes are evaluated
+	double _box3[][2] = { {0,1}, {-1,1}, {-1,1} };
+	box1=IntervalVector(3,_box3);
+	box2=box1;
+	c1.contract(box1);
+	c2.contract(box2);
+	TEST_ASSERT(box1==box2);
+}
+
 } // end namespace
 
@@ -30,6 +30,8 @@ public:
 		TEST_ADD(TestHC4Revise::min01);
 		TEST_ADD(TestHC4Revise::dist01);
 		TEST_ADD(TestHC4Revise::dist02);
+		TEST_ADD(TestHC4Revise::incremental01);
+		TEST_ADD(TestHC4Revise::incremental02);
 	}
 	void id01();
 	void add01();
@@ -42,6 +44,9 @@ public:
 
 	void dist01();
 	void dist02();
+
+	void incremental01();
+	void incremental02();
 };
 
 } // end namespace
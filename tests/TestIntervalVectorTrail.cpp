@@ -0,0 +1,145 @@
+/* ============================================================================
+ * I B E X - IntervalVectorTrail Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestIntervalVectorTrail.h"
+#include "ibex_IntervalVectorTrail.h"
+
+using namespace std;
+
+namespace ibex {
+
+static IntervalVector init_box() {
+	double _box[][2] = { {0,1}, {2,3}, {4,5}, {6,7} };
+	return IntervalVector(4,_box);
+}
+
+void TestIntervalVectorTrail::undo01() {
+	IntervalVector box(init_box());
+	IntervalVectorTrail trail(box);
+	trail.checkpoint();
+	trail.save(2);
+	box[2]=Interval(4.5,5);
+	trail.save(2);
+	box[2]=Interval(4.5,4.6);
+	trail.undo();
+	check(box,init_box());
+	TEST_ASSERT(trail.level()==1);
+}
+
+// the checkpoint remains set after an undo
+void TestIntervalVectorTrail::undo02() {
+	IntervalVector box(init_box());
+	IntervalVectorTrail trail(box);
+	trail.checkpoint();
+	for (int i=1; i<4; i++) {
+		trail.save(i);
+		trail.save(3);
+		box[i]=Interval(i);
+		box[3]=Interval::EMPTY_SET;
+		trail.undo();
+		check(box,init_box());
+	}
+	trail.commit();
+	TEST_ASSERT(trail.level()==0);
+}
+
+// IntervalVector::set_empty() modifies the first component
+void TestIntervalVectorTrail::empty01() {
+	IntervalVector box(init_box());
+	IntervalVectorTrail trail(box);
+	trail.checkpoint();
+	box.set_empty();
+	trail.undo();
+	TEST_ASSERT(!box.is_empty());
+	check(box,init_box());
+}
+
+void TestIntervalVectorTrail::nested01() {
+	IntervalVector box(init_box());
+	IntervalVectorTrail trail(box);
+	trail.checkpoint();
+	trail.save(1);
+	box[1]=Interval(2.5,3);
+
+	trail.checkpoint();
+	trail.save(1);
+	trail.save(2);
+	box[1]=Interval(2.5,2.6);
+	box[2]=Interval(4.5,5);
+	trail.backtrack();
+	TEST_ASSERT(trail.level()==1);
+	TEST_ASSERT(box[1]==Interval(2.5,3));
+	TEST_ASSERT(box[2]==Interval(4,5));
+
+	trail.undo();
+	check(box,init_box());
+}
+
+// the modifications of a committed checkpoint are undone by the previous one
+void TestIntervalVectorTrail::nested02() {
+	IntervalVector box(init_box());
+	IntervalVectorTrail trail(box);
+	trail.checkpoint();
+	trail.save(1);
+	box[1]=Interval(2.5,3);
+
+	trail.checkpoint();
+	trail.save(1);
+	trail.save(2);
+	box[1]=Interval(2.5,2.6);
+	box[2]=Interval(4.5,5);
+	trail.commit();
+	TEST_ASSERT(box[1]==Interval(2.5,2.6));
+	TEST_ASSERT(box[2]==Interval(4.5,5));
+
+	// the first component and 1 are not saved twice
+	TEST_ASSERT(trail.nb_saved()==3);
+
+	trail.undo();
+	check(box,init_box());
+}
+
+void TestIntervalVectorTrail::rel_distance01() {
+	IntervalVector box(init_box());
+	IntervalVectorTrail trail(box);
+	trail.checkpoint();
+	trail.save(1);
+	trail.save(3);
+	box[1]=Interval(2,2.5);
+	box[3]=Interval(6,6.9);
+	IntervalVector old_box(init_box());
+	check(trail.rel_distance(),old_box.rel_distance(box));
+	check(trail.rel_distance(),0.5);
+}
+
+// a trail reused for another box
+void TestIntervalVectorTrail::reset01() {
+	IntervalVectorTrail trail(4);
+	IntervalVector box1(init_box());
+	trail.reset(box1);
+	trail.checkpoint();
+	trail.save(1);
+	box1[1]=Interval(2,2.5);
+	trail.checkpoint();             // left set (the modifications are kept)
+
+	IntervalVector box2(init_box());
+	trail.reset(box2);
+	TEST_ASSERT(trail.level()==0);
+	TEST_ASSERT(&trail.box()==&box2);
+	trail.checkpoint();
+	trail.save(1);                  // saved again (not confused with box1)
+	box2[1]=Interval(3);
+	TEST_ASSERT(trail.nb_saved()==2);
+	trail.undo();
+	check(box2,init_box());
+	TEST_ASSERT(box1[1]==Interval(2,2.5));
+}
+
+} // end namespace ibex
@@ -0,0 +1,43 @@
+/* ============================================================================
+ * I B E X - IntervalVectorTrail Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_INTERVAL_VECTOR_TRAIL_H__
+#define __TEST_INTERVAL_VECTOR_TRAIL_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestIntervalVectorTrail : public TestIbex {
+
+public:
+	TestIntervalVectorTrail() {
+		TEST_ADD(TestIntervalVectorTrail::undo01);
+		TEST_ADD(TestIntervalVectorTrail::undo02);
+		TEST_ADD(TestIntervalVectorTrail::empty01);
+		TEST_ADD(TestIntervalVectorTrail::nested01);
+		TEST_ADD(TestIntervalVectorTrail::nested02);
+		TEST_ADD(TestIntervalVectorTrail::rel_distance01);
+		TEST_ADD(TestIntervalVectorTrail::reset01);
+	}
+
+	void undo01();
+	void undo02();
+	void empty01();
+	void nested01();
+	void nested02();
+	void rel_distance01();
+	void reset01();
+};
+
+} // end namespace
+
+#endif // __TEST_INTERVAL_VECTOR_TRAIL_H__
@@ -93,4 +93,174 @@ void TestLinear::inflating_gauss_seidel03() {
 	TEST_ASSERT(!ret);
 }
 
+static IntervalMatrix tridiag(int n) {
+	IntervalMatrix A(n,n,Interval::ZERO);
+	for (int i=0; i<n; i++) {
+		A[i][i]=Interval(3.9,4.1);
+		if (i>0) A[i][i-1]=-1;
+		if (i<n-1) A[i][i+1]=Interval(-1.1,-0.9);
+	}
+	return A;
+}
+
+void TestLinear::sparse_matrix01() {
+	int n=5;
+	IntervalMatrix A=tridiag(n);
+	IntervalSparseMatrix S(A);
+	TEST_ASSERT(S.nb_rows()==n);
+	TEST_ASSERT(S.nb_cols()==n);
+	TEST_ASSERT(S.nb_nonzeros()==3*n-2);
+	TEST_ASSERT(S.find(0,2)==-1);
+	TEST_ASSERT(S.col(S.find(2,3))==3);
+	TEST_ASSERT(S(2,3)==Interval(-1.1,-0.9));
+	TEST_ASSERT(S(4,0)==Interval::ZERO);
+	TEST_ASSERT(S.dense()==A);
+
+	IntervalVector x(n,Interval(-1,2));
+	TEST_ASSERT(almost_eq(S*x,A*x,1e-12));
+
+	int row_start[]={0,1,3};
+	int col[]={1,0,2};
+	IntervalSparseMatrix T(2,3,row_start,col,Interval(1,2));
+	TEST_ASSERT(T.nb_nonzeros()==3);
+	TEST_ASSERT(T(0,0)==Interval::ZERO);
+	TEST_ASSERT(T(1,2)==Interval(1,2));
+}
+
+void TestLinear::sparse_gauss_seidel01() {
+	int n=10;
+	IntervalMatrix A=tridiag(n);
+	IntervalVector b(n,Interval(0.9,1.1));
+
+	IntervalVector x(n,Interval(-10,10));
+	IntervalVector xs(x);
+	gauss_seidel(A,b,x);
+	gauss_seidel(IntervalSparseMatrix(A),b,xs);
+
+	TEST_ASSERT(xs.is_subset(IntervalVector(n,Interval(-10,10))));
+	TEST_ASSERT(xs.rel_distance(IntervalVector(n,Interval(-10,10)))>0.5);
+	TEST_ASSERT(almost_eq(x,xs,1e-10));
+}
+
+void TestLinear::sparse_precond01() {
+	int n=6;
+	IntervalMatrix A=tridiag(n);
+	IntervalVector b(n,Interval(0.9,1.1));
+	IntervalMatrix Ad(A);
+	IntervalVector bd(b);
+	precond(Ad,bd);
+
+	IntervalSparseMatrix As(A);
+	IntervalVector bs(b);
+	precond(As,bs,n);
+
+	TEST_ASSERT(As.nb_rows()==n);
+	TEST_ASSERT(almost_eq(bs,bd,1e-10));
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(almost_eq(As.dense()[i],Ad[i],1e-10));
+
+	// blocks of size 2: the result has at most 4 entries per row
+	IntervalSparseMatrix A2(A);
+	IntervalVector b2(b);
+	precond(A2,b2,2);
+	for (int i=0; i<n; i++) {
+		TEST_ASSERT(A2.row_end(i)-A2.row_begin(i)<=4);
+		// the diagonal blocks are close to the identity
+		TEST_ASSERT(A2(i,i).contains(1));
+	}
+}
+
+void TestLinear::sparse_inflating_gauss_seidel01() {
+	int n=4;
+	Matrix A=(n+1)*Matrix::eye(n)-Matrix::ones(n); // diagonally dominant matrix
+	Vector b(n);
+	for (int i=1; i<=n; i++) b[i-1]=::pow(-1.0,i)*i; // just an arbitrary example
+
+	Matrix invA(n,n);
+	real_inverse(A,invA);
+	IntervalVector sol=invA*b;
+
+	IntervalVector x=0.1*Interval(-1,1)*Vector::ones(n);
+
+	bool ret=inflating_gauss_seidel(IntervalSparseMatrix(IntervalMatrix(A)),b,x);
+	TEST_ASSERT(ret);
+	TEST_ASSERT(sol.rel_distance(x)<0.01);
+}
+
+void TestLinear::preconditioner01() {
+	int n=6;
+	IntervalMatrix A=tridiag(n);
+	IntervalVector b(n,Interval(0.9,1.1));
+	Preconditioner cache(n);
+
+	IntervalMatrix A1(A);
+	IntervalVector b1(b);
+	cache.apply(A1,b1);
+	TEST_ASSERT(cache.nb_inversions==1);
+	IntervalMatrix A2(A);
+	IntervalVector b2(b);
+	precond(A2,b2);
+	TEST_ASSERT(almost_eq(b1,b2,1e-12));
+
+	// a small perturbation of all the entries: the inverse is reused
+	IntervalMatrix A3(A+IntervalMatrix(n,n,Interval(0,1e-3)));
+	cache.apply(A3,b1);
+	TEST_ASSERT(cache.nb_inversions==1);
+	TEST_ASSERT(cache.nb_reuses==1);
+
+	// a large perturbation: the inverse is recomputed
+	IntervalMatrix A4(2.0*A+IntervalMatrix(n,n,Interval(0,0.5)));
+	cache.apply(A4);
+	TEST_ASSERT(cache.nb_inversions==2);
+	IntervalMatrix A5(2.0*A+IntervalMatrix(n,n,Interval(0,0.5)));
+	precond(A5);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(almost_eq(A4[i],A5[i],1e-12));
+}
+
+void TestLinear::preconditioner02() {
+	int n=5;
+	IntervalMatrix A=tridiag(n);
+	Preconditioner cache(n);
+	IntervalMatrix A1(A);
+	cache.apply(A1);
+
+	Matrix inv(n,n);
+
+	// change one column
+	for (int i=0; i<n; i++) A[i][2]+=i+1;
+	IntervalMatrix A2(A);
+	cache.apply(A2);
+	TEST_ASSERT(cache.nb_updates==1);
+	real_inverse(A.mid(),inv);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(almost_eq(cache.inverse().row(i),inv.row(i),1e-12));
+
+	// change one row
+	for (int j=0; j<n; j++) A[3][j]-=0.5*j;
+	IntervalMatrix A3(A);
+	cache.apply(A3);
+	TEST_ASSERT(cache.nb_updates==2);
+	TEST_ASSERT(cache.nb_inversions==1);
+	real_inverse(A.mid(),inv);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(almost_eq(cache.inverse().row(i),inv.row(i),1e-12));
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			TEST_ASSERT(A3[i][j].contains(i==j? 1 : 0));
+}
+
+void TestLinear::preconditioner03() {
+	int n=4;
+	IntervalMatrix A=tridiag(n);
+	Preconditioner cache(n,0);
+	for (int k=0; k<3; k++) {
+		IntervalMatrix A1(A);
+		cache.apply(A1);
+	}
+	TEST_ASSERT(cache.nb_inversions==3);
+	TEST_ASSERT(cache.nb_reuses==0);
+	TEST_ASSERT(cache.nb_updates==0);
+}
+
 } // end namespace ibex
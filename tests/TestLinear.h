@@ -13,6 +13,7 @@
 
 #include "cpptest.h"
 #include "ibex_Linear.h"
+#include "ibex_Preconditioner.h"
 #include "utils.h"
 
 namespace ibex {
@@ -26,6 +27,13 @@ public:
 		TEST_ADD(TestLinear::inflating_gauss_seidel01);
 		TEST_ADD(TestLinear::inflating_gauss_seidel02);
 		TEST_ADD(TestLinear::inflating_gauss_seidel03);
+		TEST_ADD(TestLinear::sparse_matrix01);
+		TEST_ADD(TestLinear::sparse_gauss_seidel01);
+		TEST_ADD(TestLinear::sparse_precond01);
+		TEST_ADD(TestLinear::sparse_inflating_gauss_seidel01);
+		TEST_ADD(TestLinear::preconditioner01);
+		TEST_ADD(TestLinear::preconditioner02);
+		TEST_ADD(TestLinear::preconditioner03);
 	}
 
 	void lu_partial_underctr();
@@ -38,6 +46,22 @@ public:
 	void inflating_gauss_seidel02();
 	// divergence, start with thick vector
 	void inflating_gauss_seidel03();
+
+	// structure, access and product
+	void sparse_matrix01();
+	// same result as the dense Gauss-Seidel
+	void sparse_gauss_seidel01();
+	// one block: same result as the dense preconditioning
+	void sparse_precond01();
+	// convergence, start with thick vector
+	void sparse_inflating_gauss_seidel01();
+
+	// reuse of the inverse
+	void preconditioner01();
+	// rank-one updates (one column, one row)
+	void preconditioner02();
+	// no reuse with tol=0
+	void preconditioner03();
 };
 
 } // end namespace ibex
@@ -0,0 +1,467 @@
+//============================================================================
+//                                  I B E X
+// File        : TestLinearSolver.cpp
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "TestLinearSolver.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_LinearRelaxAffine2.h"
+#include "ibex_CtcPolytopeHull.h"
+#include "ibex_Cell.h"
+#include "ibex_CutPool.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// min -x-y s.t. x+2y<=4, 3x+y<=6, x,y in [0,10]
+void triangle(LinearSolver& lp) {
+	lp.initBoundVar(IntervalVector(2,Interval(0,10)));
+	Vector row(2);
+	row[0]=1; row[1]=2;
+	lp.addConstraint(row,LEQ,4);
+	row[0]=3; row[1]=1;
+	lp.addConstraint(row,LEQ,6);
+}
+
+}
+
+void TestLinearSolver::optimal01() {
+	LinearSolver lp(2,2);
+	triangle(lp);
+	lp.setVarObj(0,-1);
+	lp.setVarObj(1,-1);
+
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()+2.8)<1e-9);
+
+	Vector x(2);
+	TEST_ASSERT(lp.getPrimalSol(x)==LinearSolver::OK);
+	TEST_ASSERT(fabs(x[0]-1.6)<1e-9);
+	TEST_ASSERT(fabs(x[1]-1.2)<1e-9);
+
+	// c = A^T*dual and the dual values of the active upper bounds are negative
+	TEST_ASSERT(lp.getNbRows()==4);
+	Vector dual(4);
+	TEST_ASSERT(lp.getDualSol(dual)==LinearSolver::OK);
+	Matrix A_trans(2,4);
+	TEST_ASSERT(lp.getCoefConstraint_trans(A_trans)==LinearSolver::OK);
+	Vector c=A_trans*dual;
+	TEST_ASSERT(fabs(c[0]+1)<1e-9);
+	TEST_ASSERT(fabs(c[1]+1)<1e-9);
+	TEST_ASSERT(fabs(dual[0])<1e-9 && fabs(dual[1])<1e-9);
+	TEST_ASSERT(dual[2]<0 && dual[3]<0);
+
+	// the dual objective gives a rigorous enclosure of the optimum
+	IntervalVector B(4);
+	TEST_ASSERT(lp.getB(B)==LinearSolver::OK);
+	IntervalVector Lambda(4);
+	for (int i=0; i<4; i++) Lambda[i]=dual[i];
+	TEST_ASSERT((Lambda*B).contains(-2.8));
+}
+
+void TestLinearSolver::sparse01() {
+	// the same LP as in optimal01, with sparse rows added at once
+	// (and two rows with only one coefficient)
+	LinearSolver lp(2,3);
+	lp.initBoundVar(IntervalVector(2,Interval(0,10)));
+	LinearRows rows;
+	int col[2]={0,1};
+	double row1[2]={1,2};
+	double row2[2]={3,1};
+	double one=1;
+	rows.add(2,col,row1,LEQ,4);
+	rows.add(2,col,row2,LEQ,6);
+	rows.add(1,col,&one,GEQ,-10);  // x >= -10 (inactive)
+	TEST_ASSERT(rows.size()==3);
+	TEST_ASSERT(lp.addConstraints(rows)==LinearSolver::OK);
+	TEST_ASSERT(lp.addConstraint(1,col,&one,LEQ,1.5)==LinearSolver::OK);
+	TEST_ASSERT(lp.getNbRows()==6);
+
+	lp.setVarObj(0,-1);
+	lp.setVarObj(1,-1);
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()+2.75)<1e-9);
+
+	Matrix A_trans(2,6);
+	TEST_ASSERT(lp.getCoefConstraint_trans(A_trans)==LinearSolver::OK);
+	TEST_ASSERT(A_trans[0][3]==3 && A_trans[1][3]==1);
+	TEST_ASSERT(A_trans[0][4]==1 && A_trans[1][4]==0);
+	TEST_ASSERT(A_trans[0][5]==1 && A_trans[1][5]==0);
+}
+
+void TestLinearSolver::optimal02() {
+	LinearSolver lp(2,2);
+	triangle(lp);
+	lp.setSense(LinearSolver::MAXIMIZE);
+	lp.setVarObj(0,1);
+	lp.setVarObj(1,1);
+
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()-2.8)<1e-9);
+
+	// a variable without upper bound
+	lp.setBoundVar(1,Interval(0,POS_INFINITY));
+	lp.setVarObj(0,0);
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()-2)<1e-9);
+}
+
+void TestLinearSolver::infeasible01() {
+	LinearSolver lp(2,2);
+	lp.initBoundVar(IntervalVector(2,Interval(0,10)));
+	Vector row(2,1.0);
+	lp.addConstraint(row,GEQ,3);
+	lp.addConstraint(row,LEQ,1);
+	lp.setVarObj(0,1);
+
+	TEST_ASSERT(lp.solve()==LinearSolver::INFEASIBLE_NOTPROVED);
+
+	// Farkas certificate: A^T*y=0 and 0 is not in y*B
+	Vector y(4);
+	TEST_ASSERT(lp.getInfeasibleDir(y)==LinearSolver::OK);
+	Matrix A_trans(2,4);
+	lp.getCoefConstraint_trans(A_trans);
+	IntervalVector B(4);
+	lp.getB(B);
+	IntervalVector Y(4);
+	for (int i=0; i<4; i++) Y[i]=y[i];
+	Interval d=(IntervalMatrix(A_trans)*Y)*IntervalVector(2,Interval(0,10)) - Y*B;
+	TEST_ASSERT(!d.contains(0));
+}
+
+void TestLinearSolver::sequence01() {
+	// the 2n LPs of a polytope hull, solved with the same object
+	LinearSolver lp(2,2);
+	triangle(lp);
+
+	double expected[4] = { 0, 2, 0, 2 };
+	for (int k=0; k<3; k++) { // several times to check the warm start
+		for (int i=0; i<2; i++) {
+			lp.setVarObj(i,1);
+			TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+			TEST_ASSERT(fabs(lp.getObjValue()-expected[2*i])<1e-9);
+			lp.setVarObj(i,-1);
+			TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+			TEST_ASSERT(fabs(-lp.getObjValue()-expected[2*i+1])<1e-9);
+			lp.setVarObj(i,0);
+		}
+	}
+
+	// tighter bounds
+	lp.setBoundVar(0,Interval(1,10));
+	lp.setVarObj(1,-1);
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()+1.5)<1e-9);
+
+	// new constraints
+	lp.cleanConst();
+	TEST_ASSERT(lp.getNbRows()==2);
+	Vector row(2);
+	row[0]=1; row[1]=1;
+	lp.addConstraint(row,LEQ,3);
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()+2)<1e-9);
+}
+
+void TestLinearSolver::warm_start01() {
+	LinearSolver lp(2,2);
+	triangle(lp);
+	lp.setVarObj(0,-1);
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+#ifdef _IBEX_WITH_NATIVE_LP_
+	// only the built-in solver reports the warm starts
+	TEST_ASSERT(!lp.isWarmStart());
+#endif
+
+	// change of objective
+	lp.setVarObj(0,0);
+	lp.setVarObj(1,-1);
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()+2)<1e-9);
+#ifdef _IBEX_WITH_NATIVE_LP_
+	TEST_ASSERT(lp.isWarmStart());
+#endif
+
+	// same structure with other coefficients
+	lp.cleanConst();
+	Vector row(2);
+	row[0]=1; row[1]=2.5;
+	lp.addConstraint(row,LEQ,4);
+	row[0]=3; row[1]=1;
+	lp.addConstraint(row,LEQ,6);
+	TEST_ASSERT(lp.solve()==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()+1.6)<1e-9);
+#ifdef _IBEX_WITH_NATIVE_LP_
+	TEST_ASSERT(lp.isWarmStart());
+	TEST_ASSERT(lp.getNbIter()<=1);
+#endif
+}
+
+namespace {
+
+System* polytope() {
+	SystemFactory fac;
+	Variable x,y;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(1.5-x-y<=0);
+	fac.add_ctr(x-y<=0);
+	return new System(fac);
+}
+
+}
+
+void TestLinearSolver::polytope_hull01() {
+	System* sys=polytope();
+	LinearRelaxAffine2 lr(*sys);
+	CtcPolytopeHull ctc(lr,CtcPolytopeHull::ALL_BOX);
+
+	IntervalVector box(2,Interval(0,1));
+	ctc.contract(box);
+	TEST_ASSERT(almost_eq(box[0],Interval(0.5,1),1e-8));
+	TEST_ASSERT(almost_eq(box[1],Interval(0.75,1),1e-8));
+	delete sys;
+}
+
+void TestLinearSolver::polytope_hull02() {
+	System* sys=polytope();
+	LinearRelaxAffine2 lr(*sys);
+	CtcPolytopeHull ctc(lr,CtcPolytopeHull::ALL_BOX);
+
+	IntervalVector box(2,Interval(0,1));
+	ctc.contract(box);
+	TEST_ASSERT(ctc.nb_lp>0);
+	int nb_lp=ctc.nb_lp;
+
+	// a sub-box (the relaxation has the same structure)
+	IntervalVector box2(2);
+	box2[0]=Interval(0.5,0.8);
+	box2[1]=Interval(0.75,1);
+	ctc.contract(box2);
+	TEST_ASSERT(almost_eq(box2[0],Interval(0.5,0.8),1e-8));
+	TEST_ASSERT(almost_eq(box2[1],Interval(0.75,1),1e-8));
+	TEST_ASSERT(ctc.nb_lp>nb_lp);
+#ifdef _IBEX_WITH_NATIVE_LP_
+	// with the built-in solver, all the LPs but the first one are warm-started
+	TEST_ASSERT(ctc.nb_warm_lp==ctc.nb_lp-1);
+#endif
+	delete sys;
+}
+
+void TestLinearSolver::polytope_hull03() {
+	System* sys=polytope();
+	LinearRelaxAffine2 lr(*sys);
+	// 3 LPs solved in parallel
+	CtcPolytopeHull ctc(lr,CtcPolytopeHull::ALL_BOX,LinearSolver::default_max_iter,LinearSolver::default_max_time_out,
+			LinearSolver::default_eps,LinearSolver::default_limit_diam_box,true,3);
+
+	IntervalVector box(2,Interval(0,1));
+	ctc.contract(box);
+	TEST_ASSERT(almost_eq(box[0],Interval(0.5,1),1e-8));
+	TEST_ASSERT(almost_eq(box[1],Interval(0.75,1),1e-8));
+
+	// an infeasible box
+	IntervalVector box2(2);
+	box2[0]=Interval(0.8,1);
+	box2[1]=Interval(0,0.5);
+	try {
+		ctc.contract(box2);
+	} catch(EmptyBoxException&) { }
+	TEST_ASSERT(box2.is_empty());
+	delete sys;
+}
+
+void TestLinearSolver::polytope_hull04() {
+	SystemFactory fac;
+	Variable x,y,z;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(z);
+	fac.add_ctr(1.5-x-y<=0);
+	fac.add_ctr(z-2<=0);
+	System sys(fac);
+
+	LinearRelaxAffine2 lr(sys);
+	CtcPolytopeHull ctc(lr,CtcPolytopeHull::ALL_BOX);
+
+	Cell* root=new Cell(IntervalVector(3,Interval(0,1)));
+	ctc.add_backtrackable(*root);
+	ctc.contract(*root);
+	TEST_ASSERT(almost_eq(root->box[0],Interval(0.5,1),1e-8));
+	TEST_ASSERT(lr.nb_ctr_relaxed==2);
+	TEST_ASSERT(lr.nb_ctr_reused==0);
+
+	// bisect x: only the first constraint has to be linearized again
+	IntervalVector left(root->box);
+	IntervalVector right(root->box);
+	left[0]=Interval(0.5,0.75);
+	right[0]=Interval(0.75,1);
+	std::pair<Cell*,Cell*> p=root->bisect(left,right);
+	delete root;
+
+	IntervalVector box(p.first->box); // for comparison with the non-incremental linearization
+	ctc.contract(*p.first);
+	TEST_ASSERT(lr.nb_ctr_relaxed==3);
+	TEST_ASSERT(lr.nb_ctr_reused==1);
+	ctc.contract(box);
+	TEST_ASSERT(almost_eq(p.first->box,box,1e-8));
+	TEST_ASSERT(almost_eq(p.first->box[1],Interval(0.75,1),1e-8));
+
+	ctc.contract(*p.second);
+	TEST_ASSERT(lr.nb_ctr_relaxed==4);
+	TEST_ASSERT(lr.nb_ctr_reused==2);
+
+	delete p.first;
+	delete p.second;
+}
+
+void TestLinearSolver::cut_pool01() {
+	CutPool pool(2,CutPool::default_max_parallelism,1);
+	IntervalVector box(2,Interval(0,1));
+	int col[2]={0,1};
+	double a[2]={1,1};
+	double a2[2]={2,2};
+	double a3[2]={1,-1};
+
+	LinearRows rows;
+	rows.add(2,col,a,LEQ,3);      // redundant
+	rows.add(2,col,a,LEQ,1.5);    // dominated by the next one
+	rows.add(2,col,a2,LEQ,2.9);
+	rows.add(2,col,a3,GEQ,-0.5);
+
+	LinearRows selected;
+	pool.select(box,rows,selected);
+	TEST_ASSERT(selected.size()==2);
+	TEST_ASSERT(pool.nb_kept==2);
+	TEST_ASSERT(pool.nb_dropped==2);
+	TEST_ASSERT(selected.rhs[0]==2.9);
+	TEST_ASSERT(selected.sign[1]==LEQ);
+	TEST_ASSERT(selected.rhs[1]==0.5);
+
+	// the first row is active, the second is not
+	Vector primal(2,0.7);
+	Vector dual(4,0.0);
+	dual[2]=1.0;
+	pool.update(primal,dual);
+
+	// a sub-box: no new row, the pooled ones are kept until they are too old
+	box[0]=Interval(0,0.9);
+	LinearRows no_row;
+	pool.select(box,no_row,selected);
+	TEST_ASSERT(selected.size()==2);
+	pool.select(box,no_row,selected);
+	TEST_ASSERT(selected.size()==1);
+	TEST_ASSERT(selected.rhs[0]==2.9);
+	TEST_ASSERT(pool.nb_dropped==3);
+
+	// another box: the rows are no more valid
+	box[0]=Interval(1,2);
+	pool.select(box,no_row,selected);
+	TEST_ASSERT(selected.size()==0);
+	TEST_ASSERT(pool.size()==0);
+}
+
+void TestLinearSolver::polytope_hull05() {
+	System* sys=polytope();
+	LinearRelaxAffine2 lr(*sys);
+	CtcPolytopeHull ctc(lr,CtcPolytopeHull::ALL_BOX);
+	ctc.use_cut_pool();
+
+	IntervalVector box(2,Interval(0,1));
+	ctc.contract(box);
+	TEST_ASSERT(almost_eq(box[0],Interval(0.5,1),1e-8));
+	TEST_ASSERT(almost_eq(box[1],Interval(0.75,1),1e-8));
+	TEST_ASSERT(ctc.cut_pool()->nb_kept==2);
+	TEST_ASSERT(ctc.cut_pool()->nb_dropped==0);
+
+	// second call (as in a fixpoint): the new rows are parallel to the pooled ones
+	ctc.contract(box);
+	TEST_ASSERT(almost_eq(box[0],Interval(0.5,1),1e-8));
+	TEST_ASSERT(almost_eq(box[1],Interval(0.75,1),1e-8));
+	TEST_ASSERT(ctc.cut_pool()->nb_kept==4);
+	TEST_ASSERT(ctc.cut_pool()->nb_dropped==2);
+	delete sys;
+}
+
+void TestLinearSolver::polytope_hull06() {
+	System* sys=polytope();
+	LinearRelaxAffine2 lr(*sys);
+	CtcPolytopeHull ctc(lr,CtcPolytopeHull::ALL_BOX,LinearSolver::default_max_iter,LinearSolver::default_max_time_out,
+			LinearSolver::default_eps,LinearSolver::default_limit_diam_box,true,1);
+	// tuning phases of 2 calls every 10 calls
+	ctc.use_adaptive_mode(CtcPolytopeHull::default_min_gain,2,10);
+
+	for (int k=0; k<3; k++) {
+		IntervalVector box(2,Interval(0,1));
+		ctc.contract(box);
+		TEST_ASSERT(almost_eq(box[0],Interval(0.5,1),1e-8));
+		TEST_ASSERT(almost_eq(box[1],Interval(0.75,1),1e-8));
+		if (k<2) TEST_ASSERT(ctc.nb_lp_skipped==0);
+	}
+	TEST_ASSERT(fabs(ctc.predicted_gain(0,true)-0.5)<1e-8);
+	TEST_ASSERT(fabs(ctc.predicted_gain(1,true)-0.75)<1e-8);
+	TEST_ASSERT(ctc.predicted_gain(0,false)==0);
+	// the upper bound of y is reached by the primal solutions (no LP solved)
+	TEST_ASSERT(ctc.predicted_gain(1,false)==1);
+	// the LP of the upper bound of x is skipped after the tuning phase
+	TEST_ASSERT(ctc.nb_lp_skipped==1);
+	TEST_ASSERT(ctc.nb_call_skipped==0);
+
+	// a fixpoint on a cell: the third call is skipped
+	Cell cell(IntervalVector(2,Interval(0,1)));
+	ctc.add_backtrackable(cell);
+	ctc.contract(cell);
+	ctc.contract(cell);
+	TEST_ASSERT(ctc.nb_call_skipped==0);
+	ctc.contract(cell);
+	TEST_ASSERT(ctc.nb_call_skipped==1);
+	TEST_ASSERT(almost_eq(cell.box[0],Interval(0.5,1),1e-8));
+	TEST_ASSERT(almost_eq(cell.box[1],Interval(0.75,1),1e-8));
+	delete sys;
+}
+
+void TestLinearSolver::affine2_batch01() {
+	SystemFactory fac;
+	Variable x,y,z;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(z);
+	fac.add_ctr(sqr(x)+y-z<=0);
+	fac.add_ctr(x*y-exp(z)>=-1);
+	fac.add_ctr(sin(x)+z=0);
+	System sys(fac);
+
+	LinearRelaxAffine2 lr(sys);
+	LinearSolver lp(3,3);
+	IntervalVector box(3,Interval(-1,1));
+
+	// one evaluation of the system function
+	LinearRows rows;
+	std::vector<int> ctrs(3);
+	for (int i=0; i<3; i++) ctrs[i]=i;
+	int n=lr.linearization_ctrs(box,&lp,ctrs,std::vector<LinearRows*>(3,&rows));
+	TEST_ASSERT(n==rows.size());
+	TEST_ASSERT(n>=3);
+
+	// one evaluation per constraint
+	LinearRows rows2;
+	for (int i=0; i<3; i++)
+		lr.linearization_ctr(box,&lp,i,rows2);
+
+	TEST_ASSERT(rows.row_start==rows2.row_start);
+	TEST_ASSERT(rows.col==rows2.col);
+	TEST_ASSERT(rows.sign==rows2.sign);
+	for (unsigned int k=0; k<rows.val.size(); k++)
+		TEST_ASSERT(fabs(rows.val[k]-rows2.val[k])<1e-12);
+	for (int i=0; i<rows.size(); i++)
+		TEST_ASSERT(fabs(rows.rhs[i]-rows2.rhs[i])<1e-12);
+}
+
+} // namespace ibex
@@ -0,0 +1,58 @@
+/* ============================================================================
+ * I B E X - LinearSolver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_LINEAR_SOLVER_H__
+#define __TEST_LINEAR_SOLVER_H__
+
+#include "cpptest.h"
+#include "ibex_LinearSolver.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestLinearSolver : public TestIbex {
+
+public:
+	TestLinearSolver() {
+
+		TEST_ADD(TestLinearSolver::optimal01);
+		TEST_ADD(TestLinearSolver::optimal02);
+		TEST_ADD(TestLinearSolver::sparse01);
+		TEST_ADD(TestLinearSolver::infeasible01);
+		TEST_ADD(TestLinearSolver::sequence01);
+		TEST_ADD(TestLinearSolver::warm_start01);
+		TEST_ADD(TestLinearSolver::polytope_hull01);
+		TEST_ADD(TestLinearSolver::polytope_hull02);
+		TEST_ADD(TestLinearSolver::polytope_hull03);
+		TEST_ADD(TestLinearSolver::polytope_hull04);
+		TEST_ADD(TestLinearSolver::cut_pool01);
+		TEST_ADD(TestLinearSolver::polytope_hull05);
+		TEST_ADD(TestLinearSolver::polytope_hull06);
+		TEST_ADD(TestLinearSolver::affine2_batch01);
+	}
+
+	void optimal01();
+	void optimal02();
+	void sparse01();
+	void infeasible01();
+	void sequence01();
+	void warm_start01();
+	void polytope_hull01();
+	void polytope_hull02();
+	void polytope_hull03();
+	void polytope_hull04();
+	void cut_pool01();
+	void polytope_hull05();
+	void polytope_hull06();
+	void affine2_batch01();
+};
+
+} // namespace ibex
+#endif // __TEST_LINEAR_SOLVER_H__
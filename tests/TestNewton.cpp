@@ -13,6 +13,9 @@
 #include "ibex_Newton.h"
 #include "ibex_EmptyBoxException.h"
 #include "ibex_LinearException.h"
+#include "ibex_Function.h"
+#include "ibex_CtcKrawczyk.h"
+#include "ibex_CtcHansenSengupta.h"
 
 using namespace std;
 
@@ -114,4 +117,206 @@ void TestNewton::inflating_newton01() {
 	TEST_ASSERT(almost_eq(box,expected,1e-10));
 }
 
+void TestNewton::sparse_newton01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	try {
+		sparse_newton(*p30.f,box,default_newton_prec,default_gauss_seidel_ratio,30);
+	} catch (EmptyBoxException& e) {
+		TEST_ASSERT(false);
+	}
+
+	IntervalVector expected(30,BOX2);
+	TEST_ASSERT(almost_eq(box,expected,1e-10));
+}
+
+/*
+ * f_i(x) = 4x_i - x_{i-1} - x_{i+1} + 0.1*x_i^3 - 1,  i=0..n-1
+ * (with x_{-1}=x_n=0), n scalar variables.
+ */
+static Function* tridiag_system(int n) {
+	Array<const ExprSymbol> x(n);
+	for (int i=0; i<n; i++) x.set_ref(i,ExprSymbol::new_());
+
+	Array<const ExprNode> y(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&(Interval(4)*x[i]+Interval(0.1)*pow(x[i],3)-Interval(1));
+		if (i>0) e=&(*e-x[i-1]);
+		if (i<n-1) e=&(*e-x[i+1]);
+		y.set_ref(i,*e);
+	}
+	return new Function(x,ExprVector::new_(y,false));
+}
+
+void TestNewton::sparse_newton02() {
+	int n=200;
+	Function* f=tridiag_system(n);
+
+	IntervalSparseMatrix J;
+	f->jacobian(IntervalVector(n,Interval(0,1)),J);
+	TEST_ASSERT(J.nb_nonzeros()==3*n-2);
+	TEST_ASSERT(almost_eq(J(1,1),Interval(4,4.3),1e-12));
+	TEST_ASSERT(J(1,2)==Interval(-1));
+
+	IntervalVector box(n,Interval(0.2,0.8));
+	IntervalVector box2(box);
+	try {
+		sparse_newton(*f,box);
+		newton(*f,box2);
+	} catch (EmptyBoxException& e) {
+		TEST_ASSERT(false);
+	}
+	TEST_ASSERT(box.max_diam()<1e-8);
+	TEST_ASSERT(almost_eq(box,box2,1e-10));
+	TEST_ASSERT(f->eval_vector(box).is_subset(IntervalVector(n,Interval(-1e-6,1e-6))));
+	delete f;
+}
+
+void TestNewton::sparse_inflating_newton01() {
+	int n=200;
+	Function* f=tridiag_system(n);
+
+	IntervalVector box(n,Interval(0.2,0.8));
+	bool ret=sparse_inflating_newton(*f,box);
+	TEST_ASSERT(ret);
+	TEST_ASSERT(box.max_diam()<1e-8);
+
+	IntervalVector box2(n,Interval(0.2,0.8));
+	TEST_ASSERT(inflating_newton(*f,box2));
+	TEST_ASSERT(almost_eq(box,box2,1e-10));
+	delete f;
+}
+
+void TestNewton::newton_cache01() {
+	Ponts30 p30;
+	Preconditioner cache(30);
+	IntervalVector box(30,BOX1);
+	try {
+		newton(*p30.f,box,cache);
+	} catch (EmptyBoxException& e) {
+		TEST_ASSERT(false);
+	}
+
+	IntervalVector expected(30,BOX2);
+	TEST_ASSERT(almost_eq(box,expected,1e-10));
+	// the preconditioning matrix is computed only once
+	TEST_ASSERT(cache.nb_inversions==1);
+	TEST_ASSERT(cache.nb_reuses+cache.nb_updates>0);
+
+	// a sub-box
+	IntervalVector box2(30,BOX1);
+	box2[0]=Interval(box2[0].lb(),box2[0].mid());
+	try {
+		newton(*p30.f,box2,cache);
+	} catch (EmptyBoxException& e) {
+		TEST_ASSERT(false);
+	}
+	TEST_ASSERT(almost_eq(box2,expected,1e-10));
+	TEST_ASSERT(cache.nb_inversions==1);
+}
+
+void TestNewton::krawczyk01() {
+	Ponts30 p30;
+	Preconditioner cache(30);
+	IntervalVector box(30,BOX1);
+	bool unique;
+	try {
+		krawczyk(*p30.f,box,cache,unique);
+	} catch (EmptyBoxException& e) {
+		TEST_ASSERT(false);
+	}
+	TEST_ASSERT(unique);
+	IntervalVector expected(30,BOX2);
+	TEST_ASSERT(almost_eq(box,expected,1e-10));
+	TEST_ASSERT(box.max_diam()<1e-12);
+}
+
+void TestNewton::krawczyk02() {
+	Variable x;
+	Function f(x,sqr(x)-1);
+	Preconditioner cache(1);
+	bool unique;
+
+	// two solutions
+	IntervalVector box(1,Interval(-1.5,1.5));
+	krawczyk(f,box,cache,unique);
+	TEST_ASSERT(!unique);
+	TEST_ASSERT(box[0].contains(-1) && box[0].contains(1));
+
+	// one solution
+	box[0]=Interval(0.8,1.1);
+	krawczyk(f,box,cache,unique);
+	TEST_ASSERT(unique);
+	TEST_ASSERT(box[0].contains(1));
+	TEST_ASSERT(box[0].diam()<1e-12);
+
+	// no solution
+	box[0]=Interval(1.5,2);
+	try {
+		krawczyk(f,box,cache,unique);
+		TEST_ASSERT(false);
+	} catch (EmptyBoxException& e) {
+		TEST_ASSERT(box.is_empty());
+	}
+}
+
+void TestNewton::hansen_sengupta01() {
+	Ponts30 p30;
+	Preconditioner cache(30);
+	IntervalVector box(30,BOX1);
+	bool unique;
+	try {
+		hansen_sengupta(*p30.f,box,cache,unique);
+	} catch (EmptyBoxException& e) {
+		TEST_ASSERT(false);
+	}
+	TEST_ASSERT(unique);
+	IntervalVector expected(30,BOX2);
+	TEST_ASSERT(almost_eq(box,expected,1e-10));
+	TEST_ASSERT(box.max_diam()<1e-12);
+}
+
+void TestNewton::hansen_sengupta02() {
+	Variable x;
+	Function f(x,sqr(x)-1);
+	Preconditioner cache(1);
+	bool unique;
+
+	IntervalVector box(1,Interval(-1.5,1.5));
+	hansen_sengupta(f,box,cache,unique);
+	TEST_ASSERT(!unique);
+	TEST_ASSERT(box[0].contains(-1) && box[0].contains(1));
+
+	box[0]=Interval(0.8,1.1);
+	hansen_sengupta(f,box,cache,unique);
+	TEST_ASSERT(unique);
+	TEST_ASSERT(box[0].contains(1));
+	TEST_ASSERT(box[0].diam()<1e-12);
+}
+
+void TestNewton::ctc_certified01() {
+	int n=50;
+	Function* f=tridiag_system(n);
+
+	CtcKrawczyk k(*f);
+	IntervalVector box1(n,Interval(0.2,0.8));
+	// the box is larger than the ceiling
+	k.contract(box1);
+	TEST_ASSERT(!k.certified);
+	TEST_ASSERT(box1==IntervalVector(n,Interval(0.2,0.8)));
+
+	CtcKrawczyk k2(*f,1.0);
+	k2.contract(box1);
+	TEST_ASSERT(k2.certified);
+	TEST_ASSERT(k2.nb_certified==1);
+	TEST_ASSERT(box1.max_diam()<1e-12);
+
+	CtcHansenSengupta hs(*f,1.0);
+	IntervalVector box2(n,Interval(0.2,0.8));
+	hs.contract(box2);
+	TEST_ASSERT(hs.certified);
+	TEST_ASSERT(almost_eq(box1,box2,1e-12));
+	delete f;
+}
+
 } // end namespace ibex
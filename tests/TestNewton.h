@@ -23,10 +23,35 @@ public:
 	TestNewton() {
 		TEST_ADD(TestNewton::newton01);
 		TEST_ADD(TestNewton::inflating_newton01);
+		TEST_ADD(TestNewton::sparse_newton01);
+		TEST_ADD(TestNewton::sparse_newton02);
+		TEST_ADD(TestNewton::sparse_inflating_newton01);
+		TEST_ADD(TestNewton::newton_cache01);
+		TEST_ADD(TestNewton::krawczyk01);
+		TEST_ADD(TestNewton::krawczyk02);
+		TEST_ADD(TestNewton::hansen_sengupta01);
+		TEST_ADD(TestNewton::hansen_sengupta02);
+		TEST_ADD(TestNewton::ctc_certified01);
 	}
 
 	void newton01();
 	void inflating_newton01();
+	void sparse_newton01();
+	// a large tridiagonal system
+	void sparse_newton02();
+	void sparse_inflating_newton01();
+	// reuse of the preconditioning matrix
+	void newton_cache01();
+	// certified box
+	void krawczyk01();
+	// two solutions: no certificate
+	void krawczyk02();
+	// certified box
+	void hansen_sengupta01();
+	// two solutions: no certificate
+	void hansen_sengupta02();
+	// Krawczyk and Hansen-Sengupta contractors
+	void ctc_certified01();
 };
 
 } // end namespace ibex
@@ -0,0 +1,89 @@
+/* ============================================================================
+ * I B E X - Optimizer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestOptimizer.h"
+#include "ibex_DefaultOptimizer.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+// unconstrained: the Newton iterations reach the minimum (0) of the Rosenbrock function
+void TestOptimizer::local_search01() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_goal(sqr(x-1)+100*sqr(y-sqr(x)));
+	System sys(fac);
+
+	DefaultOptimizer o(sys,1e-7,1e-7);
+	o.local_search_flag=true;
+	o.optimize(IntervalVector(2,Interval(-3,3)));
+
+	TEST_ASSERT(o.nb_local>0);
+	TEST_ASSERT(o.loup>=0 && o.loup<1e-12);
+	TEST_ASSERT(o.uplo<=o.loup);
+}
+
+// constrained: the loup is improved and the loup point is inner
+void TestOptimizer::local_search02() {
+	Variable x,y;
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_goal(x+y);
+	fac.add_ctr(sqr(x)+sqr(y)<=1);
+	fac.add_ctr(x-2*y<=0.5);
+	System sys(fac);
+
+	IntervalVector box(2,Interval(-3,3));
+
+	DefaultOptimizer o1(sys,1e-7,1e-7);
+	o1.optimize(box);
+
+	DefaultOptimizer o2(sys,1e-7,1e-7);
+	o2.local_search_flag=true;
+	o2.optimize(box);
+
+	TEST_ASSERT(o2.nb_local>0);
+	TEST_ASSERT(o2.loup<o1.loup);
+	TEST_ASSERT(o2.loup>=o2.uplo);
+
+	IntervalVector pt(o2.loup_point);
+	TEST_ASSERT(sys.f.eval_vector(pt).ub()[0]<=1);
+	TEST_ASSERT(sys.f.eval_vector(pt).ub()[1]<=0.5);
+}
+
+// the search tree is smaller (problem 71 of Hock & Schittkowski)
+void TestOptimizer::local_search03() {
+	Variable x(4);
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_goal(x[0]*x[3]*(x[0]+x[1]+x[2])+x[2]);
+	fac.add_ctr(x[0]*x[1]*x[2]*x[3]>=25);
+	fac.add_ctr(sqr(x[0])+sqr(x[1])+sqr(x[2])+sqr(x[3])=40);
+	System sys(fac);
+
+	IntervalVector box(4,Interval(1,5));
+
+	DefaultOptimizer o1(sys,1e-7,1e-7);
+	o1.optimize(box);
+
+	DefaultOptimizer o2(sys,1e-7,1e-7);
+	o2.local_search_flag=true;
+	o2.optimize(box);
+
+	TEST_ASSERT(o2.nb_cells<o1.nb_cells);
+	TEST_ASSERT(fabs(o2.loup-17.014017)<1e-5);
+}
+
+} // end namespace ibex
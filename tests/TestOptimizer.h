@@ -0,0 +1,35 @@
+/* ============================================================================
+ * I B E X - Optimizer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_OPTIMIZER_H__
+#define __TEST_OPTIMIZER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestOptimizer : public TestIbex {
+
+public:
+	TestOptimizer() {
+		TEST_ADD(TestOptimizer::local_search01);
+		TEST_ADD(TestOptimizer::local_search02);
+		TEST_ADD(TestOptimizer::local_search03);
+	}
+
+	void local_search01();
+	void local_search02();
+	void local_search03();
+};
+
+} // end namespace
+
+#endif // __TEST_OPTIMIZER_H__
@@ -0,0 +1,126 @@
+/* ============================================================================
+ * I B E X - Q-intersection Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestQInter.h"
+#include "ibex_QInter.h"
+#include "ibex_CtcQInter.h"
+#include "ibex_CtcFwdBwd.h"
+#include <stdlib.h>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+// the projections are exact
+void TestQInter::projf01() {
+	double _b1[][2] = { {0,2}, {0,2} };
+	double _b2[][2] = { {1,3}, {1,3} };
+	double _b3[][2] = { {1.5,4}, {-1,1.5} };
+	double _b4[][2] = { {10,11}, {10,11} };
+	IntervalVector b1(2,_b1), b2(2,_b2), b3(2,_b3), b4(2,_b4);
+	Array<IntervalVector> boxes(b1,b2,b3,b4);
+
+	double _res[][2] = { {1,3}, {0,2} };
+	IntervalVector res(2,_res);
+	TEST_ASSERT(qinter(boxes,2)==res);
+	TEST_ASSERT(qinter_projf(boxes,2)==res);
+
+	double _res3[][2] = { {1.5,2}, {1,1.5} };
+	IntervalVector res3(2,_res3);
+	TEST_ASSERT(qinter(boxes,3)==res3);
+	TEST_ASSERT(qinter_projf(boxes,3)==res3);
+
+	TEST_ASSERT(qinter_projf(boxes,4).is_empty());
+}
+
+// the projections enclose the q-intersection
+void TestQInter::projf02() {
+	srand(1);
+	for (int n=1; n<=3; n++) {
+		for (int k=0; k<20; k++) {
+			int p=8;
+			Array<IntervalVector> boxes(p);
+			for (int j=0; j<p; j++) {
+				boxes.set_ref(j,*new IntervalVector(n));
+				for (int i=0; i<n; i++) {
+					double lb=((double) rand()/RAND_MAX)*10;
+					double w=((double) rand()/RAND_MAX)*5;
+					boxes[j][i]=Interval(lb,lb+w);
+				}
+			}
+			for (int q=1; q<=4; q++) {
+				IntervalVector hull=qinter(boxes,q);
+				IntervalVector box=qinter_projf(boxes,q);
+				TEST_ASSERT(hull.is_subset(box));
+				if (n==1) TEST_ASSERT(hull==box);
+			}
+			for (int j=0; j<p; j++) delete &boxes[j];
+		}
+	}
+}
+
+// no q boxes intersect (but the projections do): the first
+// hull is [0,1]x[0,1] and the boxes b2 and b3 are then removed
+void TestQInter::projf03() {
+	double _b1[][2] = { {0,1}, {0,1} };
+	double _b2[][2] = { {0,1}, {2,3} };
+	double _b3[][2] = { {2,3}, {0,1} };
+	IntervalVector b1(2,_b1), b2(2,_b2), b3(2,_b3);
+	Array<IntervalVector> boxes(b1,b2,b3);
+
+	TEST_ASSERT(qinter(boxes,2).is_empty());
+	TEST_ASSERT(qinter_projf(boxes,2).is_empty());
+	TEST_ASSERT(qinter_projf(boxes,1)==IntervalVector(2,Interval(0,3)));
+}
+
+// robust estimation of a position with distances to beacons (one outlier)
+void TestQInter::ctc01() {
+	const int N=8;
+	double beacons[N][2] = { {1,1}, {9,1}, {9,9}, {1,9}, {5,0}, {0,5}, {10,5}, {5,10} };
+	double target[2] = { 4, 6 };
+
+	Variable x(2);
+	Function* f[N];
+	Array<Ctc> ctc(N);
+	for (int i=0; i<N; i++) {
+		double dx=beacons[i][0]-target[0], dy=beacons[i][1]-target[1];
+		double d=std::sqrt(dx*dx+dy*dy);
+		if (i==0) d+=3; // outlier
+		f[i]=new Function(x,sqrt(sqr(x[0]-beacons[i][0])+sqr(x[1]-beacons[i][1]))-(d+Interval(-0.1,0.1)));
+		ctc.set_ref(i,*new CtcFwdBwd(*f[i]));
+	}
+
+	IntervalVector init(2,Interval(0,10));
+
+	CtcQInter grid(ctc,N-1);
+	IntervalVector box1(init);
+	grid.contract(box1);
+
+	CtcQInter proj(ctc,N-1,CtcQInter::PROJ);
+	IntervalVector box2(init);
+	proj.contract(box2);
+
+	CtcQInter proj_grid(ctc,N-1,CtcQInter::PROJ_GRID);
+	proj_grid.parallel=true;
+	IntervalVector box3(init);
+	proj_grid.contract(box3);
+
+	TEST_ASSERT(box1.contains(Vector(2,target)));
+	TEST_ASSERT(box1.is_subset(box2));
+	TEST_ASSERT(box1==box3);
+
+	for (int i=0; i<N; i++) {
+		delete &ctc[i];
+		delete f[i];
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,37 @@
+/* ============================================================================
+ * I B E X - Q-intersection Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_QINTER_H__
+#define __TEST_QINTER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestQInter : public TestIbex {
+
+public:
+	TestQInter() {
+		TEST_ADD(TestQInter::projf01);
+		TEST_ADD(TestQInter::projf02);
+		TEST_ADD(TestQInter::projf03);
+		TEST_ADD(TestQInter::ctc01);
+	}
+
+	void projf01();
+	void projf02();
+	void projf03();
+	void ctc01();
+};
+
+} // end namespace
+
+#endif // __TEST_QINTER_H__
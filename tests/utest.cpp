@@ -20,11 +20,14 @@
 // ================ arithmetic ===============
 #include "TestInterval.h"
 #include "TestIntervalVector.h"
+#include "TestIntervalVectorTrail.h"
 #include "TestIntervalMatrix.h"
 #include "TestDim.h"
 #include "TestArith.h"
 #include "TestInnerArith.h"
 #include "TestAffine2.h"
+#include "TestBatchArith.h"
+#include "TestCompensatedArith.h"
 //#include "TestDomain.h"
 
 // ================ symbolic ===============
@@ -46,6 +49,7 @@
 // ================ numeric ===============
 #include "TestLinear.h"
 #include "TestNewton.h"
+#include "TestLinearSolver.h"
 
 // ================ predicates ===============
 #include "TestPdcHansenFeasibility.h"
@@ -56,6 +60,15 @@
 //#include "TestCtcSubBox.h"
 #include "TestCtcNotIn.h"
 #include "TestCtcFritzJohn.h"
+#include "TestCtc3BCid.h"
+#include "TestCtcAdaptiveCompo.h"
+#include "TestEntailment.h"
+#include "TestQInter.h"
+#include "TestCtcExist.h"
+#include "TestCtcFwdBwdFamily.h"
+
+// ================ strategy ===============
+#include "TestOptimizer.h"
 
 #include "TestAffine2.h"
 
@@ -76,10 +89,13 @@ int main() {
 
     ts.add(auto_ptr<Test::Suite>(new TestInterval()));
     ts.add(auto_ptr<Test::Suite>(new TestIntervalVector()));
+    ts.add(auto_ptr<Test::Suite>(new TestIntervalVectorTrail()));
     ts.add(auto_ptr<Test::Suite>(new TestIntervalMatrix()));
     ts.add(auto_ptr<Test::Suite>(new TestDim()));
     ts.add(auto_ptr<Test::Suite>(new TestArith()));
     ts.add(auto_ptr<Test::Suite>(new TestInnerArith()));
+    ts.add(auto_ptr<Test::Suite>(new TestBatchArith()));
+    ts.add(auto_ptr<Test::Suite>(new TestCompensatedArith()));
     //ts.add(auto_ptr<Test::Suite>(new TestDomain()));
 
     ts.add(auto_ptr<Test::Suite>(new TestAffine2()));
@@ -100,6 +116,7 @@ int main() {
 
     ts.add(auto_ptr<Test::Suite>(new TestLinear()));
     ts.add(auto_ptr<Test::Suite>(new TestNewton()));
+    ts.add(auto_ptr<Test::Suite>(new TestLinearSolver()));
 
     ts.add(auto_ptr<Test::Suite>(new TestPdcHansenFeasibility()));
 
@@ -107,6 +124,14 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestCtcInteger()));
     ts.add(auto_ptr<Test::Suite>(new TestCtcNotIn()));
     ts.add(auto_ptr<Test::Suite>(new TestCtcFritzJohn()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtc3BCid()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtcAdaptiveCompo()));
+    ts.add(auto_ptr<Test::Suite>(new TestEntailment()));
+    ts.add(auto_ptr<Test::Suite>(new TestQInter()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtcExist()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtcFwdBwdFamily()));
+
+    ts.add(auto_ptr<Test::Suite>(new TestOptimizer()));
 
     return ts.run(output,false) ? EXIT_SUCCESS : EXIT_FAILURE;
 